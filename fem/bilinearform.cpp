@@ -14,6 +14,7 @@
 #include "fem.hpp"
 #include "../general/device.hpp"
 #include "../mesh/nurbs.hpp"
+#include <algorithm>
 #include <cmath>
 
 namespace mfem
@@ -23,45 +24,32 @@ void BilinearForm::AllocMat()
 {
    if (static_cond) { return; }
 
-   if (precompute_sparsity == 0 || fes->GetVDim() > 1)
+   bool patchwise = false;
+   for (int k = 0; k < domain_integs.Size(); k++)
    {
-      mat = new SparseMatrix(height);
-      return;
+      patchwise = patchwise || domain_integs[k]->Patchwise();
    }
 
-   const Table &elem_dof = fes->GetElementToDofTable();
-   Table dof_dof;
-
-   if (interior_face_integs.Size() > 0)
-   {
-      // the sparsity pattern is defined from the map: face->element->dof
-      Table face_dof, dof_face;
-      {
-         Table *face_elem = fes->GetMesh()->GetFaceToElementTable();
-         mfem::Mult(*face_elem, elem_dof, face_dof);
-         delete face_elem;
-      }
-      Transpose(face_dof, dof_face, height);
-      mfem::Mult(dof_face, face_dof, dof_dof);
-   }
-   else
+   if (precompute_sparsity == 0 || patchwise)
    {
-      // the sparsity pattern is defined from the map: element->dof
-      Table dof_elem;
-      Transpose(elem_dof, dof_elem, height);
-      mfem::Mult(dof_elem, elem_dof, dof_dof);
+      mat = new SparseMatrix(height);
+      return;
    }
 
-   dof_dof.SortRows();
+   // Symbolic phase: the sparsity pattern is computed once and cached by the
+   // FiniteElementSpace. The numeric phase (AddSubMatrix) then adds the element
+   // matrices directly into the preallocated CSR arrays.
+   const Table &dof_dof =
+      fes->GetVDofToVDofTable(interior_face_integs.Size() > 0);
 
-   int *I = dof_dof.GetI();
-   int *J = dof_dof.GetJ();
-   real_t *data = Memory<real_t>(I[height]);
+   const int nnz = dof_dof.Size_of_connections();
+   int *I = new int[height+1];
+   int *J = new int[nnz];
+   std::copy(dof_dof.GetI(), dof_dof.GetI() + height + 1, I);
+   std::copy(dof_dof.GetJ(), dof_dof.GetJ() + nnz, J);
 
-   mat = new SparseMatrix(I, J, data, height, height, true, true, true);
-   *mat = 0.0;
-
-   dof_dof.LoseData();
+   // The entries of the matrix are allocated and initialized with zeros
+   mat = new SparseMatrix(I, J, NULL, height, height, true, true, true);
 }
 
 BilinearForm::BilinearForm(FiniteElementSpace * f)
@@ -504,6 +492,21 @@ void BilinearForm::Assemble(int skip_zeros)
 
       DofTransformation doftrans;
       // Element-wise integration
+#ifdef MFEM_USE_LEGACY_OPENMP
+      bool patchwise = false;
+      for (int k = 0; k < domain_integs.Size(); k++)
+      {
+         patchwise = patchwise || domain_integs[k]->Patchwise();
+      }
+      // Thread-parallel addition of the element matrices (computed in parallel
+      // by ComputeElementMatrices()) into an existing CSR sparsity pattern
+      if (mat->Finalized() && element_matrices && !static_cond &&
+          !hybridization && !patchwise && !fes->IsVariableOrder())
+      {
+         AddElementMatricesColored(skip_zeros);
+      }
+      else
+#endif
       for (int i = 0; i < fes -> GetNE(); i++)
       {
          // Set both doftrans (potentially needed to assemble the element
@@ -792,6 +795,40 @@ void BilinearForm::ConformingAssemble()
    width = mat->Width();
 }
 
+void BilinearForm::AddElementMatricesColored(int skip_zeros)
+{
+   MFEM_VERIFY(mat && mat->Finalized() && element_matrices,
+               "the matrix must be finalized and the element matrices computed");
+   MFEM_VERIFY(!fes->IsVariableOrder(),
+               "variable order spaces are not supported");
+
+   if (!mat->ColumnsAreSorted()) { mat->SortColumnIndices(); }
+   mat->HostReadI();
+   mat->HostReadJ();
+   mat->HostReadWriteData();
+
+   const Table &colors = fes->GetElementColoring();
+   const int nd = element_matrices->SizeI();
+   for (int c = 0; c < colors.Size(); c++)
+   {
+      const int *elements = colors.GetRow(c);
+      const int num_elements = colors.RowSize(c);
+      // Elements of the same color do not share any rows of the matrix
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp parallel for
+#endif
+      for (int k = 0; k < num_elements; k++)
+      {
+         const int i = elements[k];
+         Array<int> el_vdofs;
+         DofTransformation doftrans;
+         fes->GetElementVDofs(i, el_vdofs, doftrans);
+         const DenseMatrix elmat(element_matrices->GetData(i), nd, nd);
+         mat->AddSubMatrixSorted(el_vdofs, el_vdofs, elmat, skip_zeros);
+      }
+   }
+}
+
 void BilinearForm::AssembleDiagonal(Vector &diag) const
 {
    MFEM_ASSERT(diag.Size() == fes->GetTrueVSize(),
@@ -1224,6 +1261,19 @@ void BilinearForm::Mult(const Vector &x, Vector &y) const
    }
 }
 
+void BilinearForm::ArrayMult(const Array<const Vector *> &X,
+                             Array<Vector *> &Y) const
+{
+   if (ext)
+   {
+      ext->ArrayMult(X, Y);
+   }
+   else
+   {
+      mat->ArrayMult(X, Y);
+   }
+}
+
 void BilinearForm::MultTranspose(const Vector & x, Vector & y) const
 {
    if (ext)
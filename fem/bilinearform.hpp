@@ -89,6 +89,10 @@ protected:
        Full Assembly (FA). */
    bool sort_sparse_matrix = false;
 
+   /** Indicates if the domain integrators store their Partial Assembly (PA)
+       quadrature data in single precision. */
+   bool mixed_precision_pa = false;
+
    /** @brief Indicates the Mesh::sequence corresponding to the current state of
        the BilinearForm. */
    long sequence;
@@ -137,6 +141,11 @@ protected:
    /// Allocate appropriate SparseMatrix and assign it to #mat
    void AllocMat();
 
+   /** @brief Add the precomputed #element_matrices to the finalized #mat,
+       processing the elements of each color of the element coloring of the
+       FiniteElementSpace in parallel (with MFEM_USE_LEGACY_OPENMP). */
+   void AddElementMatricesColored(int skip_zeros);
+
    /** @brief For partially conforming trial and/or test FE spaces, complete the
        assembly process by performing $ P^t A P $ where $ A $ is the
        internal sparse matrix and $ P $ is the conforming prolongation
@@ -209,9 +218,33 @@ public:
       sort_sparse_matrix = enable_it;
    }
 
+   /** @brief Store the quadrature data of the domain integrators in single
+       precision when using AssemblyLevel::PARTIAL.
+
+       The PA kernels read the single precision data and accumulate in real_t,
+       which reduces the memory traffic of the operator action at the cost of a
+       relative error of the order of the float machine epsilon. This is
+       intended for operators used inside preconditioners, e.g. Chebyshev
+       smoothers or p-multigrid levels. During assembly, the setting of the
+       domain integrators is replaced by @a enable_it with
+       BilinearFormIntegrator::SetPAMixedPrecision(); integrators that do not
+       support it keep using real_t. This method must be called before
+       assembly.
+   */
+   void EnableMixedPrecisionPA(bool enable_it = true)
+   {
+      mixed_precision_pa = enable_it;
+   }
+
+   /// Return true if EnableMixedPrecisionPA() was enabled.
+   bool MixedPrecisionPAEnabled() const { return mixed_precision_pa; }
+
    /// Returns the assembly level
    AssemblyLevel GetAssemblyLevel() const { return assembly; }
 
+   /// Returns the extension of the assembly level, nullptr for LEGACY.
+   BilinearFormExtension *GetExtension() const { return ext.get(); }
+
    Hybridization *GetHybridization() const { return hybridization.get(); }
 
    /** @brief Enable the use of static condensation. For details see the
@@ -236,9 +269,16 @@ public:
                             BilinearFormIntegrator *constr_integ,
                             const Array<int> &ess_tdof_list);
 
-   /** @brief For scalar FE spaces, precompute the sparsity pattern of the
-       matrix (assuming dense element matrices) based on the types of
-       integrators present in the bilinear form. */
+   /** @brief Precompute the sparsity pattern of the matrix (assuming dense
+       element matrices) based on the types of integrators present in the
+       bilinear form. */
+   /** The pattern is obtained from FiniteElementSpace::GetVDofToVDofTable(),
+       which is cached by the space, and the internal SparseMatrix is allocated
+       directly in CSR format, bypassing the linked-list (LIL) assembly format.
+       This avoids the cost of building and finalizing the LIL storage on every
+       assembly with the same FiniteElementSpace. Explicit zeros in the pattern
+       are kept by Finalize(). Patch-wise (NURBS) integrators are not
+       supported and fall back to the LIL format. */
    void UsePrecomputedSparsity(int ps = 1) { precompute_sparsity = ps; }
 
    /** @brief Use the given CSR sparsity pattern to allocate the internal
@@ -300,6 +340,13 @@ public:
    /// Matrix vector multiplication:  $ y = M x $
    void Mult(const Vector &x, Vector &y) const override;
 
+   /** @brief Matrix vector multiplication for several vectors:
+       $ Y_i = M X_i $ */
+   /** With partial assembly, the domain integrators may apply all vectors at
+       once, see PABilinearFormExtension::ArrayMult(). */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
+
    /** @brief Matrix vector multiplication with the original uneliminated
        matrix.  The original matrix is $ M + M_e $ so we have:
        $ y = M x + M_e x $ */
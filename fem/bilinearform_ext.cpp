@@ -51,6 +51,16 @@ MFBilinearFormExtension::MFBilinearFormExtension(BilinearForm *form)
 
 void MFBilinearFormExtension::Assemble()
 {
+   // Without libCEED, the domain integrators act on E-vectors
+   if (!DeviceCanUseCeed() && elem_restrict == NULL)
+   {
+      const ElementDofOrdering ordering = GetEVectorOrdering(*trial_fes);
+      elem_restrict = trial_fes->GetElementRestriction(ordering);
+      localX.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
+      localY.SetSize(elem_restrict->Height(), Device::GetDeviceMemoryType());
+      localY.UseDevice(true); // ensure 'localY = 0.0' is done on device
+   }
+
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
    const int integratorCount = integrators.Size();
    for (int i = 0; i < integratorCount; ++i)
@@ -336,6 +346,7 @@ void PABilinearFormExtension::Assemble()
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
    for (BilinearFormIntegrator *integ : integrators)
    {
+      integ->SetPAMixedPrecision(a->MixedPrecisionPAEnabled());
       if (integ->Patchwise())
       {
          MFEM_VERIFY(a->FESpace()->GetNURBSext(),
@@ -348,6 +359,8 @@ void PABilinearFormExtension::Assemble()
       }
    }
 
+   SetupFusedIntegrators();
+
    Array<BilinearFormIntegrator*> &bdr_integrators = *a->GetBBFI();
    for (BilinearFormIntegrator *integ : bdr_integrators)
    {
@@ -367,6 +380,38 @@ void PABilinearFormExtension::Assemble()
    }
 }
 
+void PABilinearFormExtension::SetupFusedIntegrators()
+{
+   fused_mass = fused_diffusion = -1;
+   fused_mass_diffusion.Reset();
+   if (DeviceCanUseCeed() || !elem_restrict) { return; }
+
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   int m = -1, d = -1;
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      if (elem_markers[i] || integrators[i]->Patchwise()) { continue; }
+      if (m < 0 && dynamic_cast<MassIntegrator*>(integrators[i]))
+      {
+         m = i;
+      }
+      else if (d < 0 && dynamic_cast<DiffusionIntegrator*>(integrators[i]))
+      {
+         d = i;
+      }
+   }
+   if (m < 0 || d < 0) { return; }
+   auto mass = static_cast<MassIntegrator*>(integrators[m]);
+   auto diff = static_cast<DiffusionIntegrator*>(integrators[d]);
+   if (fused_mass_diffusion.Setup(*mass, *diff) &&
+       fused_mass_diffusion.IsFaster())
+   {
+      fused_mass = m;
+      fused_diffusion = d;
+   }
+}
+
 void PABilinearFormExtension::AssembleDiagonal(Vector &y) const
 {
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
@@ -463,6 +508,9 @@ void PABilinearFormExtension::Update()
    elem_restrict = nullptr;
    int_face_restrict_lex = nullptr;
    bdr_face_restrict_lex = nullptr;
+
+   fused_mass = fused_diffusion = -1;
+   fused_mass_diffusion.Reset();
 }
 
 void PABilinearFormExtension::FormSystemMatrix(const Array<int> &ess_tdof_list,
@@ -543,8 +591,11 @@ void PABilinearFormExtension::MultInternal(const Vector &x, Vector &y,
             elem_restrict->Mult(x, localX);
          }
          localY = 0.0;
+         const bool fused = fused_mass_diffusion.IsSetup() && !useAbs;
+         if (fused) { fused_mass_diffusion.AddMult(localX, localY); }
          for (int i = 0; i < iSz; ++i)
          {
+            if (fused && IsFused(i)) { continue; }
             AddMultWithMarkers(*integrators[i], localX, elem_markers[i],
                                *elem_attributes, false, localY, useAbs);
          }
@@ -676,6 +727,58 @@ void PABilinearFormExtension::MultInternal(const Vector &x, Vector &y,
    }
 }
 
+void PABilinearFormExtension::ArrayMult(const Array<const Vector *> &X,
+                                        Array<Vector *> &Y) const
+{
+   const int nvec = X.Size();
+   Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
+   Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
+   auto H1elem_restrict = dynamic_cast<const ElementRestriction*>(elem_restrict);
+
+   // The derived EA and FA extensions do not use the PA kernels
+   bool multi = nvec > 1 && H1elem_restrict && !DeviceCanUseCeed() &&
+                a->GetAssemblyLevel() == AssemblyLevel::PARTIAL &&
+                integrators.Size() > 0 && a->GetFBFI()->Size() == 0 &&
+                a->GetBBFI()->Size() == 0 && a->GetBFBFI()->Size() == 0;
+   for (int i = 0; multi && i < integrators.Size(); ++i)
+   {
+      multi = !integrators[i]->Patchwise() && !elem_markers[i];
+   }
+   if (!multi)
+   {
+      Operator::ArrayMult(X, Y);
+      return;
+   }
+
+   // Stack the L-vectors, so that they can be restricted together
+   const int lsize = Width(), esize = localX.Size();
+   multi_l.SetSize(nvec*lsize, Device::GetDeviceMemoryType());
+   multi_x.SetSize(nvec*esize, Device::GetDeviceMemoryType());
+   multi_y.SetSize(nvec*esize, Device::GetDeviceMemoryType());
+   multi_y.UseDevice(true); // ensure 'multi_y = 0.0' is done on device
+   Vector lv;
+   for (int v = 0; v < nvec; ++v)
+   {
+      lv.MakeRef(multi_l, v*lsize, lsize);
+      lv = *X[v];
+      lv.SyncAliasMemory(multi_l);
+   }
+
+   H1elem_restrict->MultiMult(nvec, multi_l, multi_x);
+   multi_y = 0.0;
+   for (int i = 0; i < integrators.Size(); ++i)
+   {
+      integrators[i]->AddMultiMultPA(nvec, multi_x, multi_y);
+   }
+   H1elem_restrict->MultiMultTranspose(nvec, multi_y, multi_l);
+
+   for (int v = 0; v < nvec; ++v)
+   {
+      lv.MakeRef(multi_l, v*lsize, lsize);
+      *Y[v] = lv;
+   }
+}
+
 void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
 {
    Array<BilinearFormIntegrator*> &integrators = *a->GetDBFI();
@@ -685,8 +788,12 @@ void PABilinearFormExtension::MultTranspose(const Vector &x, Vector &y) const
       Array<Array<int>*> &elem_markers = *a->GetDBFI_Marker();
       elem_restrict->Mult(x, localX);
       localY = 0.0;
+      // The mass and the diffusion operators are symmetric
+      const bool fused = fused_mass_diffusion.IsSetup();
+      if (fused) { fused_mass_diffusion.AddMult(localX, localY); }
       for (int i = 0; i < iSz; ++i)
       {
+         if (fused && IsFused(i)) { continue; }
          AddMultWithMarkers(*integrators[i], localX, elem_markers[i], *elem_attributes,
                             true, localY);
       }
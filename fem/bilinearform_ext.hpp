@@ -77,9 +77,14 @@ protected:
    mutable Vector bdr_face_X, bdr_face_Y;
    mutable Vector int_face_dXdn, int_face_dYdn;
    mutable Vector bdr_face_dXdn, bdr_face_dYdn;
+   mutable Vector multi_l, multi_x, multi_y; // Work arrays for ArrayMult()
    const Operator *elem_restrict; // Not owned
    const FaceRestriction *int_face_restrict_lex; // Not owned
    const FaceRestriction *bdr_face_restrict_lex; // Not owned
+   /// Fused action of a mass and a diffusion domain integrator, if any.
+   FusedMassDiffusionPA fused_mass_diffusion;
+   /// Indices of the domain integrators applied by #fused_mass_diffusion.
+   int fused_mass = -1, fused_diffusion = -1;
 
 public:
    PABilinearFormExtension(BilinearForm*);
@@ -97,10 +102,31 @@ public:
    void AbsMult(const Vector &x, Vector &y) const override
    { MultInternal(x,y, true); }
    void MultTranspose(const Vector &x, Vector &y) const override;
+   /** @brief Apply the operator to all vectors in @a X at once.
+
+       When the form has only domain integrators without attribute markers,
+       the vectors are restricted together with ElementRestriction::MultiMult()
+       and the integrators are applied with
+       BilinearFormIntegrator::AddMultiMultPA(), so that the partially
+       assembled data is traversed once for all vectors. Otherwise, this falls
+       back to calling Mult() for each vector. */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
    void Update() override;
 
+   /// Returns true if the domain integrator @a i is applied by the fused
+   /// kernel, see FusedMassDiffusionPA.
+   bool IsFused(int i) const
+   { return i == fused_mass || i == fused_diffusion; }
+
 protected:
    void SetupRestrictionOperators(const L2FaceValues m);
+
+   /** @brief Look for a MassIntegrator and a DiffusionIntegrator without
+       attribute markers among the domain integrators and set up their fused
+       action, see FusedMassDiffusionPA. */
+   void SetupFusedIntegrators();
+
    void MultInternal(const Vector &x, Vector &y,
                      const bool useAbs = false) const;
 
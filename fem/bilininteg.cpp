@@ -12,6 +12,7 @@
 // Implementation of Bilinear Form Integrators
 
 #include "fem.hpp"
+#include "../general/forall.hpp"
 #include <cmath>
 #include <algorithm>
 #include <memory>
@@ -127,6 +128,55 @@ void BilinearFormIntegrator::AddAbsMultPA(const Vector &, Vector &) const
               "   is not implemented for this class.");
 }
 
+void BilinearFormIntegrator::AddMultiMultPA(int nvec, const Vector &x,
+                                            Vector &y) const
+{
+   MFEM_ASSERT(x.Size() % nvec == 0 && y.Size() % nvec == 0,
+               "invalid number of vectors: " << nvec);
+   const int xsize = x.Size()/nvec, ysize = y.Size()/nvec;
+   Vector xv, yv;
+   for (int v = 0; v < nvec; v++)
+   {
+      xv.MakeRef(const_cast<Vector&>(x), v*xsize, xsize);
+      yv.MakeRef(y, v*ysize, ysize);
+      AddMultPA(xv, yv);
+      yv.SyncAliasMemory(y);
+   }
+}
+
+bool BilinearFormIntegrator::StorePADataSingle(Vector &pa_data,
+                                               Array<float> &pa_data_sp) const
+{
+   pa_data_sp.DeleteAll();
+   if (!pa_mixed_precision || std::is_same<real_t, float>::value)
+   {
+      return false;
+   }
+   const int n = pa_data.Size();
+   pa_data_sp.SetSize(n, pa_data.GetMemory().GetMemoryType());
+   const auto d = pa_data.Read();
+   auto d_sp = pa_data_sp.Write();
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d_sp[i] = static_cast<float>(d[i]);
+   });
+   pa_data.Destroy();
+   return true;
+}
+
+void BilinearFormIntegrator::LoadPADataSingle(const Array<float> &pa_data_sp,
+                                              Vector &pa_data)
+{
+   const int n = pa_data_sp.Size();
+   pa_data.SetSize(n, pa_data_sp.GetMemory().GetMemoryType());
+   const auto d_sp = pa_data_sp.Read();
+   auto d = pa_data.Write();
+   mfem::forall(n, [=] MFEM_HOST_DEVICE (int i)
+   {
+      d[i] = static_cast<real_t>(d_sp[i]);
+   });
+}
+
 void BilinearFormIntegrator::AddMultNURBSPA(const Vector &, Vector &) const
 {
    MFEM_ABORT("BilinearFormIntegrator::AddMultNURBSPA(...)\n"
@@ -903,6 +953,135 @@ const IntegrationRule &GradientIntegrator::GetRule(const FiniteElement
 }
 
 
+void MFGeometricFactors::Setup(const FiniteElementSpace &fes,
+                               const IntegrationRule &ir)
+{
+   Mesh &mesh = *fes.GetMesh();
+   mesh.EnsureNodes();
+   const GridFunction &mesh_nodes = *mesh.GetNodes();
+   const FiniteElementSpace &nodes_fes = *mesh_nodes.FESpace();
+   MFEM_VERIFY(mesh.GetNumGeometries(mesh.Dimension()) <= 1 &&
+               UsesTensorBasis(nodes_fes), "Only tensor-product meshes are"
+               " supported by the matrix-free integrators without libCEED.");
+   MFEM_VERIFY(mesh.SpaceDimension() == mesh.Dimension(), "Surface meshes are"
+               " not supported by the matrix-free integrators without libCEED.");
+
+   this->mesh = &mesh;
+   IntRule = &ir;
+   dim = mesh.Dimension();
+   ne = mesh.GetNE();
+   maps = &nodes_fes.GetTypicalFE()->GetDofToQuad(ir, DofToQuad::TENSOR);
+   // also registers the specialized QuadratureInterpolator kernels
+   nodes_fes.GetQuadratureInterpolator(ir);
+
+   const Operator *R =
+      nodes_fes.GetElementRestriction(ElementDofOrdering::LEXICOGRAPHIC);
+   nodes.SetSize(R->Height(), Device::GetDeviceMemoryType());
+   R->Mult(mesh_nodes, nodes);
+
+   // On the host, about 4K quadrature points per block keep the quadrature
+   // data of a block (up to 15 values per point in 3D) within a typical L2
+   // cache. Devices need much larger blocks to be fully occupied.
+   const int block_nq = Device::Allows(Backend::DEVICE_MASK) ? (1 << 20) : 4096;
+   block_size = std::max(1, std::min(ne, block_nq / ir.GetNPoints()));
+}
+
+void MFGeometricFactors::GetJacobians(int e0, int nb, Vector &J) const
+{
+   const int d1d = maps->ndof, q1d = maps->nqpt;
+   const int nd = nodes.Size() / (dim*ne);
+   J.SetSize(IntRule->GetNPoints()*dim*dim*nb, Device::GetDeviceMemoryType());
+   QuadratureInterpolator::GradKernels::Run(
+      dim, QVectorLayout::byNODES, false, dim, d1d, q1d, nb, maps->B.Read(),
+      maps->G.Read(), nullptr, nodes.Read() + e0*nd*dim, J.Write(), dim, dim,
+      d1d, q1d);
+}
+
+void MFGeometricFactors::GetDeterminants(int e0, int nb, Vector &detJ) const
+{
+   const int d1d = maps->ndof, q1d = maps->nqpt;
+   const int nd = nodes.Size() / (dim*ne);
+   detJ.SetSize(IntRule->GetNPoints()*nb, Device::GetDeviceMemoryType());
+   QuadratureInterpolator::DetKernels::Run(
+      dim, dim, d1d, q1d, nb, maps->B.Read(), maps->G.Read(),
+      nodes.Read() + e0*nd*dim, detJ.Write(), d1d, q1d, &buffer);
+}
+
+void MFGeometricFactors::GetCoefficient(Coefficient &Q, int e0, int nb,
+                                        Vector &C) const
+{
+   const int nq = IntRule->GetNPoints();
+   C.SetSize(nq*nb, Device::GetDeviceMemoryType());
+   real_t *c = C.HostWrite();
+   IsoparametricTransformation T;
+   for (int e = 0; e < nb; e++)
+   {
+      mesh->GetElementTransformation(e0 + e, &T);
+      for (int q = 0; q < nq; q++)
+      {
+         const IntegrationPoint &ip = IntRule->IntPoint(q);
+         T.SetIntPoint(&ip);
+         c[q + nq*e] = Q.Eval(T, ip);
+      }
+   }
+}
+
+void MFGeometricFactors::GetCoefficient(VectorCoefficient &Q, int e0, int nb,
+                                        Vector &C) const
+{
+   const int nq = IntRule->GetNPoints(), vdim = Q.GetVDim();
+   C.SetSize(vdim*nq*nb, Device::GetDeviceMemoryType());
+   real_t *c = C.HostWrite();
+   IsoparametricTransformation T;
+   Vector col;
+   for (int e = 0; e < nb; e++)
+   {
+      mesh->GetElementTransformation(e0 + e, &T);
+      for (int q = 0; q < nq; q++)
+      {
+         const IntegrationPoint &ip = IntRule->IntPoint(q);
+         T.SetIntPoint(&ip);
+         col.SetDataAndSize(c + vdim*(q + nq*e), vdim);
+         Q.Eval(col, T, ip);
+      }
+   }
+}
+
+void MFGeometricFactors::GetCoefficient(MatrixCoefficient &Q, int e0, int nb,
+                                        Vector &C) const
+{
+   auto *sym_Q = dynamic_cast<SymmetricMatrixCoefficient*>(&Q);
+   const int nq = IntRule->GetNPoints();
+   const int height = Q.GetHeight(), width = Q.GetWidth();
+   const int vdim = sym_Q ? height*(height + 1)/2 : height*width;
+   C.SetSize(vdim*nq*nb, Device::GetDeviceMemoryType());
+   real_t *c = C.HostWrite();
+   IsoparametricTransformation T;
+   DenseMatrix M;
+   DenseSymmetricMatrix S;
+   for (int e = 0; e < nb; e++)
+   {
+      mesh->GetElementTransformation(e0 + e, &T);
+      for (int q = 0; q < nq; q++)
+      {
+         const IntegrationPoint &ip = IntRule->IntPoint(q);
+         T.SetIntPoint(&ip);
+         real_t *cq = c + vdim*(q + nq*e);
+         if (sym_Q)
+         {
+            S.UseExternalData(cq, height);
+            sym_Q->Eval(S, T, ip);
+         }
+         else
+         {
+            M.UseExternalData(cq, height, width);
+            Q.Eval(M, T, ip);
+            M.Transpose();
+         }
+      }
+   }
+}
+
 DiffusionIntegrator::DiffusionIntegrator(const IntegrationRule *ir)
    : BilinearFormIntegrator(ir),
      Q(nullptr), VQ(nullptr), MQ(nullptr), maps(nullptr), geom(nullptr)
@@ -30,10 +30,45 @@ class FaceQuadratureSpace;
 class BilinearFormIntegrator : public NonlinearFormIntegrator
 {
 protected:
+   /// Store the PA quadrature data in single precision, see
+   /// SetPAMixedPrecision().
+   bool pa_mixed_precision = false;
+
    BilinearFormIntegrator(const IntegrationRule *ir = NULL)
       : NonlinearFormIntegrator(ir) { }
 
+   /** @brief If mixed precision PA is enabled, copy @a pa_data to the single
+       precision array @a pa_data_sp and release @a pa_data.
+
+       Returns true if the conversion took place, otherwise @a pa_data_sp is
+       empty and @a pa_data is left unchanged. The conversion is skipped when
+       real_t is float. */
+   bool StorePADataSingle(Vector &pa_data, Array<float> &pa_data_sp) const;
+
+   /// Convert the single precision PA data @a pa_data_sp to real_t.
+   static void LoadPADataSingle(const Array<float> &pa_data_sp,
+                                Vector &pa_data);
+
 public:
+   /** @brief Store the quadrature data of partial assembly in single precision
+       (float), while the PA kernels still accumulate in real_t. */
+   /** This reduces the memory traffic of AddMultPA() and is intended for
+       operators that are only applied approximately, e.g. inside smoothers or
+       multigrid preconditioners. The action has a relative error of the order
+       of the float machine epsilon.
+
+       Currently supported by MassIntegrator, DiffusionIntegrator and
+       VectorDiffusionIntegrator on tensor-product elements in 2D and 3D; other
+       integrators, and AssembleEA() used by element and full assembly, ignore
+       this setting. It must be set before AssemblePA(). In a BilinearForm with
+       partial assembly, it is replaced by the setting of
+       BilinearForm::EnableMixedPrecisionPA(). */
+   void SetPAMixedPrecision(bool enable = true)
+   { pa_mixed_precision = enable; }
+
+   /// Return true if SetPAMixedPrecision() was enabled.
+   bool GetPAMixedPrecision() const { return pa_mixed_precision; }
+
    // TODO: add support for other assembly levels (in addition to PA) and their
    // actions.
 
@@ -82,6 +117,17 @@ public:
 
    virtual void AddAbsMultPA(const Vector &x, Vector &y) const;
 
+   /// Method for partially assembled action on several vectors.
+   /** Perform the action of integrator on the @a nvec E-vectors stored one
+       after the other in @a x and add the results to the corresponding
+       E-vectors stored in @a y.
+
+       The default implementation calls AddMultPA() for each vector.
+       Integrators that override this method apply all vectors to an element
+       before moving on to the next one, reusing the partially assembled data
+       of the element. */
+   virtual void AddMultiMultPA(int nvec, const Vector &x, Vector &y) const;
+
    /// Method for partially assembled action on NURBS patches.
    virtual void AddMultNURBSPA(const Vector&x, Vector&y) const;
 
@@ -2172,10 +2218,115 @@ protected:
    }
 };
 
+/** @brief Geometric factors of the elements of a FiniteElementSpace, computed on
+    the fly for one block of elements at a time.
+
+    Used by the native (without libCEED) matrix-free action of integrators,
+    i.e. with AssemblyLevel::NONE: only the mesh nodes are stored, as an
+    E-vector, and the Jacobians at the quadrature points are recomputed for
+    each block of elements. The blocks are small enough for their quadrature
+    data to stay in cache on the host. Only tensor-product meshes with the
+    same dimension and space dimension are supported. */
+class MFGeometricFactors
+{
+private:
+   Mesh *mesh = nullptr; ///< Not owned
+   const IntegrationRule *IntRule = nullptr;
+   const DofToQuad *maps = nullptr; ///< Basis of the mesh nodes, not owned
+   Vector nodes; ///< E-vector of the mesh nodes (lexicographic ordering)
+   int dim = 0, ne = 0, block_size = 0;
+   mutable Vector buffer;
+
+public:
+   /// Set up the factors of the elements of @a fes at the points of @a ir.
+   void Setup(const FiniteElementSpace &fes, const IntegrationRule &ir);
+
+   const IntegrationRule &GetIntRule() const { return *IntRule; }
+
+   /// Number of elements in the blocks of GetJacobians() and GetDeterminants().
+   int GetBlockSize() const { return block_size; }
+
+   /** @brief Compute the Jacobians of the elements [e0, e0+nb) in @a J, with
+       the layout of GeometricFactors::J. */
+   void GetJacobians(int e0, int nb, Vector &J) const;
+
+   /** @brief Compute the determinants of the Jacobians of the elements
+       [e0, e0+nb) in @a detJ, with the layout of GeometricFactors::detJ. */
+   void GetDeterminants(int e0, int nb, Vector &detJ) const;
+
+   /** @brief Evaluate @a Q at the quadrature points of the elements
+       [e0, e0+nb) in @a C, with the layout of CoefficientVector. */
+   void GetCoefficient(Coefficient &Q, int e0, int nb, Vector &C) const;
+
+   /// Vector coefficient version of GetCoefficient().
+   void GetCoefficient(VectorCoefficient &Q, int e0, int nb, Vector &C) const;
+
+   /** @brief Matrix coefficient version of GetCoefficient(), with the layout
+       of CoefficientVector::ProjectTranspose() and compressed storage: the
+       matrices are transposed, or stored as their upper triangular part if
+       @a Q is a SymmetricMatrixCoefficient. */
+   void GetCoefficient(MatrixCoefficient &Q, int e0, int nb, Vector &C) const;
+};
+
+/** @brief 1D tables for the sum-factorized partial assembly on triangles and
+    tetrahedra with a Bernstein basis (H1Pos and L2Pos elements).
+
+    In the collapsed coordinates of IntegrationRules::GetCollapsed(), the
+    Bernstein polynomial with indices (i,j[,k]) on the simplex of degree p is
+    the product B^{p-j}_i(a) B^p_j(b) on the triangle and B^{p-k-j}_i(a)
+    B^{p-k}_j(b) B^p_k(c) on the tetrahedron, so its values and derivatives at
+    the points of the collapsed rule can be evaluated by contracting one
+    direction at a time, in O(p^{dim+1}) operations per element.
+
+    Nodal simplices, e.g. the default H1 and L2 bases, are handled through the
+    change of basis @a T to the Bernstein basis, applied element by element in
+    O(p^{2 dim}) operations. */
+class BernsteinSimplexMaps
+{
+public:
+   int order = 0; ///< Degree p of the element, 0 if not set up
+   int nqpt = 0;  ///< Number of 1D quadrature points n
+
+   /** @brief Values of the 1D Bernstein polynomials of all degrees m <= p at
+       the 1D quadrature points, B(i,m,q) = binom(m,i) t_q^i (1-t_q)^(m-i),
+       with layout (p+1) x (p+1) x n and zeros for i > m. */
+   Array<real_t> B;
+   /// Derivatives of the polynomials in @a B, with the same layout.
+   Array<real_t> G;
+   /// The 1D quadrature points t_q.
+   Array<real_t> points;
+   /** @brief Native index of the DOF with Bernstein indices (i,j[,k]), in the
+       ordering with i fastest, then j, then k, and i+j+k <= p. */
+   Array<int> dof_map;
+   /** @brief For nodal elements, the ND x ND change of basis from the native
+       basis to the Bernstein basis, with the DOFs of the latter in the order
+       of @a dof_map (which is then the identity). Empty for H1Pos and L2Pos
+       elements. */
+   Array<real_t> T;
+   /// Temporaries for the change of basis.
+   mutable Vector tmp_x, tmp_y;
+
+   /** @brief Return true if @a el is a triangle or a tetrahedron of order at
+       least 1, with a Bernstein (H1Pos, L2Pos) or a nodal basis of the full
+       polynomial space. */
+   static bool Supports(const FiniteElement &el);
+
+   /** @brief Set up the tables for @a el and return the collapsed integration
+       rule of order @a ir_order they correspond to.
+
+       If @a el is not supported, reset the object and return nullptr. */
+   const IntegrationRule *Setup(const FiniteElement &el, int ir_order);
+
+   void Reset() { order = nqpt = 0; }
+
+   bool IsSetup() const { return order > 0; }
+};
+
 /** Class for integrating the bilinear form $a(u,v) := (Q \nabla u, \nabla v)$ where $Q$
     can be a scalar or a matrix coefficient. */
 class DiffusionIntegrator: public BilinearFormIntegrator
 {
+   friend class FusedMassDiffusionPA;
 public:
 
    using ApplyKernelType = void(*)(const int, const bool, const Array<real_t>&,
@@ -2184,11 +2335,33 @@ public:
                                    const Vector&, const Vector&,
                                    Vector&, const int, const int);
 
+   /// Same as ApplyKernelType, with single precision quadrature data.
+   using ApplyMixedKernelType = void(*)(const int, const bool,
+                                        const Array<real_t>&,
+                                        const Array<real_t>&,
+                                        const Array<real_t>&,
+                                        const Array<real_t>&,
+                                        const Array<float>&, const Vector&,
+                                        Vector&, const int, const int);
+
    using DiagonalKernelType = void(*)(const int, const bool, const Array<real_t>&,
                                       const Array<real_t>&, const Vector&, Vector&,
                                       const int, const int);
 
+   /// Same as ApplyKernelType, for several E-vectors stored one after the other.
+   using MultiApplyKernelType = void(*)(const int, const int, const bool,
+                                        const Array<real_t>&,
+                                        const Array<real_t>&,
+                                        const Array<real_t>&,
+                                        const Array<real_t>&,
+                                        const Vector&, const Vector&,
+                                        Vector&, const int, const int);
+
    MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType, (int, int, int));
+   MFEM_REGISTER_KERNELS(ApplyMixedPAKernels, ApplyMixedKernelType,
+                         (int, int, int));
+   MFEM_REGISTER_KERNELS(MultiApplyPAKernels, MultiApplyKernelType,
+                         (int, int, int));
    MFEM_REGISTER_KERNELS(DiagonalPAKernels, DiagonalKernelType, (int, int, int));
    struct Kernels { Kernels(); };
 
@@ -2212,6 +2385,17 @@ private:
    int dim, ne, dofs1D, quad1D;
    Vector pa_data;
    bool symmetric = true; ///< False if using a nonsymmetric matrix coefficient
+   BernsteinSimplexMaps simplex_maps; ///< Used instead of maps on simplices
+   Array<float> pa_data_sp; ///< Replaces pa_data with mixed precision PA
+
+   // MF extension without libCEED
+   MFGeometricFactors mf_geom;
+   Vector mf_coeff; ///< Constant coefficient, empty if evaluated per block
+   int mf_coeff_dim = 0;
+   mutable Vector mf_J, mf_C, mf_data; ///< Quadrature data of one block
+
+   /// Compute the PA data of the elements [e0, e0+nb) in mf_data.
+   void SetupMFBlock(int e0, int nb) const;
 
    // Data for NURBS patch PA
 
@@ -2332,6 +2516,8 @@ public:
 
    void AddAbsMultPA(const Vector&, Vector&) const override;
 
+   void AddMultiMultPA(int nvec, const Vector&, Vector&) const override;
+
    void AddMultTransposePA(const Vector&, Vector&) const override;
 
    void AddAbsMultTransposePA(const Vector&, Vector&) const override;
@@ -2351,6 +2537,8 @@ public:
    static void AddSpecialization()
    {
       ApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+      ApplyMixedPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+      MultiApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
       DiagonalPAKernels::Specialization<DIM,D1D,Q1D>::Add();
    }
 protected:
@@ -2367,6 +2555,7 @@ protected:
 class MassIntegrator: public BilinearFormIntegrator
 {
    friend class DGMassInverse;
+   friend class FusedMassDiffusionPA;
 protected:
 #ifndef MFEM_THREAD_SAFE
    Vector shape, te_shape;
@@ -2379,6 +2568,17 @@ protected:
    const GeometricFactors *geom;          ///< Not owned
    const FaceGeometricFactors *face_geom; ///< Not owned
    int dim, ne, nq, dofs1D, quad1D;
+   BernsteinSimplexMaps simplex_maps; ///< Used instead of maps on simplices
+   Array<float> pa_data_sp; ///< Replaces pa_data with mixed precision PA
+
+   // MF extension without libCEED
+   MFGeometricFactors mf_geom;
+   Vector mf_coeff; ///< Constant coefficient, empty if evaluated per block
+   bool mf_by_val = true; ///< False for elements with MapType INTEGRAL
+   mutable Vector mf_detJ, mf_C, mf_data; ///< Quadrature data of one block
+
+   /// Compute the PA data of the elements [e0, e0+nb) in mf_data.
+   void SetupMFBlock(int e0, int nb) const;
 
    void AssembleEA_(Vector &ea, const bool add);
 
@@ -2392,7 +2592,24 @@ public:
                                        const Vector&, Vector&, const int,
                                        const int);
 
+   /// Same as ApplyKernelType, with single precision quadrature data.
+   using ApplyMixedKernelType = void(*)(const int, const Array<real_t>&,
+                                        const Array<real_t>&,
+                                        const Array<float>&, const Vector&,
+                                        Vector&, const int, const int);
+
+   /// Same as ApplyKernelType, for several E-vectors stored one after the other.
+   using MultiApplyKernelType = void(*)(const int, const int,
+                                        const Array<real_t>&,
+                                        const Array<real_t>&, const Vector&,
+                                        const Vector&, Vector&, const int,
+                                        const int);
+
    MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType, (int, int, int));
+   MFEM_REGISTER_KERNELS(ApplyMixedPAKernels, ApplyMixedKernelType,
+                         (int, int, int));
+   MFEM_REGISTER_KERNELS(MultiApplyPAKernels, MultiApplyKernelType,
+                         (int, int, int));
    MFEM_REGISTER_KERNELS(DiagonalPAKernels, DiagonalKernelType, (int, int, int));
    struct Kernels { Kernels(); };
 
@@ -2435,6 +2652,8 @@ public:
 
    void AddAbsMultPA(const Vector&, Vector&) const override;
 
+   void AddMultiMultPA(int nvec, const Vector&, Vector&) const override;
+
    void AddMultTransposePA(const Vector&, Vector&) const override;
 
    void AddAbsMultTransposePA(const Vector&, Vector&) const override;
@@ -2451,6 +2670,8 @@ public:
    static void AddSpecialization()
    {
       ApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+      ApplyMixedPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+      MultiApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
       DiagonalPAKernels::Specialization<DIM,D1D,Q1D>::Add();
    }
 
@@ -2464,6 +2685,68 @@ protected:
    }
 };
 
+/** @brief Fused partial assembly action of a MassIntegrator and a
+    DiffusionIntegrator, e.g. the operator $M + \Delta t K$.
+
+    The action of the sum is computed with a single sum-factorized pass over
+    the E-vectors: the values and the gradients are interpolated together,
+    and projected back together, instead of reading @a x and writing @a y
+    once per integrator. The kernels read the partially assembled data of the
+    two integrators, so no additional quadrature data is stored.
+
+    Used by PABilinearFormExtension when the domain integrators of a form
+    contain such a pair and IsFaster() returns true for them. */
+class FusedMassDiffusionPA
+{
+protected:
+   const MassIntegrator *mass = nullptr;      ///< Not owned
+   const DiffusionIntegrator *diff = nullptr; ///< Not owned
+
+public:
+   using ApplyKernelType = void(*)(const int, const Array<real_t>&,
+                                   const Array<real_t>&, const Vector&,
+                                   const Vector&, const Vector&, Vector&,
+                                   const int, const int);
+
+   MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType, (int, int, int));
+   struct Kernels { Kernels(); };
+
+   /** @brief Set up the fused action of @a mass and @a diff, which must stay
+       partially assembled while it is used.
+
+       Returns false, and leaves the object empty, if the integrators cannot
+       be fused: the two integrators must use the same tensor-product
+       quadrature rule on 2D or 3D tensor elements, @a diff must be
+       symmetric, and neither of them may use mixed precision PA or
+       libCEED. */
+   bool Setup(const MassIntegrator &mass, const DiffusionIntegrator &diff);
+
+   /** @brief Returns true if the fused kernel is faster than the two separate
+       kernels for these sizes on the current device.
+
+       Based on the measurements of tests/benchmarks/bench_fused_pa.cpp. */
+   static bool IsFaster(int dim, int d1d, int q1d);
+
+   /// Returns true if the fused kernel is faster for the integrators given to
+   /// Setup(), which must have succeeded.
+   bool IsFaster() const;
+
+   void Reset() { mass = nullptr; diff = nullptr; }
+
+   /// Returns true if Setup() succeeded.
+   bool IsSetup() const { return mass != nullptr; }
+
+   /// Add the action of the sum of the two integrators on the E-vector @a x
+   /// to the E-vector @a y.
+   void AddMult(const Vector &x, Vector &y) const;
+
+   template <int DIM, int D1D, int Q1D>
+   static void AddSpecialization()
+   {
+      ApplyPAKernels::Specialization<DIM,D1D,Q1D>::Add();
+   }
+};
+
 /** Mass integrator $(u, v)$ restricted to the boundary of a domain */
 class BoundaryMassIntegrator : public MassIntegrator
 {
@@ -3143,6 +3426,7 @@ protected:
    const GeometricFactors *geom;  ///< Not owned
    int ne, dim, sdim, dofs1D, quad1D, coeff_vdim;
    Vector pa_data;
+   Array<float> pa_data_sp; ///< Replaces pa_data with mixed precision PA
 
 public:
    VectorDiffusionIntegrator(const IntegrationRule *ir = nullptr);
@@ -3212,13 +3496,24 @@ public:
                                     const Vector &, const Vector &, Vector &,
                                     const int, const int, const int);
 
+   /// Same as ApplyKernelType, with single precision quadrature data.
+   using ApplyMixedKernelType = void (*)(const int, const int,
+                                         const Array<real_t> &,
+                                         const Array<real_t> &,
+                                         const Array<float> &, const Vector &,
+                                         Vector &, const int, const int,
+                                         const int);
+
    /// arguments: dim, vdim, d1d, q1d
    MFEM_REGISTER_KERNELS(ApplyPAKernels, ApplyKernelType, (int, int, int, int));
+   MFEM_REGISTER_KERNELS(ApplyMixedPAKernels, ApplyMixedKernelType,
+                         (int, int, int, int));
 
    template <int DIM, int VDIM, int D1D, int Q1D>
    static void AddSpecialization()
    {
       ApplyPAKernels::Specialization<DIM, VDIM, D1D, Q1D>::Add();
+      ApplyMixedPAKernels::Specialization<DIM, VDIM, D1D, Q1D>::Add();
    }
 
    // struct Kernels { Kernels(); };
@@ -18,6 +18,8 @@
 #include "picojson.h"
 
 #include <cerrno>      // errno
+#include <cstdint>
+#include <limits>
 #include <sstream>
 #include <regex>
 
@@ -794,6 +796,658 @@ void VisItDataCollection::ParseVisItRootString(const std::string& json)
    }
 }
 
+#ifdef MFEM_USE_MPI
+
+// class CheckpointDataCollection implementation
+
+namespace internal
+{
+
+// The checkpoint file starts with a header, written by rank 0, which gives the
+// offsets of the sections that follow it. All integers in the file, including
+// the vertex indices, are 64-bit.
+static const char ckpt_magic[8] = {'M','F','E','M','C','K','P','T'};
+static constexpr int64_t ckpt_version = 1;
+
+// Size of the (boundary) element records: attribute, geometry and vertices,
+// padded with -1 up to the largest number of vertices of an element.
+static constexpr int ckpt_max_verts = 8;
+static constexpr int ckpt_rec_size = 2 + ckpt_max_verts;
+
+// A field is stored in a section starting at 'offset' as the offsets of the
+// values of every element (NE int64), followed by the values themselves.
+struct CheckpointField
+{
+   std::string name, fec_name;
+   int64_t vdim = 1, ordering = 0, offset = 0;
+};
+
+struct CheckpointHeader
+{
+   int64_t dim = 0, sdim = 0, ne = 0, nbe = 0, nv = 0;
+   real_t time = 0.0, time_step = 0.0;
+   // Element offsets of the ranks that saved the file: NE_rank + 1 entries
+   std::vector<int64_t> elem_offsets;
+   // Offsets of the vertices, elements and boundary elements sections
+   int64_t vert_offset = 0, elem_offset = 0, bdr_offset = 0;
+   bool has_nodes = false;
+   CheckpointField nodes;
+   std::vector<CheckpointField> fields;
+
+   static void WriteString(std::ostream &os, const std::string &s)
+   {
+      bin_io::write<int64_t>(os, s.size());
+      os.write(s.data(), s.size());
+   }
+
+   static std::string ReadString(std::istream &is)
+   {
+      std::string s(bin_io::read<int64_t>(is), '\0');
+      is.read(&s[0], s.size());
+      return s;
+   }
+
+   static void WriteField(std::ostream &os, const CheckpointField &f)
+   {
+      WriteString(os, f.name);
+      WriteString(os, f.fec_name);
+      bin_io::write(os, f.vdim);
+      bin_io::write(os, f.ordering);
+      bin_io::write(os, f.offset);
+   }
+
+   static void ReadField(std::istream &is, CheckpointField &f)
+   {
+      f.name = ReadString(is);
+      f.fec_name = ReadString(is);
+      f.vdim = bin_io::read<int64_t>(is);
+      f.ordering = bin_io::read<int64_t>(is);
+      f.offset = bin_io::read<int64_t>(is);
+   }
+
+   // Return the header as a byte string
+   std::string Write() const
+   {
+      std::ostringstream os;
+      os.write(ckpt_magic, sizeof(ckpt_magic));
+      bin_io::write<int64_t>(os, 0); // header size, set below
+      bin_io::write(os, ckpt_version);
+      bin_io::write<int64_t>(os, sizeof(real_t));
+      bin_io::write(os, dim);
+      bin_io::write(os, sdim);
+      bin_io::write(os, ne);
+      bin_io::write(os, nbe);
+      bin_io::write(os, nv);
+      bin_io::write(os, time);
+      bin_io::write(os, time_step);
+      bin_io::write<int64_t>(os, elem_offsets.size());
+      for (int64_t off : elem_offsets) { bin_io::write(os, off); }
+      bin_io::write(os, vert_offset);
+      bin_io::write(os, elem_offset);
+      bin_io::write(os, bdr_offset);
+      bin_io::write<int64_t>(os, has_nodes);
+      if (has_nodes) { WriteField(os, nodes); }
+      bin_io::write<int64_t>(os, fields.size());
+      for (const CheckpointField &f : fields) { WriteField(os, f); }
+
+      std::string buf = os.str();
+      const int64_t size = buf.size();
+      std::copy_n(reinterpret_cast<const char*>(&size), sizeof(size),
+                  &buf[sizeof(ckpt_magic)]);
+      return buf;
+   }
+
+   // Read the header from the byte string 'buf'; return false on error
+   bool Read(const std::string &buf)
+   {
+      std::istringstream is(buf);
+      char magic[sizeof(ckpt_magic)];
+      is.read(magic, sizeof(magic));
+      if (!is || !std::equal(magic, magic + sizeof(magic), ckpt_magic))
+      {
+         MFEM_WARNING("invalid checkpoint file");
+         return false;
+      }
+      bin_io::read<int64_t>(is); // header size
+      const int64_t version = bin_io::read<int64_t>(is);
+      const int64_t real_size = bin_io::read<int64_t>(is);
+      if (version != ckpt_version || real_size != (int64_t)sizeof(real_t))
+      {
+         MFEM_WARNING("unsupported checkpoint file: version " << version
+                      << ", sizeof(real_t) = " << real_size);
+         return false;
+      }
+      dim = bin_io::read<int64_t>(is);
+      sdim = bin_io::read<int64_t>(is);
+      ne = bin_io::read<int64_t>(is);
+      nbe = bin_io::read<int64_t>(is);
+      nv = bin_io::read<int64_t>(is);
+      time = bin_io::read<real_t>(is);
+      time_step = bin_io::read<real_t>(is);
+      elem_offsets.resize(bin_io::read<int64_t>(is));
+      for (int64_t &off : elem_offsets) { off = bin_io::read<int64_t>(is); }
+      vert_offset = bin_io::read<int64_t>(is);
+      elem_offset = bin_io::read<int64_t>(is);
+      bdr_offset = bin_io::read<int64_t>(is);
+      has_nodes = bin_io::read<int64_t>(is);
+      if (has_nodes) { ReadField(is, nodes); }
+      fields.resize(bin_io::read<int64_t>(is));
+      for (CheckpointField &f : fields) { ReadField(is, f); }
+      if (!is) { MFEM_WARNING("error reading the checkpoint header"); }
+      return bool(is);
+   }
+};
+
+template <typename T>
+static bool CheckpointWriteAll(MPI_File fh, MPI_Offset offset, const T *buf,
+                               size_t count)
+{
+   MFEM_VERIFY(count <= (size_t)std::numeric_limits<int>::max(),
+               "the local data is too large: " << count);
+   return MPI_File_write_at_all(fh, offset, buf, (int)count,
+                                MPITypeMap<T>::mpi_type,
+                                MPI_STATUS_IGNORE) == MPI_SUCCESS;
+}
+
+template <typename T>
+static bool CheckpointRead(MPI_File fh, MPI_Offset offset, std::vector<T> &buf)
+{
+   MFEM_VERIFY(buf.size() <= (size_t)std::numeric_limits<int>::max(),
+               "the data is too large: " << buf.size());
+   return MPI_File_read_at(fh, offset, buf.data(), (int)buf.size(),
+                           MPITypeMap<T>::mpi_type,
+                           MPI_STATUS_IGNORE) == MPI_SUCCESS;
+}
+
+// Values of 'gf' element by element, with the offsets of the elements
+static void GetElementValues(const GridFunction &gf, int64_t first,
+                             std::vector<int64_t> &offsets,
+                             std::vector<real_t> &values)
+{
+   const FiniteElementSpace &fes = *gf.FESpace();
+   MFEM_VERIFY(!fes.IsVariableOrder() && !fes.GetNURBSext(),
+               "variable order and NURBS spaces are not supported");
+   gf.HostRead();
+   Array<int> vdofs;
+   Vector el_values;
+   offsets.resize(fes.GetNE());
+   values.clear();
+   for (int i = 0; i < fes.GetNE(); i++)
+   {
+      fes.GetElementVDofs(i, vdofs);
+      gf.GetSubVector(vdofs, el_values);
+      offsets[i] = first + values.size();
+      values.insert(values.end(), el_values.begin(), el_values.end());
+   }
+}
+
+// Read the field 'f' on the local elements, whose global indices are 'elems'
+static ParGridFunction *ReadCheckpointField(MPI_File fh, int64_t ne,
+                                            const CheckpointField &f,
+                                            ParMesh &pmesh,
+                                            const Array<int> &elems, bool &ok)
+{
+   FiniteElementCollection *fec = FiniteElementCollection::New(
+                                     f.fec_name.c_str());
+   ParFiniteElementSpace *fes = new ParFiniteElementSpace(
+      &pmesh, fec, (int)f.vdim, (int)f.ordering);
+   ParGridFunction *gf = new ParGridFunction(fes);
+   gf->MakeOwner(fec);
+
+   // The global element indices are sorted, so are the file offsets.
+   const int loc_ne = elems.Size();
+   std::vector<int64_t> offsets(loc_ne);
+   std::vector<MPI_Aint> displs(loc_ne);
+   for (int k = 0; k < loc_ne; k++)
+   {
+      displs[k] = (MPI_Aint)elems[k]*sizeof(int64_t);
+   }
+   MPI_Datatype ftype;
+   MPI_Type_create_hindexed_block(loc_ne, 1, displs.data(), MPI_INT64_T,
+                                  &ftype);
+   MPI_Type_commit(&ftype);
+   ok &= MPI_File_set_view(fh, f.offset, MPI_INT64_T, ftype, "native",
+                           MPI_INFO_NULL) == MPI_SUCCESS;
+   ok &= MPI_File_read_all(fh, offsets.data(), loc_ne, MPI_INT64_T,
+                           MPI_STATUS_IGNORE) == MPI_SUCCESS;
+   MPI_Type_free(&ftype);
+
+   Array<int> vdofs;
+   std::vector<int> sizes(loc_ne);
+   size_t total = 0;
+   for (int k = 0; k < loc_ne; k++)
+   {
+      fes->GetElementVDofs(k, vdofs);
+      sizes[k] = vdofs.Size();
+      displs[k] = (MPI_Aint)offsets[k]*sizeof(real_t);
+      total += sizes[k];
+   }
+   MFEM_VERIFY(total <= (size_t)std::numeric_limits<int>::max(),
+               "the local data is too large: " << total);
+   const MPI_Datatype real_type = MPITypeMap<real_t>::mpi_type;
+   std::vector<real_t> values(total);
+   MPI_Type_create_hindexed(loc_ne, sizes.data(), displs.data(), real_type,
+                            &ftype);
+   MPI_Type_commit(&ftype);
+   ok &= MPI_File_set_view(fh, f.offset + ne*sizeof(int64_t), real_type, ftype,
+                           "native", MPI_INFO_NULL) == MPI_SUCCESS;
+   ok &= MPI_File_read_all(fh, values.data(), (int)total, real_type,
+                           MPI_STATUS_IGNORE) == MPI_SUCCESS;
+   MPI_Type_free(&ftype);
+
+   real_t *el_values = values.data();
+   for (int k = 0; k < loc_ne; k++)
+   {
+      fes->GetElementVDofs(k, vdofs);
+      gf->SetSubVector(vdofs, el_values);
+      el_values += vdofs.Size();
+   }
+   return gf;
+}
+
+} // namespace internal
+
+CheckpointDataCollection::CheckpointDataCollection(
+   MPI_Comm comm, const std::string &collection_name, Mesh *mesh_)
+   : DataCollection(collection_name, mesh_), part_method(1)
+{
+   m_comm = comm;
+   MPI_Comm_rank(comm, &myid);
+   MPI_Comm_size(comm, &num_procs);
+   cycle = 0; // always include cycle in file names
+}
+
+std::string CheckpointDataCollection::GetCheckpointFileName() const
+{
+   return prefix_path + name + "_" + to_padded_string(cycle, pad_digits_cycle) +
+          ".mfem_ckpt";
+}
+
+void CheckpointDataCollection::Save()
+{
+   using namespace internal;
+
+   ParMesh *pmesh = dynamic_cast<ParMesh*>(mesh);
+   MFEM_VERIFY(pmesh, "the mesh of a CheckpointDataCollection must be a "
+               "ParMesh");
+   MFEM_VERIFY(pmesh->Conforming() && !pmesh->NURBSext,
+               "nonconforming and NURBS meshes are not supported");
+   if (q_field_map.NumFields() > 0)
+   {
+      MFEM_WARNING("the q-fields are not saved in a checkpoint");
+   }
+
+   const int dim = pmesh->Dimension(), sdim = pmesh->SpaceDimension();
+   const int64_t loc_ne = pmesh->GetNE(), loc_nbe = pmesh->GetNBE();
+   CheckpointHeader hdr;
+   hdr.dim = dim;
+   hdr.sdim = sdim;
+   hdr.time = time;
+   hdr.time_step = time_step;
+
+   // Global numbering of the elements and of the boundary elements, which are
+   // stored rank by rank
+   hdr.elem_offsets.resize(num_procs + 1);
+   hdr.elem_offsets[0] = 0;
+   MPI_Allgather(&loc_ne, 1, MPI_INT64_T, &hdr.elem_offsets[1], 1,
+                 MPI_INT64_T, m_comm);
+   for (int p = 0; p < num_procs; p++)
+   {
+      hdr.elem_offsets[p+1] += hdr.elem_offsets[p];
+   }
+   hdr.ne = hdr.elem_offsets[num_procs];
+   const int64_t first_elem = hdr.elem_offsets[myid];
+   int64_t first_bdr = 0;
+   MPI_Exscan(&loc_nbe, &first_bdr, 1, MPI_INT64_T, MPI_SUM, m_comm);
+   if (myid == 0) { first_bdr = 0; }
+   MPI_Allreduce(&loc_nbe, &hdr.nbe, 1, MPI_INT64_T, MPI_SUM, m_comm);
+
+   // Global numbering of the vertices given by the true DOFs of a linear H1
+   // space: every rank stores the contiguous range of vertices it owns
+   H1_FECollection vert_fec(1, dim);
+   ParFiniteElementSpace vert_fes(pmesh, &vert_fec);
+   hdr.nv = vert_fes.GlobalTrueVSize();
+   const int64_t first_vert = vert_fes.GetMyTDofOffset();
+   std::vector<int64_t> vert_id(pmesh->GetNV());
+   std::vector<real_t> coords(vert_fes.GetTrueVSize()*sdim);
+   Array<int> dofs;
+   for (int i = 0; i < pmesh->GetNV(); i++)
+   {
+      vert_fes.GetVertexDofs(i, dofs);
+      vert_id[i] = vert_fes.GetGlobalTDofNumber(dofs[0]);
+      const int tdof = vert_fes.GetLocalTDofNumber(dofs[0]);
+      if (tdof >= 0)
+      {
+         std::copy_n(pmesh->GetVertex(i), sdim, &coords[tdof*sdim]);
+      }
+   }
+
+   std::vector<int64_t> elems(loc_ne*ckpt_rec_size, -1);
+   for (int i = 0; i < loc_ne; i++)
+   {
+      int64_t *rec = &elems[i*ckpt_rec_size];
+      pmesh->GetElementVertices(i, dofs);
+      rec[0] = pmesh->GetAttribute(i);
+      rec[1] = pmesh->GetElementGeometry(i);
+      for (int j = 0; j < dofs.Size(); j++) { rec[2+j] = vert_id[dofs[j]]; }
+   }
+   std::vector<int64_t> bdr_elems(loc_nbe*ckpt_rec_size, -1);
+   for (int i = 0; i < loc_nbe; i++)
+   {
+      int64_t *rec = &bdr_elems[i*ckpt_rec_size];
+      pmesh->GetBdrElementVertices(i, dofs);
+      rec[0] = pmesh->GetBdrAttribute(i);
+      rec[1] = pmesh->GetBdrElementGeometry(i);
+      for (int j = 0; j < dofs.Size(); j++) { rec[2+j] = vert_id[dofs[j]]; }
+   }
+
+   // The nodes, if any, followed by the fields
+   std::vector<const GridFunction*> gfs;
+   std::vector<CheckpointField> gf_info;
+   auto add_field = [&](const std::string &name, const GridFunction *gf)
+   {
+      const FiniteElementSpace &fes = *gf->FESpace();
+      CheckpointField f;
+      f.name = name;
+      f.fec_name = fes.FEColl()->Name();
+      f.vdim = fes.GetVDim();
+      f.ordering = fes.GetOrdering();
+      gfs.push_back(gf);
+      gf_info.push_back(f);
+   };
+   hdr.has_nodes = (pmesh->GetNodes() != NULL);
+   if (hdr.has_nodes) { add_field("nodes", pmesh->GetNodes()); }
+   for (FieldMapIterator it = field_map.begin(); it != field_map.end(); ++it)
+   {
+      MFEM_VERIFY(it->second->FESpace()->GetMesh() == mesh,
+                  "the field '" << it->first << "' is not on the mesh of the"
+                  " collection");
+      add_field(it->first, it->second);
+   }
+   auto set_header_fields = [&]()
+   {
+      if (hdr.has_nodes) { hdr.nodes = gf_info[0]; }
+      hdr.fields.assign(gf_info.begin() + hdr.has_nodes, gf_info.end());
+   };
+
+   // Number of values of the fields, which gives the size of their sections
+   std::vector<int64_t> loc_num_values(gfs.size(), 0);
+   Array<int> vdofs;
+   for (size_t k = 0; k < gfs.size(); k++)
+   {
+      const FiniteElementSpace &fes = *gfs[k]->FESpace();
+      for (int i = 0; i < fes.GetNE(); i++)
+      {
+         fes.GetElementVDofs(i, vdofs);
+         loc_num_values[k] += vdofs.Size();
+      }
+   }
+   std::vector<int64_t> first_value(gfs.size(), 0), num_values(gfs.size());
+   MPI_Exscan(loc_num_values.data(), first_value.data(), (int)gfs.size(),
+              MPI_INT64_T, MPI_SUM, m_comm);
+   if (myid == 0) { std::fill(first_value.begin(), first_value.end(), 0); }
+   MPI_Allreduce(loc_num_values.data(), num_values.data(), (int)gfs.size(),
+                 MPI_INT64_T, MPI_SUM, m_comm);
+
+   // The header size does not depend on the values of the offsets
+   set_header_fields();
+   int64_t offset = hdr.Write().size();
+   hdr.vert_offset = offset;
+   offset += hdr.nv*sdim*sizeof(real_t);
+   hdr.elem_offset = offset;
+   offset += hdr.ne*ckpt_rec_size*sizeof(int64_t);
+   hdr.bdr_offset = offset;
+   offset += hdr.nbe*ckpt_rec_size*sizeof(int64_t);
+   for (size_t k = 0; k < gfs.size(); k++)
+   {
+      gf_info[k].offset = offset;
+      offset += hdr.ne*sizeof(int64_t) + num_values[k]*sizeof(real_t);
+   }
+   set_header_fields();
+
+   if (!prefix_path.empty() && create_directory(prefix_path, mesh, myid))
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error creating directory: " << prefix_path);
+      return;
+   }
+   const std::string fname = GetCheckpointFileName();
+   MPI_File fh;
+   if (MPI_File_open(m_comm, fname.c_str(), MPI_MODE_WRONLY | MPI_MODE_CREATE,
+                     MPI_INFO_NULL, &fh) != MPI_SUCCESS)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error opening checkpoint file: " << fname);
+      return;
+   }
+
+   bool ok = (MPI_File_set_size(fh, 0) == MPI_SUCCESS);
+   if (myid == 0)
+   {
+      const std::string buf = hdr.Write();
+      ok &= MPI_File_write_at(fh, 0, buf.data(), (int)buf.size(), MPI_CHAR,
+                              MPI_STATUS_IGNORE) == MPI_SUCCESS;
+   }
+   ok &= CheckpointWriteAll(fh, hdr.vert_offset +
+                            first_vert*sdim*sizeof(real_t),
+                            coords.data(), coords.size());
+   ok &= CheckpointWriteAll(fh, hdr.elem_offset +
+                            first_elem*ckpt_rec_size*sizeof(int64_t),
+                            elems.data(), elems.size());
+   ok &= CheckpointWriteAll(fh, hdr.bdr_offset +
+                            first_bdr*ckpt_rec_size*sizeof(int64_t),
+                            bdr_elems.data(), bdr_elems.size());
+   std::vector<int64_t> offsets;
+   std::vector<real_t> values;
+   for (size_t k = 0; k < gfs.size(); k++)
+   {
+      GetElementValues(*gfs[k], first_value[k], offsets, values);
+      ok &= CheckpointWriteAll(fh, gf_info[k].offset +
+                               first_elem*sizeof(int64_t),
+                               offsets.data(), offsets.size());
+      ok &= CheckpointWriteAll(fh, gf_info[k].offset + hdr.ne*sizeof(int64_t) +
+                               first_value[k]*sizeof(real_t),
+                               values.data(), values.size());
+   }
+   MPI_File_close(&fh);
+
+   int err = !ok, glob_err;
+   MPI_Allreduce(&err, &glob_err, 1, MPI_INT, MPI_MAX, m_comm);
+   if (glob_err)
+   {
+      error = WRITE_ERROR;
+      MFEM_WARNING("Error writing checkpoint file: " << fname);
+   }
+}
+
+void CheckpointDataCollection::Load(int cycle_)
+{
+   using namespace internal;
+
+   DeleteAll();
+   error = No_Error;
+   cycle = cycle_;
+   MFEM_VERIFY(m_comm != MPI_COMM_NULL, "the MPI communicator is not set");
+
+   const std::string fname = GetCheckpointFileName();
+   MPI_File fh;
+   if (MPI_File_open(m_comm, fname.c_str(), MPI_MODE_RDONLY, MPI_INFO_NULL,
+                     &fh) != MPI_SUCCESS)
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Unable to open checkpoint file: " << fname);
+      return;
+   }
+
+   // Rank 0 reads the header and broadcasts it
+   std::string buf;
+   int64_t hdr_size = -1;
+   if (myid == 0)
+   {
+      std::vector<char> start(sizeof(ckpt_magic) + sizeof(int64_t));
+      if (CheckpointRead(fh, 0, start) &&
+          std::equal(ckpt_magic, ckpt_magic + sizeof(ckpt_magic), &start[0]))
+      {
+         hdr_size = bin_io::read<int64_t>(&start[sizeof(ckpt_magic)]);
+      }
+      if (hdr_size > 0 && hdr_size <= std::numeric_limits<int>::max())
+      {
+         std::vector<char> hdr_buf(hdr_size);
+         if (CheckpointRead(fh, 0, hdr_buf))
+         {
+            buf.assign(hdr_buf.begin(), hdr_buf.end());
+         }
+         else { hdr_size = -1; }
+      }
+      else { hdr_size = -1; }
+   }
+   MPI_Bcast(&hdr_size, 1, MPI_INT64_T, 0, m_comm);
+   CheckpointHeader hdr;
+   if (hdr_size > 0)
+   {
+      buf.resize(hdr_size);
+      MPI_Bcast(&buf[0], (int)hdr_size, MPI_CHAR, 0, m_comm);
+   }
+   if (hdr_size <= 0 || !hdr.Read(buf))
+   {
+      MPI_File_close(&fh);
+      error = READ_ERROR;
+      MFEM_WARNING("Error reading checkpoint file: " << fname);
+      return;
+   }
+   time = hdr.time;
+   time_step = hdr.time_step;
+
+   // Rank 0 builds the serial mesh and partitions it
+   const int sdim = (int)hdr.sdim;
+   std::unique_ptr<Mesh> serial_mesh;
+   Array<int> partitioning;
+   int ok = 1;
+   if (myid == 0)
+   {
+      MFEM_VERIFY(hdr.nv <= std::numeric_limits<int>::max() &&
+                  hdr.ne <= std::numeric_limits<int>::max(),
+                  "the mesh is too large to be loaded");
+      std::vector<real_t> coords(hdr.nv*sdim);
+      std::vector<int64_t> elems(hdr.ne*ckpt_rec_size);
+      std::vector<int64_t> bdr_elems(hdr.nbe*ckpt_rec_size);
+      ok = CheckpointRead(fh, hdr.vert_offset, coords) &&
+           CheckpointRead(fh, hdr.elem_offset, elems) &&
+           CheckpointRead(fh, hdr.bdr_offset, bdr_elems);
+
+      serial_mesh.reset(new Mesh((int)hdr.dim, (int)hdr.nv, (int)hdr.ne,
+                                 (int)hdr.nbe, sdim));
+      for (int64_t i = 0; i < hdr.nv; i++)
+      {
+         serial_mesh->AddVertex(&coords[i*sdim]);
+      }
+      int verts[ckpt_max_verts];
+      auto new_element = [&](const int64_t *rec)
+      {
+         Element *el = serial_mesh->NewElement((int)rec[1]);
+         for (int j = 0; j < el->GetNVertices(); j++) { verts[j] = rec[2+j]; }
+         el->SetVertices(verts);
+         el->SetAttribute((int)rec[0]);
+         return el;
+      };
+      for (int64_t i = 0; i < hdr.ne; i++)
+      {
+         serial_mesh->AddElement(new_element(&elems[i*ckpt_rec_size]));
+      }
+      for (int64_t i = 0; i < hdr.nbe; i++)
+      {
+         serial_mesh->AddBdrElement(new_element(&bdr_elems[i*ckpt_rec_size]));
+      }
+      // Keep the order of the element vertices, which the field values depend
+      // on.
+      serial_mesh->FinalizeTopology();
+      serial_mesh->Finalize(false, false);
+
+      partitioning.SetSize((int)hdr.ne);
+      const int saved_procs = (int)hdr.elem_offsets.size() - 1;
+      if (saved_procs == num_procs)
+      {
+         for (int p = 0; p < num_procs; p++)
+         {
+            for (int64_t i = hdr.elem_offsets[p]; i < hdr.elem_offsets[p+1]; i++)
+            {
+               partitioning[(int)i] = p;
+            }
+         }
+      }
+      else
+      {
+         int *part = serial_mesh->GeneratePartitioning(num_procs, part_method);
+         std::copy_n(part, partitioning.Size(), partitioning.GetData());
+         delete [] part;
+      }
+   }
+   MPI_Bcast(&ok, 1, MPI_INT, 0, m_comm);
+   if (!ok)
+   {
+      MPI_File_close(&fh);
+      error = READ_ERROR;
+      MFEM_WARNING("Error reading the mesh from checkpoint file: " << fname);
+      return;
+   }
+
+   ParMesh *pmesh = new ParMesh(ParMesh::ScatterFromRoot(
+                                   m_comm, serial_mesh.get(),
+                                   partitioning.GetData(), part_method, 0, 1,
+                                   false, false));
+   mesh = pmesh;
+   serial = false;
+   own_data = true;
+
+   // Global indices of the local elements, in the same order as in pmesh
+   Array<int> elems(pmesh->GetNE());
+   {
+      Table part_elems;
+      Array<int> counts, displs;
+      if (myid == 0)
+      {
+         Transpose(partitioning, part_elems, num_procs);
+         counts.SetSize(num_procs);
+         displs.SetSize(num_procs);
+         for (int p = 0; p < num_procs; p++)
+         {
+            counts[p] = part_elems.RowSize(p);
+            displs[p] = part_elems.GetI()[p];
+         }
+      }
+      MPI_Scatterv(part_elems.GetJ(), counts.GetData(), displs.GetData(),
+                   MPI_INT, elems.GetData(), elems.Size(), MPI_INT, 0, m_comm);
+   }
+   serial_mesh.reset();
+   partitioning.DeleteAll();
+
+   bool read_ok = true;
+   if (hdr.has_nodes)
+   {
+      ParGridFunction *nodes = ReadCheckpointField(fh, hdr.ne, hdr.nodes,
+                                                   *pmesh, elems, read_ok);
+      pmesh->NewNodes(*nodes, true);
+   }
+   for (const CheckpointField &f : hdr.fields)
+   {
+      field_map.Register(f.name, ReadCheckpointField(fh, hdr.ne, f, *pmesh,
+                                                     elems, read_ok),
+                         own_data);
+   }
+   MPI_File_close(&fh);
+
+   int err = !read_ok, glob_err;
+   MPI_Allreduce(&err, &glob_err, 1, MPI_INT, MPI_MAX, m_comm);
+   if (glob_err)
+   {
+      error = READ_ERROR;
+      MFEM_WARNING("Error reading the fields from checkpoint file: " << fname);
+      DeleteAll();
+   }
+}
+
+#endif // MFEM_USE_MPI
+
 ParaViewDataCollectionBase::ParaViewDataCollectionBase(
    const std::string &name, Mesh *mesh) : DataCollection(name, mesh)
 {
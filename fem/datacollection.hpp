@@ -508,6 +508,56 @@ public:
    virtual ~VisItDataCollection() {}
 };
 
+#ifdef MFEM_USE_MPI
+/** @brief Data collection saving a ParMesh and its ParGridFunction%s to a
+    single binary file with MPI-IO, which can be loaded on a different number
+    of MPI ranks. */
+/** The file "<prefix_path><name>_<cycle>.mfem_ckpt" is written collectively by
+    all ranks. It contains a header with an index of its sections, followed by
+    the mesh, stored with a global numbering of its elements and vertices, and
+    by the fields, stored element by element together with an offset index.
+
+    Load() reads the mesh on rank 0 only, partitions it (with the saved
+    partitioning when the number of ranks is the same, or else with
+    Mesh::GeneratePartitioning() using the method set with
+    SetPartitioningMethod()) and sends every rank its part with
+    ParMesh::ScatterFromRoot(). The local field values are then read by all
+    ranks in parallel. Rank 0 therefore needs the memory of the global mesh
+    when loading, while the other ranks only hold their part.
+
+    Only conforming meshes and fields with a fixed order are supported; the
+    q-fields of the collection are not saved. The file uses the native byte
+    order and the size of real_t of the machine that wrote it. */
+class CheckpointDataCollection : public DataCollection
+{
+protected:
+   /// Partitioning method used by Load() on a different number of ranks.
+   int part_method;
+
+   std::string GetCheckpointFileName() const;
+
+public:
+   /// Constructor. The collection name is used when saving the data.
+   /** The mesh, set here or with SetMesh(), must be a ParMesh when saving. If
+       @a mesh_ is NULL, the collection can be loaded with Load(). */
+   CheckpointDataCollection(MPI_Comm comm, const std::string &collection_name,
+                            Mesh *mesh_ = NULL);
+
+   /** @brief Set the method passed to Mesh::GeneratePartitioning() when the
+       collection is loaded on a number of ranks different from the one that
+       saved it. The default is 1. */
+   void SetPartitioningMethod(int part_method_) { part_method = part_method_; }
+
+   /// Save the mesh and the fields to the checkpoint file (collective).
+   void Save() override;
+
+   /// Load the mesh and the fields from the checkpoint file (collective).
+   /** The mesh is rebuilt on rank 0 and scattered from there, see the class
+       description. */
+   void Load(int cycle_ = 0) override;
+};
+#endif
+
 
 /// Abstract base class for ParaViewDataCollection and ParaViewHDFDataCollection
 class ParaViewDataCollectionBase : public DataCollection
@@ -33,6 +33,7 @@ DGMassInverse::DGMassInverse(const FiniteElementSpace &fes_orig,
 
    MFEM_VERIFY(fes.IsDGSpace(), "Space must be DG.");
    MFEM_VERIFY(!fes.IsVariableOrder(), "Variable orders not supported.");
+   MFEM_VERIFY(UsesTensorBasis(fes), "Only tensor-product elements supported.");
 
    const int btype_orig =
       static_cast<const L2_FECollection*>(fes_orig.FEColl())->GetBasisType();
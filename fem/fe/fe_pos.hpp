@@ -199,6 +199,9 @@ public:
    static void CalcDShape(const int p, const real_t x, const real_t y,
                           real_t *dshape_1d, real_t *dshape);
 
+   /// Map from the ordering of the static CalcShape() to the native DOFs.
+   const Array<int> &GetDofMap() const { return dof_map; }
+
    void CalcShape(const IntegrationPoint &ip, Vector &shape) const override;
    void CalcDShape(const IntegrationPoint &ip,
                    DenseMatrix &dshape) const override;
@@ -228,6 +231,9 @@ public:
    static void CalcDShape(const int p, const real_t x, const real_t y,
                           const real_t z, real_t *dshape_1d, real_t *dshape);
 
+   /// Map from the ordering of the static CalcShape() to the native DOFs.
+   const Array<int> &GetDofMap() const { return dof_map; }
+
    void CalcShape(const IntegrationPoint &ip, Vector &shape) const override;
    void CalcDShape(const IntegrationPoint &ip,
                    DenseMatrix &dshape) const override;
@@ -464,6 +464,110 @@ void FiniteElementSpace::BuildFaceToDofTable() const
    face_dof = fc_dof;
 }
 
+const Table &FiniteElementSpace::GetVDofToVDofTable(bool face_coupling) const
+{
+   std::unique_ptr<Table> &vdof_vdof_ =
+      face_coupling ? vdof_vdof_faces : vdof_vdof;
+   if (vdof_vdof_) { return *vdof_vdof_; }
+
+   // The element-to-vdof table, with the signs of the vdofs removed
+   const int ne = mesh->GetNE();
+   Table el_vdof;
+   Array<int> vdofs;
+   el_vdof.MakeI(ne);
+   for (int i = 0; i < ne; i++)
+   {
+      GetElementVDofs(i, vdofs);
+      el_vdof.AddColumnsInRow(i, vdofs.Size());
+   }
+   el_vdof.MakeJ();
+   for (int i = 0; i < ne; i++)
+   {
+      GetElementVDofs(i, vdofs);
+      for (int &vdof : vdofs) { vdof = DecodeDof(vdof); }
+      el_vdof.AddConnections(i, (int *)vdofs, vdofs.Size());
+   }
+   el_vdof.ShiftUpI();
+
+   Table *vdof_vdof_new = new Table;
+   if (face_coupling)
+   {
+      // the sparsity pattern is defined from the map: face->element->vdof
+      Table face_vdof, vdof_face;
+      {
+         Table *face_el = mesh->GetFaceToElementTable();
+         mfem::Mult(*face_el, el_vdof, face_vdof);
+         delete face_el;
+      }
+      Transpose(face_vdof, vdof_face, GetVSize());
+      mfem::Mult(vdof_face, face_vdof, *vdof_vdof_new);
+   }
+   else
+   {
+      // the sparsity pattern is defined from the map: element->vdof
+      Table vdof_el;
+      Transpose(el_vdof, vdof_el, GetVSize());
+      mfem::Mult(vdof_el, el_vdof, *vdof_vdof_new);
+   }
+   vdof_vdof_new->SortRows();
+   vdof_vdof_.reset(vdof_vdof_new);
+
+   return *vdof_vdof_;
+}
+
+const Table &FiniteElementSpace::GetElementColoring() const
+{
+   if (elem_colors) { return *elem_colors; }
+
+   BuildElementToDofTable();
+   const int ne = mesh->GetNE();
+   Table dof_el;
+   {
+      Table el_dof(*elem_dof);
+      int *J = el_dof.GetJ();
+      for (int k = 0; k < el_dof.Size_of_connections(); k++)
+      {
+         J[k] = DecodeDof(J[k]);
+      }
+      Transpose(el_dof, dof_el, ndofs);
+   }
+
+   // Greedy coloring: assign to each element the smallest color not used by
+   // any of the previously colored elements sharing a dof with it.
+   Array<int> el_color(ne), color_marker;
+   el_color = -1;
+   int num_colors = 0;
+   for (int i = 0; i < ne; i++)
+   {
+      const int *dofs = elem_dof->GetRow(i);
+      const int nd = elem_dof->RowSize(i);
+      for (int j = 0; j < nd; j++)
+      {
+         const int dof = DecodeDof(dofs[j]);
+         const int *els = dof_el.GetRow(dof);
+         const int nel = dof_el.RowSize(dof);
+         for (int k = 0; k < nel; k++)
+         {
+            const int c = el_color[els[k]];
+            if (c >= 0) { color_marker[c] = i; }
+         }
+      }
+      int c = 0;
+      while (c < num_colors && color_marker[c] == i) { c++; }
+      if (c == num_colors)
+      {
+         color_marker.Append(-1);
+         num_colors++;
+      }
+      el_color[i] = c;
+   }
+
+   elem_colors.reset(new Table);
+   Transpose(el_color, *elem_colors, num_colors);
+
+   return *elem_colors;
+}
+
 void FiniteElementSpace::RebuildElementToDofTable()
 {
    delete elem_dof;
@@ -491,6 +595,9 @@ void FiniteElementSpace::ReorderElementToDofTable()
       }
       J[k] = (sdof < 0) ? -1-new_dof : new_dof; // preserve the sign of sdof
    }
+   vdof_vdof.reset();
+   vdof_vdof_faces.reset();
+   elem_colors.reset();
 }
 
 void FiniteElementSpace::BuildDofToArrays_() const
@@ -1923,6 +2030,19 @@ void FiniteElementSpace::RefinementOperator::Mult(const Vector &x,
    IsoparametricTransformation isotr;
    DofTransformation doftrans;
 
+#ifdef MFEM_USE_LEGACY_OPENMP
+   bool has_doftrans = false;
+   for (int g = 0; g < old_DoFTransArray.Size(); g++)
+   {
+      if (old_DoFTransArray[g]) { has_doftrans = true; }
+   }
+   if (!fespace->IsVariableOrder() && !has_doftrans)
+   {
+      MultThreaded(x, y);
+      return;
+   }
+#endif
+
    for (int k = 0; k < mesh_ref->GetNE(); k++)
    {
       const Embedding &emb = trans_ref.embeddings[k];
@@ -1984,6 +2104,84 @@ void FiniteElementSpace::RefinementOperator::Mult(const Vector &x,
    }
 }
 
+#ifdef MFEM_USE_LEGACY_OPENMP
+void FiniteElementSpace::RefinementOperator::MultThreaded(const Vector &x,
+                                                          Vector &y) const
+{
+   Mesh* mesh_ref = fespace->GetMesh();
+   const CoarseFineTransformations &trans_ref =
+      mesh_ref->GetRefinementTransforms();
+   const int NE = mesh_ref->GetNE();
+   const int rvdim = fespace->GetVDim();
+   const int old_ndofs = width / rvdim;
+
+   // A dof shared by several fine elements is set by the last one of them, as
+   // in the sequential Mult(), so that the result is the same.
+   Array<int> owner(fespace->GetNDofs());
+   {
+      Array<int> dofs;
+      DofTransformation doftrans;
+      for (int k = 0; k < NE; k++)
+      {
+         fespace->GetElementDofs(k, dofs, doftrans);
+         for (int i = 0; i < dofs.Size(); i++)
+         {
+            owner[dofs[i] >= 0 ? dofs[i] : -1-dofs[i]] = k;
+         }
+      }
+   }
+
+   // DenseTensor::operator() is not thread-safe, use the raw data instead
+   const real_t *lP_data[Geometry::NumGeom];
+   for (int g = 0; g < Geometry::NumGeom; g++)
+   {
+      lP_data[g] = localP[g].SizeK() ? localP[g].HostRead() : nullptr;
+   }
+
+   const real_t *xd = x.HostRead();
+   real_t *yd = y.HostReadWrite();
+
+   #pragma omp parallel
+   {
+      Array<int> dofs, old_dofs;
+      DofTransformation doftrans;
+      Vector subX, subY;
+
+      #pragma omp for
+      for (int k = 0; k < NE; k++)
+      {
+         const Embedding &emb = trans_ref.embeddings[k];
+         const Geometry::Type geom = mesh_ref->GetElementBaseGeometry(k);
+         const int h = localP[geom].SizeI(), w = localP[geom].SizeJ();
+         const DenseMatrix lP(const_cast<real_t*>(lP_data[geom]) +
+                              emb.matrix*h*w, h, w);
+
+         fespace->GetElementDofs(k, dofs, doftrans);
+         old_elem_dof->GetRow(emb.parent, old_dofs);
+         subX.SetSize(w);
+         subY.SetSize(h);
+
+         for (int vd = 0; vd < rvdim; vd++)
+         {
+            for (int i = 0; i < w; i++)
+            {
+               const int d = old_dofs[i], ad = d >= 0 ? d : -1-d;
+               const real_t xi = xd[fespace->DofToVDof(ad, vd, old_ndofs)];
+               subX(i) = d >= 0 ? xi : -xi;
+            }
+            lP.Mult(subX.GetData(), subY.GetData());
+            for (int i = 0; i < h; i++)
+            {
+               const int d = dofs[i], ad = d >= 0 ? d : -1-d;
+               if (owner[ad] != k) { continue; }
+               yd[fespace->DofToVDof(ad, vd)] = d >= 0 ? subY(i) : -subY(i);
+            }
+         }
+      }
+   }
+}
+#endif
+
 void FiniteElementSpace::RefinementOperator::MultTranspose(const Vector &x,
                                                            Vector &y) const
 {
@@ -3991,6 +4189,9 @@ void FiniteElementSpace::Destroy()
    dof_ldof_array.DeleteAll();
    dof_bdr_elem_array.DeleteAll();
    dof_bdr_ldof_array.DeleteAll();
+   vdof_vdof.reset();
+   vdof_vdof_faces.reset();
+   elem_colors.reset();
 
    for (int i = 0; i < VNURBSext.Size(); i++)
    {
@@ -281,6 +281,11 @@ protected:
    mutable Array<int> dof_bdr_elem_array;
    mutable Array<int> dof_bdr_ldof_array;
 
+   /// Cached vdof-to-vdof sparsity patterns, see GetVDofToVDofTable().
+   mutable std::unique_ptr<Table> vdof_vdof, vdof_vdof_faces;
+   /// Cached element coloring, see GetElementColoring().
+   mutable std::unique_ptr<Table> elem_colors;
+
    NURBSExtension *NURBSext;
    /** array of NURBS extension for H(div) and H(curl) vector elements.
        For each direction an extension is created from the base NURBSext,
@@ -505,6 +510,11 @@ protected:
 
       void ConstructDoFTransArray();
 
+#ifdef MFEM_USE_LEGACY_OPENMP
+      /// Thread-parallel Mult() for spaces without DoF transformations.
+      void MultThreaded(const Vector &x, Vector &y) const;
+#endif
+
    public:
       /** Construct the operator based on the elem_dof table of the original
           (coarse) space. The class takes ownership of the table. */
@@ -1293,6 +1303,24 @@ public:
    const Table &GetFaceToDofTable() const
    { if (!face_dof) { BuildFaceToDofTable(); } return *face_dof; }
 
+   /** @brief Return a reference to an internal Table that stores, for each
+       vdof, the sorted list of all vdofs coupled to it through the mesh
+       elements, i.e. the sparsity pattern of a matrix assembled from dense
+       element matrices. */
+   /** If @a face_coupling is true, the couplings through the mesh faces (as
+       introduced e.g. by interior face integrators) are included as well. The
+       Table is computed on first use and cached until the space is updated, so
+       that it can be shared by all matrices assembled on this space. */
+   const Table &GetVDofToVDofTable(bool face_coupling = false) const;
+
+   /** @brief Return a reference to an internal Table that stores, for each
+       color, the list of mesh elements with that color. */
+   /** Elements with the same color do not share any dofs, so their element
+       matrices or vectors can be assembled concurrently into global objects
+       without race conditions. The coloring is computed greedily on first use
+       and cached until the space is updated. */
+   const Table &GetElementColoring() const;
+
    /// Deprecated. This function is not required to be called by the user.
    MFEM_DEPRECATED void BuildDofToArrays() const { BuildDofToArrays_(); }
 
@@ -246,7 +246,13 @@ void DiffusionIntegrator::AssembleEA(const FiniteElementSpace &fes,
                                      Vector &ea_data,
                                      const bool add)
 {
+   // The EA kernels read the real_t quadrature data
+   const bool mixed_precision = pa_mixed_precision;
+   pa_mixed_precision = false;
    AssemblePA(fes);
+   pa_mixed_precision = mixed_precision;
+   MFEM_VERIFY(!simplex_maps.IsSetup(),
+               "Element assembly is not supported on simplices");
    ne = fes.GetMesh()->GetNE();
    const Array<real_t> &B = maps->B;
    const Array<real_t> &G = maps->G;
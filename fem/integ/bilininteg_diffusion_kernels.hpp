@@ -509,137 +509,164 @@ void OccaPADiffusionApply3D(const int D1D,
                             Vector &Y);
 #endif // MFEM_USE_OCCA
 
-// PA Diffusion Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
-inline void PADiffusionApply2D(const int NE,
-                               const bool symmetric,
-                               const Array<real_t> &b_,
-                               const Array<real_t> &g_,
-                               const Array<real_t> &bt_,
-                               const Array<real_t> &gt_,
-                               const Vector &d_,
-                               const Vector &x_,
-                               Vector &y_,
-                               const int d1d = 0,
-                               const int q1d = 0)
+// PA Diffusion Apply 2D kernel for a single element
+template<int T_D1D = 0, int T_Q1D = 0, typename DT = real_t>
+MFEM_HOST_DEVICE inline
+void PADiffusionApply2D_Element(const int e,
+                                const int NE,
+                                const bool symmetric,
+                                const real_t *b_,
+                                const real_t *g_,
+                                const real_t *bt_,
+                                const real_t *gt_,
+                                const DT *d_,
+                                const real_t *x_,
+                                real_t *y_,
+                                const int d1d = 0,
+                                const int q1d = 0)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
-   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
-   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
-   auto B = Reshape(b_.Read(), Q1D, D1D);
-   auto G = Reshape(g_.Read(), Q1D, D1D);
-   auto Bt = Reshape(bt_.Read(), D1D, Q1D);
-   auto Gt = Reshape(gt_.Read(), D1D, Q1D);
-   auto D = Reshape(d_.Read(), Q1D*Q1D, symmetric ? 3 : 4, NE);
-   auto X = Reshape(x_.Read(), D1D, D1D, NE);
-   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
-   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
-   {
-      const int D1D = T_D1D ? T_D1D : d1d;
-      const int Q1D = T_Q1D ? T_Q1D : q1d;
-      // the following variables are evaluated at compile time
-      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
-      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+   // the following variables are evaluated at compile time
+   constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+   constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+   auto B = ConstDeviceMatrix(b_, Q1D, D1D);
+   auto G = ConstDeviceMatrix(g_, Q1D, D1D);
+   auto Bt = ConstDeviceMatrix(bt_, D1D, Q1D);
+   auto Gt = ConstDeviceMatrix(gt_, D1D, Q1D);
+   auto D = DeviceTensor<3,const DT>(d_, Q1D*Q1D, symmetric ? 3 : 4, NE);
+   auto X = ConstDeviceCube(x_, D1D, D1D, NE);
+   auto Y = DeviceCube(y_, D1D, D1D, NE);
 
-      real_t grad[max_Q1D][max_Q1D][2];
-      for (int qy = 0; qy < Q1D; ++qy)
+   real_t grad[max_Q1D][max_Q1D][2];
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      for (int qx = 0; qx < Q1D; ++qx)
       {
-         for (int qx = 0; qx < Q1D; ++qx)
-         {
-            grad[qy][qx][0] = 0.0;
-            grad[qy][qx][1] = 0.0;
-         }
+         grad[qy][qx][0] = 0.0;
+         grad[qy][qx][1] = 0.0;
       }
-      for (int dy = 0; dy < D1D; ++dy)
+   }
+   for (int dy = 0; dy < D1D; ++dy)
+   {
+      real_t gradX[max_Q1D][2];
+      for (int qx = 0; qx < Q1D; ++qx)
       {
-         real_t gradX[max_Q1D][2];
+         gradX[qx][0] = 0.0;
+         gradX[qx][1] = 0.0;
+      }
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         const real_t s = X(dx,dy,e);
          for (int qx = 0; qx < Q1D; ++qx)
          {
-            gradX[qx][0] = 0.0;
-            gradX[qx][1] = 0.0;
-         }
-         for (int dx = 0; dx < D1D; ++dx)
-         {
-            const real_t s = X(dx,dy,e);
-            for (int qx = 0; qx < Q1D; ++qx)
-            {
-               gradX[qx][0] += s * B(qx,dx);
-               gradX[qx][1] += s * G(qx,dx);
-            }
-         }
-         for (int qy = 0; qy < Q1D; ++qy)
-         {
-            const real_t wy  = B(qy,dy);
-            const real_t wDy = G(qy,dy);
-            for (int qx = 0; qx < Q1D; ++qx)
-            {
-               grad[qy][qx][0] += gradX[qx][1] * wy;
-               grad[qy][qx][1] += gradX[qx][0] * wDy;
-            }
+            gradX[qx][0] += s * B(qx,dx);
+            gradX[qx][1] += s * G(qx,dx);
          }
       }
-      // Calculate Dxy, xDy in plane
       for (int qy = 0; qy < Q1D; ++qy)
       {
+         const real_t wy  = B(qy,dy);
+         const real_t wDy = G(qy,dy);
          for (int qx = 0; qx < Q1D; ++qx)
          {
-            const int q = qx + qy * Q1D;
+            grad[qy][qx][0] += gradX[qx][1] * wy;
+            grad[qy][qx][1] += gradX[qx][0] * wDy;
+         }
+      }
+   }
+   // Calculate Dxy, xDy in plane
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      for (int qx = 0; qx < Q1D; ++qx)
+      {
+         const int q = qx + qy * Q1D;
 
-            const real_t O11 = D(q,0,e);
-            const real_t O21 = D(q,1,e);
-            const real_t O12 = symmetric ? O21 : D(q,2,e);
-            const real_t O22 = symmetric ? D(q,2,e) : D(q,3,e);
+         const real_t O11 = D(q,0,e);
+         const real_t O21 = D(q,1,e);
+         const real_t O12 = symmetric ? O21 : D(q,2,e);
+         const real_t O22 = symmetric ? D(q,2,e) : D(q,3,e);
 
-            const real_t gradX = grad[qy][qx][0];
-            const real_t gradY = grad[qy][qx][1];
+         const real_t gradX = grad[qy][qx][0];
+         const real_t gradY = grad[qy][qx][1];
 
-            grad[qy][qx][0] = (O11 * gradX) + (O12 * gradY);
-            grad[qy][qx][1] = (O21 * gradX) + (O22 * gradY);
-         }
+         grad[qy][qx][0] = (O11 * gradX) + (O12 * gradY);
+         grad[qy][qx][1] = (O21 * gradX) + (O22 * gradY);
       }
-      for (int qy = 0; qy < Q1D; ++qy)
+   }
+   for (int qy = 0; qy < Q1D; ++qy)
+   {
+      real_t gradX[max_D1D][2];
+      for (int dx = 0; dx < D1D; ++dx)
+      {
+         gradX[dx][0] = 0;
+         gradX[dx][1] = 0;
+      }
+      for (int qx = 0; qx < Q1D; ++qx)
       {
-         real_t gradX[max_D1D][2];
+         const real_t gX = grad[qy][qx][0];
+         const real_t gY = grad[qy][qx][1];
          for (int dx = 0; dx < D1D; ++dx)
          {
-            gradX[dx][0] = 0;
-            gradX[dx][1] = 0;
+            const real_t wx  = Bt(dx,qx);
+            const real_t wDx = Gt(dx,qx);
+            gradX[dx][0] += gX * wDx;
+            gradX[dx][1] += gY * wx;
          }
-         for (int qx = 0; qx < Q1D; ++qx)
-         {
-            const real_t gX = grad[qy][qx][0];
-            const real_t gY = grad[qy][qx][1];
-            for (int dx = 0; dx < D1D; ++dx)
-            {
-               const real_t wx  = Bt(dx,qx);
-               const real_t wDx = Gt(dx,qx);
-               gradX[dx][0] += gX * wDx;
-               gradX[dx][1] += gY * wx;
-            }
-         }
-         for (int dy = 0; dy < D1D; ++dy)
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         const real_t wy  = Bt(dy,qy);
+         const real_t wDy = Gt(dy,qy);
+         for (int dx = 0; dx < D1D; ++dx)
          {
-            const real_t wy  = Bt(dy,qy);
-            const real_t wDy = Gt(dy,qy);
-            for (int dx = 0; dx < D1D; ++dx)
-            {
-               Y(dx,dy,e) += ((gradX[dx][0] * wy) + (gradX[dx][1] * wDy));
-            }
+            Y(dx,dy,e) += ((gradX[dx][0] * wy) + (gradX[dx][1] * wDy));
          }
       }
+   }
+}
+
+// PA Diffusion Apply 2D kernel
+template<int T_D1D = 0, int T_Q1D = 0, typename DataVector = Vector>
+inline void PADiffusionApply2D(const int NE,
+                               const bool symmetric,
+                               const Array<real_t> &b_,
+                               const Array<real_t> &g_,
+                               const Array<real_t> &bt_,
+                               const Array<real_t> &gt_,
+                               const DataVector &d_,
+                               const Vector &x_,
+                               Vector &y_,
+                               const int d1d = 0,
+                               const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = b_.Read();
+   const auto G = g_.Read();
+   const auto Bt = bt_.Read();
+   const auto Gt = gt_.Read();
+   const auto D = d_.Read();
+   const auto X = x_.Read();
+   auto Y = y_.ReadWrite();
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      PADiffusionApply2D_Element<T_D1D,T_Q1D>(e, NE, symmetric, B, G, Bt, Gt,
+                                              D, X, Y, d1d, q1d);
    });
 }
 
 // Shared memory PA Diffusion Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, typename DataVector = Vector>
 inline void SmemPADiffusionApply2D(const int NE,
                                    const bool symmetric,
                                    const Array<real_t> &b_,
                                    const Array<real_t> &g_,
                                    const Array<real_t> &bt_,
                                    const Array<real_t> &gt_,
-                                   const Vector &d_,
+                                   const DataVector &d_,
                                    const Vector &x_,
                                    Vector &y_,
                                    const int d1d = 0,
@@ -791,208 +818,314 @@ inline void SmemPADiffusionApply2D(const int NE,
    });
 }
 
-// PA Diffusion Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
-inline void PADiffusionApply3D(const int NE,
-                               const bool symmetric,
-                               const Array<real_t> &b,
-                               const Array<real_t> &g,
-                               const Array<real_t> &bt,
-                               const Array<real_t> &gt,
-                               const Vector &d_,
-                               const Vector &x_,
-                               Vector &y_,
-                               int d1d = 0, int q1d = 0)
+// PA Diffusion Apply 3D kernel for a single element
+template<int T_D1D = 0, int T_Q1D = 0, typename DT = real_t>
+MFEM_HOST_DEVICE inline
+void PADiffusionApply3D_Element(const int e,
+                                const int NE,
+                                const bool symmetric,
+                                const real_t *b_,
+                                const real_t *g_,
+                                const real_t *bt_,
+                                const real_t *gt_,
+                                const DT *d_,
+                                const real_t *x_,
+                                real_t *y_,
+                                const int d1d = 0,
+                                const int q1d = 0)
 {
    const int D1D = T_D1D ? T_D1D : d1d;
    const int Q1D = T_Q1D ? T_Q1D : q1d;
-   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
-   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
-   auto B = Reshape(b.Read(), Q1D, D1D);
-   auto G = Reshape(g.Read(), Q1D, D1D);
-   auto Bt = Reshape(bt.Read(), D1D, Q1D);
-   auto Gt = Reshape(gt.Read(), D1D, Q1D);
-   auto D = Reshape(d_.Read(), Q1D*Q1D*Q1D, symmetric ? 6 : 9, NE);
-   auto X = Reshape(x_.Read(), D1D, D1D, D1D, NE);
-   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
-   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+   constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+   auto B = ConstDeviceMatrix(b_, Q1D, D1D);
+   auto G = ConstDeviceMatrix(g_, Q1D, D1D);
+   auto Bt = ConstDeviceMatrix(bt_, D1D, Q1D);
+   auto Gt = ConstDeviceMatrix(gt_, D1D, Q1D);
+   auto D = DeviceTensor<3,const DT>(d_, Q1D*Q1D*Q1D, symmetric ? 6 : 9, NE);
+   auto X = DeviceTensor<4,const real_t>(x_, D1D, D1D, D1D, NE);
+   auto Y = DeviceTensor<4,real_t>(y_, D1D, D1D, D1D, NE);
+
+   real_t grad[max_Q1D][max_Q1D][max_Q1D][3];
+   for (int qz = 0; qz < Q1D; ++qz)
    {
-      const int D1D = T_D1D ? T_D1D : d1d;
-      const int Q1D = T_Q1D ? T_Q1D : q1d;
-      constexpr int max_D1D = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
-      constexpr int max_Q1D = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
-      real_t grad[max_Q1D][max_Q1D][max_Q1D][3];
-      for (int qz = 0; qz < Q1D; ++qz)
+      for (int qy = 0; qy < Q1D; ++qy)
       {
-         for (int qy = 0; qy < Q1D; ++qy)
+         for (int qx = 0; qx < Q1D; ++qx)
          {
-            for (int qx = 0; qx < Q1D; ++qx)
-            {
-               grad[qz][qy][qx][0] = 0.0;
-               grad[qz][qy][qx][1] = 0.0;
-               grad[qz][qy][qx][2] = 0.0;
-            }
+            grad[qz][qy][qx][0] = 0.0;
+            grad[qz][qy][qx][1] = 0.0;
+            grad[qz][qy][qx][2] = 0.0;
          }
       }
-      for (int dz = 0; dz < D1D; ++dz)
+   }
+   for (int dz = 0; dz < D1D; ++dz)
+   {
+      real_t gradXY[max_Q1D][max_Q1D][3];
+      for (int qy = 0; qy < Q1D; ++qy)
       {
-         real_t gradXY[max_Q1D][max_Q1D][3];
-         for (int qy = 0; qy < Q1D; ++qy)
+         for (int qx = 0; qx < Q1D; ++qx)
          {
-            for (int qx = 0; qx < Q1D; ++qx)
-            {
-               gradXY[qy][qx][0] = 0.0;
-               gradXY[qy][qx][1] = 0.0;
-               gradXY[qy][qx][2] = 0.0;
-            }
+            gradXY[qy][qx][0] = 0.0;
+            gradXY[qy][qx][1] = 0.0;
+            gradXY[qy][qx][2] = 0.0;
          }
-         for (int dy = 0; dy < D1D; ++dy)
+      }
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         real_t gradX[max_Q1D][2];
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            gradX[qx][0] = 0.0;
+            gradX[qx][1] = 0.0;
+         }
+         for (int dx = 0; dx < D1D; ++dx)
          {
-            real_t gradX[max_Q1D][2];
+            const real_t s = X(dx,dy,dz,e);
             for (int qx = 0; qx < Q1D; ++qx)
             {
-               gradX[qx][0] = 0.0;
-               gradX[qx][1] = 0.0;
-            }
-            for (int dx = 0; dx < D1D; ++dx)
-            {
-               const real_t s = X(dx,dy,dz,e);
-               for (int qx = 0; qx < Q1D; ++qx)
-               {
-                  gradX[qx][0] += s * B(qx,dx);
-                  gradX[qx][1] += s * G(qx,dx);
-               }
-            }
-            for (int qy = 0; qy < Q1D; ++qy)
-            {
-               const real_t wy  = B(qy,dy);
-               const real_t wDy = G(qy,dy);
-               for (int qx = 0; qx < Q1D; ++qx)
-               {
-                  const real_t wx  = gradX[qx][0];
-                  const real_t wDx = gradX[qx][1];
-                  gradXY[qy][qx][0] += wDx * wy;
-                  gradXY[qy][qx][1] += wx  * wDy;
-                  gradXY[qy][qx][2] += wx  * wy;
-               }
+               gradX[qx][0] += s * B(qx,dx);
+               gradX[qx][1] += s * G(qx,dx);
             }
          }
-         for (int qz = 0; qz < Q1D; ++qz)
+         for (int qy = 0; qy < Q1D; ++qy)
          {
-            const real_t wz  = B(qz,dz);
-            const real_t wDz = G(qz,dz);
-            for (int qy = 0; qy < Q1D; ++qy)
+            const real_t wy  = B(qy,dy);
+            const real_t wDy = G(qy,dy);
+            for (int qx = 0; qx < Q1D; ++qx)
             {
-               for (int qx = 0; qx < Q1D; ++qx)
-               {
-                  grad[qz][qy][qx][0] += gradXY[qy][qx][0] * wz;
-                  grad[qz][qy][qx][1] += gradXY[qy][qx][1] * wz;
-                  grad[qz][qy][qx][2] += gradXY[qy][qx][2] * wDz;
-               }
+               const real_t wx  = gradX[qx][0];
+               const real_t wDx = gradX[qx][1];
+               gradXY[qy][qx][0] += wDx * wy;
+               gradXY[qy][qx][1] += wx  * wDy;
+               gradXY[qy][qx][2] += wx  * wy;
             }
          }
       }
-      // Calculate Dxyz, xDyz, xyDz in plane
       for (int qz = 0; qz < Q1D; ++qz)
       {
+         const real_t wz  = B(qz,dz);
+         const real_t wDz = G(qz,dz);
          for (int qy = 0; qy < Q1D; ++qy)
          {
             for (int qx = 0; qx < Q1D; ++qx)
             {
-               const int q = qx + (qy + qz * Q1D) * Q1D;
-               const real_t O11 = D(q,0,e);
-               const real_t O12 = D(q,1,e);
-               const real_t O13 = D(q,2,e);
-               const real_t O21 = symmetric ? O12 : D(q,3,e);
-               const real_t O22 = symmetric ? D(q,3,e) : D(q,4,e);
-               const real_t O23 = symmetric ? D(q,4,e) : D(q,5,e);
-               const real_t O31 = symmetric ? O13 : D(q,6,e);
-               const real_t O32 = symmetric ? O23 : D(q,7,e);
-               const real_t O33 = symmetric ? D(q,5,e) : D(q,8,e);
-               const real_t gradX = grad[qz][qy][qx][0];
-               const real_t gradY = grad[qz][qy][qx][1];
-               const real_t gradZ = grad[qz][qy][qx][2];
-               grad[qz][qy][qx][0] = (O11*gradX)+(O12*gradY)+(O13*gradZ);
-               grad[qz][qy][qx][1] = (O21*gradX)+(O22*gradY)+(O23*gradZ);
-               grad[qz][qy][qx][2] = (O31*gradX)+(O32*gradY)+(O33*gradZ);
+               grad[qz][qy][qx][0] += gradXY[qy][qx][0] * wz;
+               grad[qz][qy][qx][1] += gradXY[qy][qx][1] * wz;
+               grad[qz][qy][qx][2] += gradXY[qy][qx][2] * wDz;
             }
          }
       }
-      for (int qz = 0; qz < Q1D; ++qz)
+   }
+   // Calculate Dxyz, xDyz, xyDz in plane
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      for (int qy = 0; qy < Q1D; ++qy)
       {
-         real_t gradXY[max_D1D][max_D1D][3];
-         for (int dy = 0; dy < D1D; ++dy)
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const int q = qx + (qy + qz * Q1D) * Q1D;
+            const real_t O11 = D(q,0,e);
+            const real_t O12 = D(q,1,e);
+            const real_t O13 = D(q,2,e);
+            const real_t O21 = symmetric ? O12 : D(q,3,e);
+            const real_t O22 = symmetric ? D(q,3,e) : D(q,4,e);
+            const real_t O23 = symmetric ? D(q,4,e) : D(q,5,e);
+            const real_t O31 = symmetric ? O13 : D(q,6,e);
+            const real_t O32 = symmetric ? O23 : D(q,7,e);
+            const real_t O33 = symmetric ? D(q,5,e) : D(q,8,e);
+            const real_t gradX = grad[qz][qy][qx][0];
+            const real_t gradY = grad[qz][qy][qx][1];
+            const real_t gradZ = grad[qz][qy][qx][2];
+            grad[qz][qy][qx][0] = (O11*gradX)+(O12*gradY)+(O13*gradZ);
+            grad[qz][qy][qx][1] = (O21*gradX)+(O22*gradY)+(O23*gradZ);
+            grad[qz][qy][qx][2] = (O31*gradX)+(O32*gradY)+(O33*gradZ);
+         }
+      }
+   }
+   for (int qz = 0; qz < Q1D; ++qz)
+   {
+      real_t gradXY[max_D1D][max_D1D][3];
+      for (int dy = 0; dy < D1D; ++dy)
+      {
+         for (int dx = 0; dx < D1D; ++dx)
          {
+            gradXY[dy][dx][0] = 0;
+            gradXY[dy][dx][1] = 0;
+            gradXY[dy][dx][2] = 0;
+         }
+      }
+      for (int qy = 0; qy < Q1D; ++qy)
+      {
+         real_t gradX[max_D1D][3];
+         for (int dx = 0; dx < D1D; ++dx)
+         {
+            gradX[dx][0] = 0;
+            gradX[dx][1] = 0;
+            gradX[dx][2] = 0;
+         }
+         for (int qx = 0; qx < Q1D; ++qx)
+         {
+            const real_t gX = grad[qz][qy][qx][0];
+            const real_t gY = grad[qz][qy][qx][1];
+            const real_t gZ = grad[qz][qy][qx][2];
             for (int dx = 0; dx < D1D; ++dx)
             {
-               gradXY[dy][dx][0] = 0;
-               gradXY[dy][dx][1] = 0;
-               gradXY[dy][dx][2] = 0;
+               const real_t wx  = Bt(dx,qx);
+               const real_t wDx = Gt(dx,qx);
+               gradX[dx][0] += gX * wDx;
+               gradX[dx][1] += gY * wx;
+               gradX[dx][2] += gZ * wx;
             }
          }
-         for (int qy = 0; qy < Q1D; ++qy)
+         for (int dy = 0; dy < D1D; ++dy)
          {
-            real_t gradX[max_D1D][3];
+            const real_t wy  = Bt(dy,qy);
+            const real_t wDy = Gt(dy,qy);
             for (int dx = 0; dx < D1D; ++dx)
             {
-               gradX[dx][0] = 0;
-               gradX[dx][1] = 0;
-               gradX[dx][2] = 0;
-            }
-            for (int qx = 0; qx < Q1D; ++qx)
-            {
-               const real_t gX = grad[qz][qy][qx][0];
-               const real_t gY = grad[qz][qy][qx][1];
-               const real_t gZ = grad[qz][qy][qx][2];
-               for (int dx = 0; dx < D1D; ++dx)
-               {
-                  const real_t wx  = Bt(dx,qx);
-                  const real_t wDx = Gt(dx,qx);
-                  gradX[dx][0] += gX * wDx;
-                  gradX[dx][1] += gY * wx;
-                  gradX[dx][2] += gZ * wx;
-               }
-            }
-            for (int dy = 0; dy < D1D; ++dy)
-            {
-               const real_t wy  = Bt(dy,qy);
-               const real_t wDy = Gt(dy,qy);
-               for (int dx = 0; dx < D1D; ++dx)
-               {
-                  gradXY[dy][dx][0] += gradX[dx][0] * wy;
-                  gradXY[dy][dx][1] += gradX[dx][1] * wDy;
-                  gradXY[dy][dx][2] += gradX[dx][2] * wy;
-               }
+               gradXY[dy][dx][0] += gradX[dx][0] * wy;
+               gradXY[dy][dx][1] += gradX[dx][1] * wDy;
+               gradXY[dy][dx][2] += gradX[dx][2] * wy;
             }
          }
-         for (int dz = 0; dz < D1D; ++dz)
+      }
+      for (int dz = 0; dz < D1D; ++dz)
+      {
+         const real_t wz  = Bt(dz,qz);
+         const real_t wDz = Gt(dz,qz);
+         for (int dy = 0; dy < D1D; ++dy)
          {
-            const real_t wz  = Bt(dz,qz);
-            const real_t wDz = Gt(dz,qz);
-            for (int dy = 0; dy < D1D; ++dy)
+            for (int dx = 0; dx < D1D; ++dx)
             {
-               for (int dx = 0; dx < D1D; ++dx)
-               {
-                  Y(dx,dy,dz,e) +=
-                     ((gradXY[dy][dx][0] * wz) +
-                      (gradXY[dy][dx][1] * wz) +
-                      (gradXY[dy][dx][2] * wDz));
-               }
+               Y(dx,dy,dz,e) +=
+                  ((gradXY[dy][dx][0] * wz) +
+                   (gradXY[dy][dx][1] * wz) +
+                   (gradXY[dy][dx][2] * wDz));
             }
          }
       }
+   }
+}
+
+// PA Diffusion Apply 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0, typename DataVector = Vector>
+inline void PADiffusionApply3D(const int NE,
+                               const bool symmetric,
+                               const Array<real_t> &b,
+                               const Array<real_t> &g,
+                               const Array<real_t> &bt,
+                               const Array<real_t> &gt,
+                               const DataVector &d_,
+                               const Vector &x_,
+                               Vector &y_,
+                               int d1d = 0, int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = b.Read();
+   const auto G = g.Read();
+   const auto Bt = bt.Read();
+   const auto Gt = gt.Read();
+   const auto D = d_.Read();
+   const auto X = x_.Read();
+   auto Y = y_.ReadWrite();
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      PADiffusionApply3D_Element<T_D1D,T_Q1D>(e, NE, symmetric, B, G, Bt, Gt,
+                                              D, X, Y, d1d, q1d);
    });
 }
 
-// Shared memory PA Diffusion Apply 3D kernel
+// PA Diffusion Apply 2D kernel for nvec E-vectors stored one after the other
+// in x_ and y_. All vectors are applied to an element before moving on to the
+// next element, so the quadrature data of each element is loaded only once.
 template<int T_D1D = 0, int T_Q1D = 0>
+inline void PADiffusionMultiApply2D(const int NE,
+                                    const int nvec,
+                                    const bool symmetric,
+                                    const Array<real_t> &b_,
+                                    const Array<real_t> &g_,
+                                    const Array<real_t> &bt_,
+                                    const Array<real_t> &gt_,
+                                    const Vector &d_,
+                                    const Vector &x_,
+                                    Vector &y_,
+                                    const int d1d = 0,
+                                    const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const int esize = D1D*D1D*NE;
+   const auto B = b_.Read();
+   const auto G = g_.Read();
+   const auto Bt = bt_.Read();
+   const auto Gt = gt_.Read();
+   const auto D = d_.Read();
+   const auto X = x_.Read();
+   auto Y = y_.ReadWrite();
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int v = 0; v < nvec; ++v)
+      {
+         PADiffusionApply2D_Element<T_D1D,T_Q1D>(e, NE, symmetric, B, G, Bt, Gt,
+                                                 D, X + v*esize, Y + v*esize,
+                                                 d1d, q1d);
+      }
+   });
+}
+
+// PA Diffusion Apply 3D kernel for nvec E-vectors, see PADiffusionMultiApply2D
+template<int T_D1D = 0, int T_Q1D = 0>
+inline void PADiffusionMultiApply3D(const int NE,
+                                    const int nvec,
+                                    const bool symmetric,
+                                    const Array<real_t> &b_,
+                                    const Array<real_t> &g_,
+                                    const Array<real_t> &bt_,
+                                    const Array<real_t> &gt_,
+                                    const Vector &d_,
+                                    const Vector &x_,
+                                    Vector &y_,
+                                    const int d1d = 0,
+                                    const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   MFEM_VERIFY(D1D <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const int esize = D1D*D1D*D1D*NE;
+   const auto B = b_.Read();
+   const auto G = g_.Read();
+   const auto Bt = bt_.Read();
+   const auto Gt = gt_.Read();
+   const auto D = d_.Read();
+   const auto X = x_.Read();
+   auto Y = y_.ReadWrite();
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int v = 0; v < nvec; ++v)
+      {
+         PADiffusionApply3D_Element<T_D1D,T_Q1D>(e, NE, symmetric, B, G, Bt, Gt,
+                                                 D, X + v*esize, Y + v*esize,
+                                                 d1d, q1d);
+      }
+   });
+}
+
+// Shared memory PA Diffusion Apply 3D kernel
+template<int T_D1D = 0, int T_Q1D = 0, typename DataVector = Vector>
 inline void SmemPADiffusionApply3D(const int NE,
                                    const bool symmetric,
                                    const Array<real_t> &b_,
                                    const Array<real_t> &g_,
                                    const Array<real_t> &,
                                    const Array<real_t> &,
-                                   const Vector &d_,
+                                   const DataVector &d_,
                                    const Vector &x_,
                                    Vector &y_,
                                    const int d1d = 0,
@@ -1215,6 +1348,8 @@ inline void SmemPADiffusionApply3D(const int NE,
 namespace
 {
 using ApplyKernelType = DiffusionIntegrator::ApplyKernelType;
+using ApplyMixedKernelType = DiffusionIntegrator::ApplyMixedKernelType;
+using MultiApplyKernelType = DiffusionIntegrator::MultiApplyKernelType;
 using DiagonalKernelType = DiffusionIntegrator::DiagonalKernelType;
 }
 
@@ -1234,6 +1369,40 @@ ApplyKernelType DiffusionIntegrator::ApplyPAKernels::Fallback(int DIM, int, int)
    else { MFEM_ABORT(""); }
 }
 
+template<int DIM, int T_D1D, int T_Q1D>
+ApplyMixedKernelType DiffusionIntegrator::ApplyMixedPAKernels::Kernel()
+{
+   using DV = Array<float>;
+   if constexpr (DIM == 2) { return internal::SmemPADiffusionApply2D<T_D1D,T_Q1D,DV>; }
+   else if constexpr (DIM == 3) { return internal::SmemPADiffusionApply3D<T_D1D,T_Q1D,DV>; }
+   MFEM_ABORT("");
+}
+
+inline ApplyMixedKernelType
+DiffusionIntegrator::ApplyMixedPAKernels::Fallback(int DIM, int, int)
+{
+   using DV = Array<float>;
+   if (DIM == 2) { return internal::PADiffusionApply2D<0,0,DV>; }
+   else if (DIM == 3) { return internal::PADiffusionApply3D<0,0,DV>; }
+   else { MFEM_ABORT(""); }
+}
+
+template<int DIM, int T_D1D, int T_Q1D>
+MultiApplyKernelType DiffusionIntegrator::MultiApplyPAKernels::Kernel()
+{
+   if constexpr (DIM == 2) { return internal::PADiffusionMultiApply2D<T_D1D,T_Q1D>; }
+   else if constexpr (DIM == 3) { return internal::PADiffusionMultiApply3D<T_D1D,T_Q1D>; }
+   MFEM_ABORT("");
+}
+
+inline MultiApplyKernelType
+DiffusionIntegrator::MultiApplyPAKernels::Fallback(int DIM, int, int)
+{
+   if (DIM == 2) { return internal::PADiffusionMultiApply2D; }
+   else if (DIM == 3) { return internal::PADiffusionMultiApply3D; }
+   else { MFEM_ABORT(""); }
+}
+
 template<int DIM, int D1D, int Q1D>
 DiagonalKernelType DiffusionIntegrator::DiagonalPAKernels::Kernel()
 {
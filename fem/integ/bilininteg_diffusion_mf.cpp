@@ -11,7 +11,9 @@
 
 #include "../bilininteg.hpp"
 #include "../gridfunc.hpp"
+#include "../qfunction.hpp"
 #include "../ceed/integrators/diffusion/diffusion.hpp"
+#include "bilininteg_diffusion_kernels.hpp"
 
 namespace mfem
 {
@@ -41,8 +43,70 @@ void DiffusionIntegrator::AssembleMF(const FiniteElementSpace &fes)
       }
       return;
    }
-   MFEM_ABORT("Error: DiffusionIntegrator::AssembleMF only implemented with"
-              " libCEED");
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "DiffusionIntegrator::AssembleMF without"
+               " libCEED is only implemented in 2D and 3D");
+   MFEM_VERIFY(UsesTensorBasis(fes) && !fes.IsVariableOrder(),
+               "DiffusionIntegrator::AssembleMF without libCEED is only"
+               " implemented for tensor-product elements of the same order");
+   ne = fes.GetNE();
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+   mf_geom.Setup(fes, *ir);
+
+   // A constant coefficient is stored in compressed form, i.e. only one value
+   // per component, other coefficients are evaluated for each block of
+   // elements in SetupMFBlock().
+   mf_coeff.Destroy();
+   const bool const_coeff =
+      !(Q || VQ || MQ) || dynamic_cast<ConstantCoefficient*>(Q) ||
+      dynamic_cast<VectorConstantCoefficient*>(VQ) ||
+      dynamic_cast<MatrixConstantCoefficient*>(MQ) ||
+      dynamic_cast<SymmetricMatrixConstantCoefficient*>(MQ);
+   if (const_coeff)
+   {
+      QuadratureSpace qs(*mesh, *ir);
+      CoefficientVector coeff(qs, CoefficientStorage::COMPRESSED);
+      if (MQ) { coeff.ProjectTranspose(*MQ); }
+      else if (VQ) { coeff.Project(*VQ); }
+      else if (Q) { coeff.Project(*Q); }
+      else { coeff.SetConstant(1.0); }
+      mf_coeff_dim = coeff.GetVDim();
+      mf_coeff.SetSize(coeff.Size(), Device::GetDeviceMemoryType());
+      mf_coeff = coeff;
+   }
+   else if (MQ)
+   {
+      const bool sym = dynamic_cast<SymmetricMatrixCoefficient*>(MQ);
+      mf_coeff_dim = sym ? (dim*(dim + 1))/2 : dim*dim;
+   }
+   else
+   {
+      mf_coeff_dim = VQ ? VQ->GetVDim() : 1;
+   }
+   symmetric = (mf_coeff_dim != dim*dim);
+}
+
+void DiffusionIntegrator::SetupMFBlock(int e0, int nb) const
+{
+   const IntegrationRule &ir = mf_geom.GetIntRule();
+   const int nq = ir.GetNPoints();
+   mf_geom.GetJacobians(e0, nb, mf_J);
+
+   const bool const_coeff = (mf_coeff.Size() == mf_coeff_dim);
+   if (!const_coeff)
+   {
+      if (MQ) { mf_geom.GetCoefficient(*MQ, e0, nb, mf_C); }
+      else if (VQ) { mf_geom.GetCoefficient(*VQ, e0, nb, mf_C); }
+      else { mf_geom.GetCoefficient(*Q, e0, nb, mf_C); }
+   }
+   const Vector &coeff = const_coeff ? mf_coeff : mf_C;
+
+   const int pa_size = symmetric ? (dim*(dim + 1))/2 : dim*dim;
+   mf_data.SetSize(pa_size*nq*nb, Device::GetDeviceMemoryType());
+   internal::PADiffusionSetup(dim, dim, dofs1D, quad1D, mf_coeff_dim, nb,
+                              ir.GetWeights(), mf_J, coeff, mf_data);
 }
 
 void DiffusionIntegrator::AssembleDiagonalMF(Vector &diag)
@@ -53,8 +117,18 @@ void DiffusionIntegrator::AssembleDiagonalMF(Vector &diag)
    }
    else
    {
-      MFEM_ABORT("Error: DiffusionIntegrator::AssembleDiagonalMF only"
-                 " implemented with libCEED");
+      const int nd = (dim == 2) ? dofs1D*dofs1D : dofs1D*dofs1D*dofs1D;
+      const int block_size = mf_geom.GetBlockSize();
+      Vector diag_block;
+      for (int e0 = 0; e0 < ne; e0 += block_size)
+      {
+         const int nb = std::min(block_size, ne - e0);
+         SetupMFBlock(e0, nb);
+         diag_block.MakeRef(diag, e0*nd, nb*nd);
+         DiagonalPAKernels::Run(dim, dofs1D, quad1D, nb, symmetric, maps->B,
+                                maps->G, mf_data, diag_block, dofs1D, quad1D);
+         diag_block.SyncAliasMemory(diag);
+      }
    }
 }
 
@@ -66,8 +140,22 @@ void DiffusionIntegrator::AddMultMF(const Vector &x, Vector &y) const
    }
    else
    {
-      MFEM_ABORT("Error: DiffusionIntegrator::AddMultMF only implemented with"
-                 " libCEED");
+      // The quadrature data is computed for one block of elements at a time
+      // and applied with the PA kernels, so it never exceeds the block size.
+      const int nd = (dim == 2) ? dofs1D*dofs1D : dofs1D*dofs1D*dofs1D;
+      const int block_size = mf_geom.GetBlockSize();
+      Vector x_block, y_block;
+      for (int e0 = 0; e0 < ne; e0 += block_size)
+      {
+         const int nb = std::min(block_size, ne - e0);
+         SetupMFBlock(e0, nb);
+         x_block.MakeRef(const_cast<Vector&>(x), e0*nd, nb*nd);
+         y_block.MakeRef(y, e0*nd, nb*nd);
+         ApplyPAKernels::Run(dim, dofs1D, quad1D, nb, symmetric, maps->B,
+                             maps->G, maps->Bt, maps->Gt, mf_data, x_block,
+                             y_block, dofs1D, quad1D);
+         y_block.SyncAliasMemory(y);
+      }
    }
 }
 
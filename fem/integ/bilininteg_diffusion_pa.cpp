@@ -15,6 +15,7 @@
 #include "../../mesh/nurbs.hpp"
 #include "../ceed/integrators/diffusion/diffusion.hpp"
 #include "bilininteg_diffusion_kernels.hpp"
+#include "bilininteg_simplex_pa.hpp"
 
 namespace mfem
 {
@@ -27,10 +28,22 @@ void DiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
    }
    else
    {
-      if (pa_data.Size() == 0) { AssemblePA(*fespace); }
+      if (pa_data.Size() == 0 && pa_data_sp.Size() == 0)
+      {
+         AssemblePA(*fespace);
+      }
+      if (simplex_maps.IsSetup())
+      {
+         internal::PABernsteinDiffusionAssembleDiagonal(dim, ne, symmetric,
+                                                        simplex_maps, pa_data,
+                                                        diag);
+         return;
+      }
       const Array<real_t> &B = maps->B;
       const Array<real_t> &G = maps->G;
-      const Vector &Dv = pa_data;
+      Vector D_sp;
+      if (pa_data_sp.Size() > 0) { LoadPADataSingle(pa_data_sp, D_sp); }
+      const Vector &Dv = (pa_data_sp.Size() > 0) ? D_sp : pa_data;
       DiagonalPAKernels::Run(dim, dofs1D, quad1D, ne, symmetric, B, G, Dv,
                              diag, dofs1D, quad1D);
    }
@@ -43,6 +56,17 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    {
       ceedOp->AddMult(x, y);
    }
+   else if (simplex_maps.IsSetup())
+   {
+      internal::PABernsteinDiffusionApply(dim, ne, symmetric, simplex_maps,
+                                          pa_data, x, y);
+   }
+   else if (pa_data_sp.Size() > 0)
+   {
+      ApplyMixedPAKernels::Run(dim, dofs1D, quad1D, ne, symmetric, maps->B,
+                               maps->G, maps->Bt, maps->Gt, pa_data_sp, x, y,
+                               dofs1D, quad1D);
+   }
    else
    {
       const Array<real_t> &B = maps->B;
@@ -73,6 +97,19 @@ void DiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
 }
 
+void DiffusionIntegrator::AddMultiMultPA(int nvec, const Vector &x,
+                                         Vector &y) const
+{
+   if (DeviceCanUseCeed() || (dim != 2 && dim != 3) || simplex_maps.IsSetup() ||
+       pa_data_sp.Size() > 0)
+   {
+      return BilinearFormIntegrator::AddMultiMultPA(nvec, x, y);
+   }
+   MultiApplyPAKernels::Run(dim, dofs1D, quad1D, ne, nvec, symmetric, maps->B,
+                            maps->G, maps->Bt, maps->Gt, pa_data, x, y,
+                            dofs1D, quad1D);
+}
+
 void DiffusionIntegrator::AddMultTransposePA(const Vector &x, Vector &y) const
 {
    if (symmetric)
@@ -113,6 +150,19 @@ void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
       }
       return;
    }
+   if (const IntegrationRule *cir = simplex_maps.Setup(el, ir->GetOrder()))
+   {
+      // Sum-factorized kernels on simplices, see BernsteinSimplexMaps
+      MFEM_VERIFY(!IntRule || IntRule == cir, "partial assembly on simplices"
+                  " requires a collapsed rule, see IntRules.GetCollapsed()");
+      ir = cir;
+   }
+   else
+   {
+      MFEM_VERIFY(Geometry::IsTensorProduct(el.GetGeomType()),
+                  "partial assembly on simplices requires an order >= 1 and a"
+                  " nodal or Bernstein (BasisType::Positive) basis");
+   }
    const int dims = el.GetDim();
    const int symmDims = (dims * (dims + 1)) / 2; // 1x1: 1, 2x2: 3, 3x3: 6
    const int nq = ir->GetNPoints();
@@ -120,9 +170,18 @@ void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    ne = fes.GetNE();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::JACOBIANS, mt);
    const int sdim = mesh->SpaceDimension();
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
-   dofs1D = maps->ndof;
-   quad1D = maps->nqpt;
+   if (simplex_maps.IsSetup())
+   {
+      maps = nullptr;
+      dofs1D = simplex_maps.order + 1;
+      quad1D = simplex_maps.nqpt;
+   }
+   else
+   {
+      maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+      dofs1D = maps->ndof;
+      quad1D = maps->nqpt;
+   }
 
    QuadratureSpace qs(*mesh, *ir);
    CoefficientVector coeff(qs, CoefficientStorage::COMPRESSED);
@@ -139,6 +198,19 @@ void DiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
    pa_data.SetSize(pa_size * nq * ne, mt);
    internal::PADiffusionSetup(dim, sdim, dofs1D, quad1D, coeff_dim, ne,
                               ir->GetWeights(), geom->J, coeff, pa_data);
+   if (simplex_maps.IsSetup())
+   {
+      internal::PABernsteinDiffusionCollapse(dims, ne, symmetric, simplex_maps,
+                                             pa_data);
+   }
+   if (dims > 1 && !simplex_maps.IsSetup())
+   {
+      StorePADataSingle(pa_data, pa_data_sp);
+   }
+   else
+   {
+      pa_data_sp.DeleteAll();
+   }
 }
 
 void DiffusionIntegrator::AssembleNURBSPA(const FiniteElementSpace &fes)
@@ -170,7 +242,10 @@ void DiffusionIntegrator::AddAbsMultPA(const Vector &x, Vector &y) const
    {
       MFEM_ABORT("Ceed AbsMult not implemented yet");
    }
+   MFEM_VERIFY(!simplex_maps.IsSetup(),
+               "AbsMult is not supported on simplices");
    Vector abs_pa_data(pa_data);
+   if (pa_data_sp.Size() > 0) { LoadPADataSingle(pa_data_sp, abs_pa_data); }
    abs_pa_data.Abs();
    auto abs_maps = maps->Abs();
 
@@ -24,6 +24,8 @@ void MassIntegrator::AssembleEA_(Vector &ea_data,
    using internal::EAMassAssemble2D;
    using internal::EAMassAssemble3D;
 
+   MFEM_VERIFY(!simplex_maps.IsSetup(),
+               "Element assembly is not supported on simplices");
    const Array<real_t> &B = maps->B;
    if (dim == 1)
    {
@@ -79,7 +81,11 @@ void MassIntegrator::AssembleEA(const FiniteElementSpace &fes,
                                 Vector &ea_data,
                                 const bool add)
 {
+   // The EA kernels read the real_t quadrature data
+   const bool mixed_precision = pa_mixed_precision;
+   pa_mixed_precision = false;
    AssemblePA(fes);
+   pa_mixed_precision = mixed_precision;
    if (ne > 0) { AssembleEA_(ea_data, add); }
 }
 
@@ -429,13 +429,13 @@ void OccaPAMassApply3D(const int D1D,
                        Vector &Y);
 #endif // MFEM_USE_OCCA
 
-template <bool ACCUMULATE = true>
+template <bool ACCUMULATE = true, typename DT = real_t>
 MFEM_HOST_DEVICE inline
 void PAMassApply2D_Element(const int e,
                            const int NE,
                            const real_t *b_,
                            const real_t *bt_,
-                           const real_t *d_,
+                           const DT *d_,
                            const real_t *x_,
                            real_t *y_,
                            const int d1d = 0,
@@ -445,7 +445,7 @@ void PAMassApply2D_Element(const int e,
    const int Q1D = q1d;
    auto B = ConstDeviceMatrix(b_, Q1D, D1D);
    auto Bt = ConstDeviceMatrix(bt_, D1D, Q1D);
-   auto D = ConstDeviceCube(d_, Q1D, Q1D, NE);
+   auto D = DeviceTensor<3,const DT>(d_, Q1D, Q1D, NE);
    auto X = ConstDeviceCube(x_, D1D, D1D, NE);
    auto Y = DeviceCube(y_, D1D, D1D, NE);
 
@@ -527,12 +527,13 @@ void PAMassApply2D_Element(const int e,
    }
 }
 
-template<int T_D1D, int T_Q1D, int T_NBZ, bool ACCUMULATE = true>
+template<int T_D1D, int T_Q1D, int T_NBZ, bool ACCUMULATE = true,
+         typename DT = real_t>
 MFEM_HOST_DEVICE inline
 void SmemPAMassApply2D_Element(const int e,
                                const int NE,
                                const real_t *b_,
-                               const real_t *d_,
+                               const DT *d_,
                                const real_t *x_,
                                real_t *y_,
                                int d1d = 0,
@@ -547,7 +548,7 @@ void SmemPAMassApply2D_Element(const int e,
    constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
 
    auto b = ConstDeviceMatrix(b_, Q1D, D1D);
-   auto D = ConstDeviceCube(d_, Q1D, Q1D, NE);
+   auto D = DeviceTensor<3,const DT>(d_, Q1D, Q1D, NE);
    auto x = ConstDeviceCube(x_, D1D, D1D, NE);
    auto Y = DeviceCube(y_, D1D, D1D, NE);
 
@@ -653,13 +654,13 @@ void SmemPAMassApply2D_Element(const int e,
    }
 }
 
-template <bool ACCUMULATE = true>
+template <bool ACCUMULATE = true, typename DT = real_t>
 MFEM_HOST_DEVICE inline
 void PAMassApply3D_Element(const int e,
                            const int NE,
                            const real_t *b_,
                            const real_t *bt_,
-                           const real_t *d_,
+                           const DT *d_,
                            const real_t *x_,
                            real_t *y_,
                            const int d1d,
@@ -669,7 +670,7 @@ void PAMassApply3D_Element(const int e,
    const int Q1D = q1d;
    auto B = ConstDeviceMatrix(b_, Q1D, D1D);
    auto Bt = ConstDeviceMatrix(bt_, D1D, Q1D);
-   auto D = DeviceTensor<4,const real_t>(d_, Q1D, Q1D, Q1D, NE);
+   auto D = DeviceTensor<4,const DT>(d_, Q1D, Q1D, Q1D, NE);
    auto X = DeviceTensor<4,const real_t>(x_, D1D, D1D, D1D, NE);
    auto Y = DeviceTensor<4,real_t>(y_, D1D, D1D, D1D, NE);
 
@@ -804,12 +805,13 @@ void PAMassApply3D_Element(const int e,
    }
 }
 
-template<int T_D1D, int T_Q1D, bool ACCUMULATE = true>
+template<int T_D1D, int T_Q1D, bool ACCUMULATE = true,
+         typename DT = real_t>
 MFEM_HOST_DEVICE inline
 void SmemPAMassApply3D_Element(const int e,
                                const int NE,
                                const real_t *b_,
-                               const real_t *d_,
+                               const DT *d_,
                                const real_t *x_,
                                real_t *y_,
                                const int d1d = 0,
@@ -822,7 +824,7 @@ void SmemPAMassApply3D_Element(const int e,
    constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
 
    auto b = ConstDeviceMatrix(b_, Q1D, D1D);
-   auto d = DeviceTensor<4,const real_t>(d_, Q1D, Q1D, Q1D, NE);
+   auto d = DeviceTensor<4,const DT>(d_, Q1D, Q1D, Q1D, NE);
    auto x = DeviceTensor<4,const real_t>(x_, D1D, D1D, D1D, NE);
    auto y = DeviceTensor<4,real_t>(y_, D1D, D1D, D1D, NE);
 
@@ -1033,11 +1035,11 @@ void SmemPAMassApply3D_Element(const int e,
 }
 
 // PA Mass Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, typename DataVector = Vector>
 inline void PAMassApply2D(const int NE,
                           const Array<real_t> &b_,
                           const Array<real_t> &bt_,
-                          const Vector &d_,
+                          const DataVector &d_,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
@@ -1059,11 +1061,11 @@ inline void PAMassApply2D(const int NE,
 }
 
 // Shared memory PA Mass Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, typename DataVector = Vector>
 inline void SmemPAMassApply2D(const int NE,
                               const Array<real_t> &b_,
                               const Array<real_t> &bt_,
-                              const Vector &d_,
+                              const DataVector &d_,
                               const Vector &x_,
                               Vector &y_,
                               const int d1d = 0,
@@ -1090,11 +1092,11 @@ inline void SmemPAMassApply2D(const int NE,
 }
 
 // PA Mass Apply 3D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, typename DataVector = Vector>
 inline void PAMassApply3D(const int NE,
                           const Array<real_t> &b_,
                           const Array<real_t> &bt_,
-                          const Vector &d_,
+                          const DataVector &d_,
                           const Vector &x_,
                           Vector &y_,
                           const int d1d = 0,
@@ -1116,11 +1118,11 @@ inline void PAMassApply3D(const int NE,
 }
 
 // Shared memory PA Mass Apply 2D kernel
-template<int T_D1D = 0, int T_Q1D = 0>
+template<int T_D1D = 0, int T_Q1D = 0, typename DataVector = Vector>
 inline void SmemPAMassApply3D(const int NE,
                               const Array<real_t> &b_,
                               const Array<real_t> &bt_,
-                              const Vector &d_,
+                              const DataVector &d_,
                               const Vector &x_,
                               Vector &y_,
                               const int d1d = 0,
@@ -1143,6 +1145,138 @@ inline void SmemPAMassApply3D(const int NE,
    });
 }
 
+// PA Mass Apply 2D kernel for nvec E-vectors stored one after the other in x_
+// and y_. All vectors are applied to an element before moving on to the next
+// element, so the quadrature data of each element is loaded only once.
+inline void PAMassMultiApply2D(const int NE,
+                               const int nvec,
+                               const Array<real_t> &b_,
+                               const Array<real_t> &bt_,
+                               const Vector &d_,
+                               const Vector &x_,
+                               Vector &y_,
+                               const int d1d,
+                               const int q1d)
+{
+   MFEM_VERIFY(d1d <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(q1d <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const int esize = d1d*d1d*NE;
+   const auto B = b_.Read();
+   const auto Bt = bt_.Read();
+   const auto D = d_.Read();
+   const auto X = x_.Read();
+   auto Y = y_.ReadWrite();
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int v = 0; v < nvec; ++v)
+      {
+         internal::PAMassApply2D_Element(e, NE, B, Bt, D, X + v*esize,
+                                         Y + v*esize, d1d, q1d);
+      }
+   });
+}
+
+// PA Mass Apply 3D kernel for nvec E-vectors, see PAMassMultiApply2D
+inline void PAMassMultiApply3D(const int NE,
+                               const int nvec,
+                               const Array<real_t> &b_,
+                               const Array<real_t> &bt_,
+                               const Vector &d_,
+                               const Vector &x_,
+                               Vector &y_,
+                               const int d1d,
+                               const int q1d)
+{
+   MFEM_VERIFY(d1d <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(q1d <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const int esize = d1d*d1d*d1d*NE;
+   const auto B = b_.Read();
+   const auto Bt = bt_.Read();
+   const auto D = d_.Read();
+   const auto X = x_.Read();
+   auto Y = y_.ReadWrite();
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int v = 0; v < nvec; ++v)
+      {
+         internal::PAMassApply3D_Element(e, NE, B, Bt, D, X + v*esize,
+                                         Y + v*esize, d1d, q1d);
+      }
+   });
+}
+
+// Shared memory version of PAMassMultiApply2D
+template<int T_D1D = 0, int T_Q1D = 0>
+inline void SmemPAMassMultiApply2D(const int NE,
+                                   const int nvec,
+                                   const Array<real_t> &b_,
+                                   const Array<real_t> &bt_,
+                                   const Vector &d_,
+                                   const Vector &x_,
+                                   Vector &y_,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   MFEM_CONTRACT_VAR(bt_);
+   static constexpr int T_NBZ = mass::NBZ(T_D1D);
+   static constexpr int NBZ = T_NBZ ? T_NBZ : 1;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int max_q1d = T_Q1D ? T_Q1D : DeviceDofQuadLimits::Get().MAX_Q1D;
+   const int max_d1d = T_D1D ? T_D1D : DeviceDofQuadLimits::Get().MAX_D1D;
+   MFEM_VERIFY(D1D <= max_d1d, "");
+   MFEM_VERIFY(Q1D <= max_q1d, "");
+   const int esize = D1D*D1D*NE;
+   const auto b = b_.Read();
+   const auto D = d_.Read();
+   const auto x = x_.Read();
+   auto Y = y_.ReadWrite();
+   mfem::forall_2D_batch(NE, Q1D, Q1D, NBZ, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int v = 0; v < nvec; ++v)
+      {
+         internal::SmemPAMassApply2D_Element<T_D1D,T_Q1D,T_NBZ>(
+            e, NE, b, D, x + v*esize, Y + v*esize, d1d, q1d);
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+// Shared memory version of PAMassMultiApply3D
+template<int T_D1D = 0, int T_Q1D = 0>
+inline void SmemPAMassMultiApply3D(const int NE,
+                                   const int nvec,
+                                   const Array<real_t> &b_,
+                                   const Array<real_t> &bt_,
+                                   const Vector &d_,
+                                   const Vector &x_,
+                                   Vector &y_,
+                                   const int d1d = 0,
+                                   const int q1d = 0)
+{
+   MFEM_CONTRACT_VAR(bt_);
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int max_q1d = T_Q1D ? T_Q1D : DeviceDofQuadLimits::Get().MAX_Q1D;
+   const int max_d1d = T_D1D ? T_D1D : DeviceDofQuadLimits::Get().MAX_D1D;
+   MFEM_VERIFY(D1D <= max_d1d, "");
+   MFEM_VERIFY(Q1D <= max_q1d, "");
+   const int esize = D1D*D1D*D1D*NE;
+   const auto b = b_.Read();
+   const auto d = d_.Read();
+   const auto x = x_.Read();
+   auto y = y_.ReadWrite();
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      for (int v = 0; v < nvec; ++v)
+      {
+         internal::SmemPAMassApply3D_Element<T_D1D,T_Q1D>(
+            e, NE, b, d, x + v*esize, y + v*esize, d1d, q1d);
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
 template<int T_D1D = 0, int T_Q1D = 0>
 inline void EAMassAssemble1D(const int NE,
                              const Array<real_t> &basis,
@@ -1386,6 +1520,8 @@ inline void EAMassAssemble3D(const int NE,
 namespace
 {
 using ApplyKernelType = MassIntegrator::ApplyKernelType;
+using ApplyMixedKernelType = MassIntegrator::ApplyMixedKernelType;
+using MultiApplyKernelType = MassIntegrator::MultiApplyKernelType;
 using DiagonalKernelType = MassIntegrator::DiagonalKernelType;
 }
 
@@ -1407,6 +1543,40 @@ inline ApplyKernelType MassIntegrator::ApplyPAKernels::Fallback(
    else { MFEM_ABORT(""); }
 }
 
+template<int DIM, int T_D1D, int T_Q1D>
+ApplyMixedKernelType MassIntegrator::ApplyMixedPAKernels::Kernel()
+{
+   using DV = Array<float>;
+   if constexpr (DIM == 2) { return internal::SmemPAMassApply2D<T_D1D,T_Q1D,DV>; }
+   else if constexpr (DIM == 3) { return internal::SmemPAMassApply3D<T_D1D,T_Q1D,DV>; }
+   MFEM_ABORT("");
+}
+
+inline ApplyMixedKernelType MassIntegrator::ApplyMixedPAKernels::Fallback(
+   int DIM, int, int)
+{
+   using DV = Array<float>;
+   if (DIM == 2) { return internal::PAMassApply2D<0,0,DV>; }
+   else if (DIM == 3) { return internal::PAMassApply3D<0,0,DV>; }
+   else { MFEM_ABORT(""); }
+}
+
+template<int DIM, int T_D1D, int T_Q1D>
+MultiApplyKernelType MassIntegrator::MultiApplyPAKernels::Kernel()
+{
+   if constexpr (DIM == 2) { return internal::SmemPAMassMultiApply2D<T_D1D,T_Q1D>; }
+   else if constexpr (DIM == 3) { return internal::SmemPAMassMultiApply3D<T_D1D,T_Q1D>; }
+   MFEM_ABORT("");
+}
+
+inline MultiApplyKernelType MassIntegrator::MultiApplyPAKernels::Fallback(
+   int DIM, int, int)
+{
+   if (DIM == 2) { return internal::PAMassMultiApply2D; }
+   else if (DIM == 3) { return internal::PAMassMultiApply3D; }
+   else { MFEM_ABORT(""); }
+}
+
 template<int DIM, int T_D1D, int T_Q1D>
 DiagonalKernelType MassIntegrator::DiagonalPAKernels::Kernel()
 {
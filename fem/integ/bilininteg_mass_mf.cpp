@@ -9,9 +9,12 @@
 // terms of the BSD-3 license. We welcome feedback and contributions, see file
 // CONTRIBUTING.md for details.
 
+#include "../../general/forall.hpp"
 #include "../bilininteg.hpp"
 #include "../gridfunc.hpp"
+#include "../qfunction.hpp"
 #include "../ceed/integrators/mass/mass.hpp"
+#include "bilininteg_mass_kernels.hpp"
 
 namespace mfem
 {
@@ -39,8 +42,51 @@ void MassIntegrator::AssembleMF(const FiniteElementSpace &fes)
       }
       return;
    }
-   MFEM_ABORT("Error: MassIntegrator::AssembleMF only implemented with"
-              " libCEED");
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "MassIntegrator::AssembleMF without"
+               " libCEED is only implemented in 2D and 3D");
+   MFEM_VERIFY(UsesTensorBasis(fes) && !fes.IsVariableOrder(),
+               "MassIntegrator::AssembleMF without libCEED is only"
+               " implemented for tensor-product elements of the same order");
+   ne = fes.GetNE();
+   nq = ir->GetNPoints();
+   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+   dofs1D = maps->ndof;
+   quad1D = maps->nqpt;
+   mf_by_val = (el.GetMapType() == FiniteElement::VALUE);
+   mf_geom.Setup(fes, *ir);
+
+   // A constant coefficient is stored as a single value, other coefficients
+   // are evaluated for each block of elements in SetupMFBlock().
+   mf_coeff.Destroy();
+   auto *const_Q = dynamic_cast<ConstantCoefficient*>(Q);
+   if (!Q || const_Q)
+   {
+      mf_coeff.SetSize(1, Device::GetDeviceMemoryType());
+      mf_coeff = const_Q ? const_Q->constant : 1.0;
+   }
+}
+
+void MassIntegrator::SetupMFBlock(int e0, int nb) const
+{
+   mf_geom.GetDeterminants(e0, nb, mf_detJ);
+   mf_data.SetSize(nq*nb, Device::GetDeviceMemoryType());
+
+   const int NQ = nq;
+   const bool const_c = mf_coeff.Size() == 1;
+   if (!const_c) { mf_geom.GetCoefficient(*Q, e0, nb, mf_C); }
+   const bool by_val = mf_by_val;
+   const auto W = Reshape(mf_geom.GetIntRule().GetWeights().Read(), NQ);
+   const auto J = Reshape(mf_detJ.Read(), NQ, nb);
+   const auto C = const_c ? Reshape(mf_coeff.Read(), 1, 1) :
+                  Reshape(mf_C.Read(), NQ, nb);
+   auto v = Reshape(mf_data.Write(), NQ, nb);
+   mfem::forall(NQ, nb, [=] MFEM_HOST_DEVICE(int q, int e)
+   {
+      const real_t detJ = J(q, e);
+      const real_t coeff = const_c ? C(0, 0) : C(q, e);
+      v(q, e) = W(q) * coeff * (by_val ? detJ : 1.0 / detJ);
+   });
 }
 
 void MassIntegrator::AddMultMF(const Vector &x, Vector &y) const
@@ -51,8 +97,21 @@ void MassIntegrator::AddMultMF(const Vector &x, Vector &y) const
    }
    else
    {
-      MFEM_ABORT("Error: MassIntegrator::AddMultMF only implemented with"
-                 " libCEED");
+      // The quadrature data is computed for one block of elements at a time
+      // and applied with the PA kernels, so it never exceeds the block size.
+      const int nd = (dim == 2) ? dofs1D*dofs1D : dofs1D*dofs1D*dofs1D;
+      const int block_size = mf_geom.GetBlockSize();
+      Vector x_block, y_block;
+      for (int e0 = 0; e0 < ne; e0 += block_size)
+      {
+         const int nb = std::min(block_size, ne - e0);
+         SetupMFBlock(e0, nb);
+         x_block.MakeRef(const_cast<Vector&>(x), e0*nd, nb*nd);
+         y_block.MakeRef(y, e0*nd, nb*nd);
+         ApplyPAKernels::Run(dim, dofs1D, quad1D, nb, maps->B, maps->Bt,
+                             mf_data, x_block, y_block, dofs1D, quad1D);
+         y_block.SyncAliasMemory(y);
+      }
    }
 }
 
@@ -64,8 +123,18 @@ void MassIntegrator::AssembleDiagonalMF(Vector &diag)
    }
    else
    {
-      MFEM_ABORT("Error: MassIntegrator::AssembleDiagonalMF only implemented"
-                 " with libCEED");
+      const int nd = (dim == 2) ? dofs1D*dofs1D : dofs1D*dofs1D*dofs1D;
+      const int block_size = mf_geom.GetBlockSize();
+      Vector diag_block;
+      for (int e0 = 0; e0 < ne; e0 += block_size)
+      {
+         const int nb = std::min(block_size, ne - e0);
+         SetupMFBlock(e0, nb);
+         diag_block.MakeRef(diag, e0*nd, nb*nd);
+         DiagonalPAKernels::Run(dim, dofs1D, quad1D, nb, maps->B, mf_data,
+                                diag_block, dofs1D, quad1D);
+         diag_block.SyncAliasMemory(diag);
+      }
    }
 }
 
@@ -15,6 +15,7 @@
 #include "../qfunction.hpp"
 #include "../ceed/integrators/mass/mass.hpp"
 #include "bilininteg_mass_kernels.hpp"
+#include "bilininteg_simplex_pa.hpp"
 
 namespace mfem
 {
@@ -47,14 +48,36 @@ void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
       }
       return;
    }
+   if (const IntegrationRule *cir = simplex_maps.Setup(el, ir->GetOrder()))
+   {
+      // Sum-factorized kernels on simplices, see BernsteinSimplexMaps
+      MFEM_VERIFY(!IntRule || IntRule == cir, "partial assembly on simplices"
+                  " requires a collapsed rule, see IntRules.GetCollapsed()");
+      ir = cir;
+   }
+   else
+   {
+      MFEM_VERIFY(Geometry::IsTensorProduct(el.GetGeomType()),
+                  "partial assembly on simplices requires an order >= 1 and a"
+                  " nodal or Bernstein (BasisType::Positive) basis");
+   }
    int map_type = el.GetMapType();
    dim = mesh->Dimension();
    ne = fes.GetMesh()->GetNE();
    nq = ir->GetNPoints();
    geom = mesh->GetGeometricFactors(*ir, GeometricFactors::DETERMINANTS, mt);
-   maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
-   dofs1D = maps->ndof;
-   quad1D = maps->nqpt;
+   if (simplex_maps.IsSetup())
+   {
+      maps = nullptr;
+      dofs1D = simplex_maps.order + 1;
+      quad1D = simplex_maps.nqpt;
+   }
+   else
+   {
+      maps = &el.GetDofToQuad(*ir, DofToQuad::TENSOR);
+      dofs1D = maps->ndof;
+      quad1D = maps->nqpt;
+   }
    pa_data.SetSize(ne*nq, mt);
 
    QuadratureSpace qs(*mesh, *ir);
@@ -76,6 +99,14 @@ void MassIntegrator::AssemblePA(const FiniteElementSpace &fes)
          v(q, e) = W(q) * coeff * (by_val ? detJ : 1.0 / detJ);
       });
    }
+   if (dim > 1 && !simplex_maps.IsSetup())
+   {
+      StorePADataSingle(pa_data, pa_data_sp);
+   }
+   else
+   {
+      pa_data_sp.DeleteAll();
+   }
 }
 
 void MassIntegrator::AssemblePABoundary(const FiniteElementSpace &fes)
@@ -92,6 +123,8 @@ void MassIntegrator::AssemblePABoundary(const FiniteElementSpace &fes)
    ElementTransformation *T0 = mesh->GetBdrElementTransformation(0);
    const IntegrationRule *ir = IntRule ? IntRule : &GetRule(el, el, *T0);
 
+   simplex_maps.Reset();
+   pa_data_sp.DeleteAll();
    int map_type = el.GetMapType();
    dim = el.GetDim(); // Dimension of the boundary element, *not* the mesh
    nq = ir->GetNPoints();
@@ -130,6 +163,18 @@ void MassIntegrator::AssembleDiagonalPA(Vector &diag)
    {
       ceedOp->GetDiagonal(diag);
    }
+   else if (simplex_maps.IsSetup())
+   {
+      internal::PABernsteinMassAssembleDiagonal(dim, ne, simplex_maps, pa_data,
+                                                diag);
+   }
+   else if (pa_data_sp.Size() > 0)
+   {
+      Vector D;
+      LoadPADataSingle(pa_data_sp, D);
+      DiagonalPAKernels::Run(dim, dofs1D, quad1D, ne, maps->B, D,
+                             diag, dofs1D, quad1D);
+   }
    else
    {
       DiagonalPAKernels::Run(dim, dofs1D, quad1D, ne, maps->B, pa_data,
@@ -143,6 +188,15 @@ void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
    {
       ceedOp->AddMult(x, y);
    }
+   else if (simplex_maps.IsSetup())
+   {
+      internal::PABernsteinMassApply(dim, ne, simplex_maps, pa_data, x, y);
+   }
+   else if (pa_data_sp.Size() > 0)
+   {
+      ApplyMixedPAKernels::Run(dim, dofs1D, quad1D, ne, maps->B, maps->Bt,
+                               pa_data_sp, x, y, dofs1D, quad1D);
+   }
    else
    {
       const int D1D = dofs1D;
@@ -168,6 +222,17 @@ void MassIntegrator::AddMultPA(const Vector &x, Vector &y) const
    }
 }
 
+void MassIntegrator::AddMultiMultPA(int nvec, const Vector &x, Vector &y) const
+{
+   if (DeviceCanUseCeed() || (dim != 2 && dim != 3) || simplex_maps.IsSetup() ||
+       pa_data_sp.Size() > 0)
+   {
+      return BilinearFormIntegrator::AddMultiMultPA(nvec, x, y);
+   }
+   MultiApplyPAKernels::Run(dim, dofs1D, quad1D, ne, nvec, maps->B, maps->Bt,
+                            pa_data, x, y, dofs1D, quad1D);
+}
+
 void MassIntegrator::AddAbsMultPA(const Vector &x, Vector &y) const
 {
    if (DeviceCanUseCeed())
@@ -175,9 +240,18 @@ void MassIntegrator::AddAbsMultPA(const Vector &x, Vector &y) const
       MFEM_ABORT("AddAbsMultPA not implemented with CEED!");
       ceedOp->AddMult(x, y);
    }
+   else if (simplex_maps.IsSetup())
+   {
+      // The Bernstein polynomials are nonnegative
+      Vector abs_pa_data(pa_data);
+      abs_pa_data.Abs();
+      internal::PABernsteinMassApply(dim, ne, simplex_maps, abs_pa_data, x, y,
+                                     true);
+   }
    else
    {
       Vector abs_pa_data(pa_data);
+      if (pa_data_sp.Size() > 0) { LoadPADataSingle(pa_data_sp, abs_pa_data); }
       abs_pa_data.Abs();
       Array<real_t> absB(maps->B);
       Array<real_t> absBt(maps->Bt);
@@ -0,0 +1,517 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../bilininteg.hpp"
+#include "bilininteg_diffusion_kernels.hpp"
+
+namespace mfem
+{
+
+// Fused PA Mass + Diffusion
+
+/// \cond DO_NOT_DOCUMENT
+namespace internal
+{
+
+// Shared memory PA Mass + Diffusion Apply 2D kernel. This is the symmetric
+// SmemPADiffusionApply2D, with the values interpolated along with the
+// gradients: the value and the x-derivative share the contraction in y.
+template<int T_D1D = 0, int T_Q1D = 0>
+inline void SmemPAMassDiffusionApply2D(const int NE,
+                                       const Array<real_t> &b_,
+                                       const Array<real_t> &g_,
+                                       const Vector &m_,
+                                       const Vector &d_,
+                                       const Vector &x_,
+                                       Vector &y_,
+                                       const int d1d = 0,
+                                       const int q1d = 0)
+{
+   static constexpr int NBZ = T_D1D ? diffusion::NBZApply(T_D1D) : 1;
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int max_q1d = T_Q1D ? T_Q1D : DeviceDofQuadLimits::Get().MAX_Q1D;
+   const int max_d1d = T_D1D ? T_D1D : DeviceDofQuadLimits::Get().MAX_D1D;
+   MFEM_VERIFY(D1D <= max_d1d, "");
+   MFEM_VERIFY(Q1D <= max_q1d, "");
+   auto b = Reshape(b_.Read(), Q1D, D1D);
+   auto g = Reshape(g_.Read(), Q1D, D1D);
+   auto M = Reshape(m_.Read(), Q1D*Q1D, NE);
+   auto D = Reshape(d_.Read(), Q1D*Q1D, 3, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, NE);
+   mfem::forall_2D_batch(NE, Q1D, Q1D, NBZ, [=] MFEM_HOST_DEVICE(int e)
+   {
+      const int tidz = MFEM_THREAD_ID(z);
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      MFEM_SHARED real_t sBG[2][MQ1*MD1];
+      real_t (*B)[MD1] = (real_t (*)[MD1]) (sBG+0);
+      real_t (*G)[MD1] = (real_t (*)[MD1]) (sBG+1);
+      real_t (*Bt)[MQ1] = (real_t (*)[MQ1]) (sBG+0);
+      real_t (*Gt)[MQ1] = (real_t (*)[MQ1]) (sBG+1);
+      MFEM_SHARED real_t Xz[NBZ][MD1][MD1];
+      MFEM_SHARED real_t GD[2][NBZ][MD1][MQ1];
+      MFEM_SHARED real_t GQ[3][NBZ][MQ1][MQ1];
+      real_t (*X)[MD1] = (real_t (*)[MD1])(Xz + tidz);
+      real_t (*DQ0)[MQ1] = (real_t (*)[MQ1])(GD[0] + tidz);
+      real_t (*DQ1)[MQ1] = (real_t (*)[MQ1])(GD[1] + tidz);
+      real_t (*QQ0)[MQ1] = (real_t (*)[MQ1])(GQ[0] + tidz);
+      real_t (*QQ1)[MQ1] = (real_t (*)[MQ1])(GQ[1] + tidz);
+      real_t (*QQ2)[MQ1] = (real_t (*)[MQ1])(GQ[2] + tidz);
+      MFEM_FOREACH_THREAD(dy,y,D1D)
+      {
+         MFEM_FOREACH_THREAD(dx,x,D1D)
+         {
+            X[dy][dx] = x(dx,dy,e);
+         }
+      }
+      if (tidz == 0)
+      {
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(q,x,Q1D)
+            {
+               B[q][dy] = b(q,dy);
+               G[q][dy] = g(q,dy);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(dy,y,D1D)
+      {
+         MFEM_FOREACH_THREAD(qx,x,Q1D)
+         {
+            real_t u = 0.0;
+            real_t v = 0.0;
+            for (int dx = 0; dx < D1D; ++dx)
+            {
+               const real_t coords = X[dy][dx];
+               u += B[qx][dx] * coords;
+               v += G[qx][dx] * coords;
+            }
+            DQ0[dy][qx] = u;
+            DQ1[dy][qx] = v;
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(qy,y,Q1D)
+      {
+         MFEM_FOREACH_THREAD(qx,x,Q1D)
+         {
+            real_t u = 0.0;
+            real_t v = 0.0;
+            real_t w = 0.0;
+            for (int dy = 0; dy < D1D; ++dy)
+            {
+               u += DQ1[dy][qx] * B[qy][dy];
+               v += DQ0[dy][qx] * G[qy][dy];
+               w += DQ0[dy][qx] * B[qy][dy];
+            }
+            QQ0[qy][qx] = u;
+            QQ1[qy][qx] = v;
+            QQ2[qy][qx] = w;
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(qy,y,Q1D)
+      {
+         MFEM_FOREACH_THREAD(qx,x,Q1D)
+         {
+            const int q = (qx + ((qy) * Q1D));
+            const real_t O11 = D(q,0,e);
+            const real_t O12 = D(q,1,e);
+            const real_t O22 = D(q,2,e);
+            const real_t gX = QQ0[qy][qx];
+            const real_t gY = QQ1[qy][qx];
+            QQ0[qy][qx] = (O11 * gX) + (O12 * gY);
+            QQ1[qy][qx] = (O12 * gX) + (O22 * gY);
+            QQ2[qy][qx] *= M(q,e);
+         }
+      }
+      MFEM_SYNC_THREAD;
+      if (tidz == 0)
+      {
+         MFEM_FOREACH_THREAD(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD(q,x,Q1D)
+            {
+               Bt[dy][q] = b(q,dy);
+               Gt[dy][q] = g(q,dy);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(qy,y,Q1D)
+      {
+         MFEM_FOREACH_THREAD(dx,x,D1D)
+         {
+            real_t u = 0.0;
+            real_t v = 0.0;
+            for (int qx = 0; qx < Q1D; ++qx)
+            {
+               u += Gt[dx][qx] * QQ0[qy][qx] + Bt[dx][qx] * QQ2[qy][qx];
+               v += Bt[dx][qx] * QQ1[qy][qx];
+            }
+            DQ0[dx][qy] = u;
+            DQ1[dx][qy] = v;
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD(dy,y,D1D)
+      {
+         MFEM_FOREACH_THREAD(dx,x,D1D)
+         {
+            real_t u = 0.0;
+            real_t v = 0.0;
+            for (int qy = 0; qy < Q1D; ++qy)
+            {
+               u += DQ0[dx][qy] * Bt[dy][qy];
+               v += DQ1[dx][qy] * Gt[dy][qy];
+            }
+            Y(dx,dy,e) += (u + v);
+         }
+      }
+   });
+}
+
+// Shared memory PA Mass + Diffusion Apply 3D kernel. This is the symmetric
+// SmemPADiffusionApply3D, with the values interpolated along with the
+// gradients: the value is contracted in z next to the z-derivative, and
+// projected back in x next to the x-derivative.
+template<int T_D1D = 0, int T_Q1D = 0>
+inline void SmemPAMassDiffusionApply3D(const int NE,
+                                       const Array<real_t> &b_,
+                                       const Array<real_t> &g_,
+                                       const Vector &m_,
+                                       const Vector &d_,
+                                       const Vector &x_,
+                                       Vector &y_,
+                                       const int d1d = 0,
+                                       const int q1d = 0)
+{
+   const int D1D = T_D1D ? T_D1D : d1d;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int max_q1d = T_Q1D ? T_Q1D : DeviceDofQuadLimits::Get().MAX_Q1D;
+   const int max_d1d = T_D1D ? T_D1D : DeviceDofQuadLimits::Get().MAX_D1D;
+   MFEM_VERIFY(D1D <= max_d1d, "");
+   MFEM_VERIFY(Q1D <= max_q1d, "");
+   auto b = Reshape(b_.Read(), Q1D, D1D);
+   auto g = Reshape(g_.Read(), Q1D, D1D);
+   auto m = Reshape(m_.Read(), Q1D, Q1D, Q1D, NE);
+   auto d = Reshape(d_.Read(), Q1D, Q1D, Q1D, 6, NE);
+   auto x = Reshape(x_.Read(), D1D, D1D, D1D, NE);
+   auto y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, NE);
+   MFEM_VERIFY(D1D <= Q1D, "THREAD_DIRECT requires D1D <= Q1D");
+   mfem::forall_3D(NE, Q1D, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int D1D = T_D1D ? T_D1D : d1d;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      constexpr int MD1 = T_D1D ? T_D1D : DofQuadLimits::MAX_D1D;
+      constexpr int MDQ = (MQ1 > MD1) ? MQ1 : MD1;
+      MFEM_SHARED real_t sBG[2][MQ1*MD1];
+      real_t (*B)[MD1] = (real_t (*)[MD1]) (sBG+0);
+      real_t (*G)[MD1] = (real_t (*)[MD1]) (sBG+1);
+      real_t (*Bt)[MQ1] = (real_t (*)[MQ1]) (sBG+0);
+      real_t (*Gt)[MQ1] = (real_t (*)[MQ1]) (sBG+1);
+      MFEM_SHARED real_t sm0[4][MDQ*MDQ*MDQ];
+      MFEM_SHARED real_t sm1[3][MDQ*MDQ*MDQ];
+      real_t (*X)[MD1][MD1]    = (real_t (*)[MD1][MD1]) (sm0+2);
+      real_t (*DDQ0)[MD1][MQ1] = (real_t (*)[MD1][MQ1]) (sm0+0);
+      real_t (*DDQ1)[MD1][MQ1] = (real_t (*)[MD1][MQ1]) (sm0+1);
+      real_t (*DQQ0)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm1+0);
+      real_t (*DQQ1)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm1+1);
+      real_t (*DQQ2)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm1+2);
+      real_t (*QQQ0)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm0+0);
+      real_t (*QQQ1)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm0+1);
+      real_t (*QQQ2)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm0+2);
+      real_t (*QQQ3)[MQ1][MQ1] = (real_t (*)[MQ1][MQ1]) (sm0+3);
+      real_t (*QQD0)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm1+0);
+      real_t (*QQD1)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm1+1);
+      real_t (*QQD2)[MQ1][MD1] = (real_t (*)[MQ1][MD1]) (sm1+2);
+      real_t (*QDD0)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm0+0);
+      real_t (*QDD1)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm0+1);
+      real_t (*QDD2)[MD1][MD1] = (real_t (*)[MD1][MD1]) (sm0+2);
+      MFEM_FOREACH_THREAD_DIRECT(dz,z,D1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(dx,x,D1D)
+            {
+               X[dz][dy][dx] = x(dx,dy,dz,e);
+            }
+         }
+      }
+      if (MFEM_THREAD_ID(z) == 0)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qx,x,Q1D)
+            {
+               B[qx][dy] = b(qx,dy);
+               G[qx][dy] = g(qx,dy);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD_DIRECT(dz,z,D1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qx,x,Q1D)
+            {
+               real_t u = 0.0, v = 0.0;
+               MFEM_UNROLL(MD1)
+               for (int dx = 0; dx < D1D; ++dx)
+               {
+                  const real_t coords = X[dz][dy][dx];
+                  u += coords * B[qx][dx];
+                  v += coords * G[qx][dx];
+               }
+               DDQ0[dz][dy][qx] = u;
+               DDQ1[dz][dy][qx] = v;
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD_DIRECT(dz,z,D1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qx,x,Q1D)
+            {
+               real_t u = 0.0, v = 0.0, w = 0.0;
+               MFEM_UNROLL(MD1)
+               for (int dy = 0; dy < D1D; ++dy)
+               {
+                  u += DDQ1[dz][dy][qx] * B[qy][dy];
+                  v += DDQ0[dz][dy][qx] * G[qy][dy];
+                  w += DDQ0[dz][dy][qx] * B[qy][dy];
+               }
+               DQQ0[dz][qy][qx] = u;
+               DQQ1[dz][qy][qx] = v;
+               DQQ2[dz][qy][qx] = w;
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD_DIRECT(qz,z,Q1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qx,x,Q1D)
+            {
+               real_t u = 0.0, v = 0.0, w = 0.0, s = 0.0;
+               MFEM_UNROLL(MD1)
+               for (int dz = 0; dz < D1D; ++dz)
+               {
+                  u += DQQ0[dz][qy][qx] * B[qz][dz];
+                  v += DQQ1[dz][qy][qx] * B[qz][dz];
+                  w += DQQ2[dz][qy][qx] * G[qz][dz];
+                  s += DQQ2[dz][qy][qx] * B[qz][dz];
+               }
+               const real_t O11 = d(qx,qy,qz,0,e);
+               const real_t O12 = d(qx,qy,qz,1,e);
+               const real_t O13 = d(qx,qy,qz,2,e);
+               const real_t O22 = d(qx,qy,qz,3,e);
+               const real_t O23 = d(qx,qy,qz,4,e);
+               const real_t O33 = d(qx,qy,qz,5,e);
+               const real_t gX = u;
+               const real_t gY = v;
+               const real_t gZ = w;
+               QQQ0[qz][qy][qx] = (O11*gX) + (O12*gY) + (O13*gZ);
+               QQQ1[qz][qy][qx] = (O12*gX) + (O22*gY) + (O23*gZ);
+               QQQ2[qz][qy][qx] = (O13*gX) + (O23*gY) + (O33*gZ);
+               QQQ3[qz][qy][qx] = m(qx,qy,qz,e) * s;
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      if (MFEM_THREAD_ID(z) == 0)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qx,x,Q1D)
+            {
+               Bt[dy][qx] = b(qx,dy);
+               Gt[dy][qx] = g(qx,dy);
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD_DIRECT(qz,z,Q1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qy,y,Q1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(dx,x,D1D)
+            {
+               real_t u = 0.0, v = 0.0, w = 0.0;
+               MFEM_UNROLL(MQ1)
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  u += QQQ0[qz][qy][qx] * Gt[dx][qx] +
+                       QQQ3[qz][qy][qx] * Bt[dx][qx];
+                  v += QQQ1[qz][qy][qx] * Bt[dx][qx];
+                  w += QQQ2[qz][qy][qx] * Bt[dx][qx];
+               }
+               QQD0[qz][qy][dx] = u;
+               QQD1[qz][qy][dx] = v;
+               QQD2[qz][qy][dx] = w;
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD_DIRECT(qz,z,Q1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(dx,x,D1D)
+            {
+               real_t u = 0.0, v = 0.0, w = 0.0;
+               MFEM_UNROLL(Q1D)
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  u += QQD0[qz][qy][dx] * Bt[dy][qy];
+                  v += QQD1[qz][qy][dx] * Gt[dy][qy];
+                  w += QQD2[qz][qy][dx] * Bt[dy][qy];
+               }
+               QDD0[qz][dy][dx] = u;
+               QDD1[qz][dy][dx] = v;
+               QDD2[qz][dy][dx] = w;
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      MFEM_FOREACH_THREAD_DIRECT(dz,z,D1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(dy,y,D1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(dx,x,D1D)
+            {
+               real_t u = 0.0, v = 0.0, w = 0.0;
+               MFEM_UNROLL(MQ1)
+               for (int qz = 0; qz < Q1D; ++qz)
+               {
+                  u += QDD0[qz][dy][dx] * Bt[dz][qz];
+                  v += QDD1[qz][dy][dx] * Bt[dz][qz];
+                  w += QDD2[qz][dy][dx] * Gt[dz][qz];
+               }
+               y(dx,dy,dz,e) += (u + v + w);
+            }
+         }
+      }
+   });
+}
+
+} // namespace internal
+
+template<int DIM, int T_D1D, int T_Q1D>
+FusedMassDiffusionPA::ApplyKernelType
+FusedMassDiffusionPA::ApplyPAKernels::Kernel()
+{
+   if constexpr (DIM == 2)
+   {
+      return internal::SmemPAMassDiffusionApply2D<T_D1D,T_Q1D>;
+   }
+   else if constexpr (DIM == 3)
+   {
+      return internal::SmemPAMassDiffusionApply3D<T_D1D,T_Q1D>;
+   }
+   MFEM_ABORT("");
+}
+
+FusedMassDiffusionPA::ApplyKernelType
+FusedMassDiffusionPA::ApplyPAKernels::Fallback(int DIM, int, int)
+{
+   if (DIM == 2) { return internal::SmemPAMassDiffusionApply2D; }
+   else if (DIM == 3) { return internal::SmemPAMassDiffusionApply3D; }
+   else { MFEM_ABORT(""); }
+}
+
+/// \endcond DO_NOT_DOCUMENT
+
+FusedMassDiffusionPA::Kernels::Kernels()
+{
+   // Default rules of both integrators on (multi)linear meshes, where they
+   // coincide: Q = D in 2D and Q = D+1 in 3D
+   FusedMassDiffusionPA::AddSpecialization<2,2,2>();
+   FusedMassDiffusionPA::AddSpecialization<2,3,3>();
+   FusedMassDiffusionPA::AddSpecialization<2,4,4>();
+   FusedMassDiffusionPA::AddSpecialization<2,5,5>();
+   FusedMassDiffusionPA::AddSpecialization<2,6,6>();
+   FusedMassDiffusionPA::AddSpecialization<2,7,7>();
+
+   FusedMassDiffusionPA::AddSpecialization<3,2,3>();
+   FusedMassDiffusionPA::AddSpecialization<3,3,4>();
+   FusedMassDiffusionPA::AddSpecialization<3,4,5>();
+   FusedMassDiffusionPA::AddSpecialization<3,5,6>();
+   FusedMassDiffusionPA::AddSpecialization<3,6,7>();
+   FusedMassDiffusionPA::AddSpecialization<3,7,8>();
+}
+
+bool FusedMassDiffusionPA::IsFaster(int dim, int d1d, int q1d)
+{
+   // Only measured on the CPU so far, see tests/benchmarks/bench_fused_pa.cpp
+   if (Device::Allows(Backend::DEVICE_MASK)) { return false; }
+   // The generic fallback kernel is not competitive: only consider the
+   // registered specializations
+   if (d1d < 2 || d1d > 7) { return false; }
+   if (q1d != d1d + (dim == 3 ? 1 : 0)) { return false; }
+   // In 2D the fused kernel is no faster for D1D = 5 (order 4)
+   return !(dim == 2 && d1d == 5);
+}
+
+bool FusedMassDiffusionPA::IsFaster() const
+{
+   MFEM_VERIFY(IsSetup(), "FusedMassDiffusionPA is not set up");
+   return IsFaster(mass->dim, mass->dofs1D, mass->quad1D);
+}
+
+bool FusedMassDiffusionPA::Setup(const MassIntegrator &mass_,
+                                 const DiffusionIntegrator &diff_)
+{
+   static Kernels kernels;
+   Reset();
+   if (DeviceCanUseCeed()) { return false; }
+   // Both integrators must have been assembled with the same tensor rule, the
+   // DofToQuad maps are cached by the finite element per integration rule
+   if (mass_.maps == nullptr || mass_.maps != diff_.maps) { return false; }
+   if (mass_.dim != diff_.dim || mass_.ne != diff_.ne) { return false; }
+   if (mass_.dim != 2 && mass_.dim != 3) { return false; }
+   if (!diff_.symmetric) { return false; }
+   if (mass_.pa_data_sp.Size() > 0 || diff_.pa_data_sp.Size() > 0)
+   {
+      return false;
+   }
+   const int dim = mass_.dim, NE = mass_.ne, Q1D = mass_.quad1D;
+   const int NQ = (dim == 2) ? Q1D*Q1D : Q1D*Q1D*Q1D;
+   MFEM_VERIFY(mass_.pa_data.Size() == NQ*NE &&
+               diff_.pa_data.Size() == NQ*((dim*(dim + 1))/2)*NE,
+               "the integrators must be partially assembled");
+   mass = &mass_;
+   diff = &diff_;
+   return true;
+}
+
+void FusedMassDiffusionPA::AddMult(const Vector &x, Vector &y) const
+{
+   MFEM_VERIFY(IsSetup(), "FusedMassDiffusionPA is not set up");
+   const int D1D = mass->dofs1D, Q1D = mass->quad1D;
+   ApplyPAKernels::Run(mass->dim, D1D, Q1D, mass->ne, mass->maps->B,
+                       mass->maps->G, mass->pa_data, diff->pa_data, x, y,
+                       D1D, Q1D);
+}
+
+} // namespace mfem
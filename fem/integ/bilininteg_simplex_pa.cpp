@@ -0,0 +1,1134 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../bilininteg.hpp"
+#include "bilininteg_simplex_pa.hpp"
+
+namespace mfem
+{
+
+static bool IsBernsteinSimplex(const FiniteElement &el)
+{
+   return dynamic_cast<const H1Pos_TriangleElement*>(&el) ||
+          dynamic_cast<const H1Pos_TetrahedronElement*>(&el) ||
+          dynamic_cast<const L2Pos_TriangleElement*>(&el) ||
+          dynamic_cast<const L2Pos_TetrahedronElement*>(&el);
+}
+
+bool BernsteinSimplexMaps::Supports(const FiniteElement &el)
+{
+   const Geometry::Type geom = el.GetGeomType();
+   const int p = el.GetOrder();
+   if (p < 1 ||
+       (geom != Geometry::TRIANGLE && geom != Geometry::TETRAHEDRON))
+   {
+      return false;
+   }
+   if (IsBernsteinSimplex(el)) { return true; }
+   // Nodal bases of the full polynomial space, through a change of basis
+   const int nd = (geom == Geometry::TRIANGLE) ? ((p + 1)*(p + 2))/2 :
+                  ((p + 1)*(p + 2)*(p + 3))/6;
+   return dynamic_cast<const NodalFiniteElement*>(&el) && el.GetDof() == nd;
+}
+
+const IntegrationRule *BernsteinSimplexMaps::Setup(const FiniteElement &el,
+                                                   int ir_order)
+{
+   Reset();
+   if (!Supports(el)) { return nullptr; }
+
+   const int dim = el.GetDim();
+   const IntegrationRule &ir = IntRules.GetCollapsed(el.GetGeomType(),
+                                                     ir_order);
+   const IntegrationRule &irs = IntRules.Get(Geometry::SEGMENT,
+                                             ir.GetOrder() + dim - 1);
+   const int p = el.GetOrder();
+   const int n = irs.GetNPoints();
+   MFEM_ASSERT(ir.GetNPoints() == (dim == 2 ? n*n : n*n*n), "");
+
+   B.SetSize((p + 1)*(p + 1)*n);
+   G.SetSize((p + 1)*(p + 1)*n);
+   points.SetSize(n);
+   auto h_B = Reshape(B.HostWrite(), p + 1, p + 1, n);
+   auto h_G = Reshape(G.HostWrite(), p + 1, p + 1, n);
+   Vector u(p + 1), d(p + 1);
+   for (int q = 0; q < n; q++)
+   {
+      const real_t t = irs.IntPoint(q).x;
+      points[q] = t;
+      for (int m = 0; m <= p; m++)
+      {
+         Poly_1D::CalcBernstein(m, t, u.GetData(), d.GetData());
+         for (int i = 0; i <= p; i++)
+         {
+            h_B(i,m,q) = (i <= m) ? u(i) : 0.0;
+            h_G(i,m,q) = (i <= m) ? d(i) : 0.0;
+         }
+      }
+   }
+
+   // The L2Pos simplices use the Bernstein ordering as their native ordering.
+   T.DeleteAll();
+   if (auto *tri = dynamic_cast<const H1Pos_TriangleElement*>(&el))
+   {
+      tri->GetDofMap().Copy(dof_map);
+   }
+   else if (auto *tet = dynamic_cast<const H1Pos_TetrahedronElement*>(&el))
+   {
+      tet->GetDofMap().Copy(dof_map);
+   }
+   else
+   {
+      dof_map.SetSize(el.GetDof());
+      for (int i = 0; i < dof_map.Size(); i++) { dof_map[i] = i; }
+   }
+
+   if (!IsBernsteinSimplex(el))
+   {
+      // The native basis function i is sum_k T(k,i) b_k, where b_k are the
+      // Bernstein polynomials, so T is the inverse of V(j,k) = b_k(x_j) at the
+      // nodes x_j of the element.
+      std::unique_ptr<FiniteElement> pos;
+      if (dim == 2) { pos.reset(new L2Pos_TriangleElement(p)); }
+      else { pos.reset(new L2Pos_TetrahedronElement(p)); }
+      const int nd = el.GetDof();
+      const IntegrationRule &nodes = el.GetNodes();
+      DenseMatrix V(nd);
+      Vector shape(nd);
+      for (int j = 0; j < nd; j++)
+      {
+         pos->CalcShape(nodes.IntPoint(j), shape);
+         V.SetRow(j, shape);
+      }
+      V.Invert();
+      T.SetSize(nd*nd);
+      std::copy(V.Data(), V.Data() + nd*nd, T.HostWrite());
+   }
+
+   order = p;
+   nqpt = n;
+   return &ir;
+}
+
+/// \cond DO_NOT_DOCUMENT
+
+namespace internal
+{
+
+// Bernstein (i,j) of the triangle is B(i,p-j,a) B(j,p,b): the mass action is
+// computed by contracting i (then j) for all points a (then b), and reversing
+// the contractions for the transpose, in O(p^3) operations per element.
+template<int T_P = 0, int T_Q1D = 0>
+void PABernsteinMassApply2D(const int NE,
+                            const Array<real_t> &b,
+                            const Array<int> &map,
+                            const Vector &d,
+                            const Vector &x,
+                            Vector &y,
+                            const int p = 0,
+                            const int q1d = 0)
+{
+   const int P = T_P ? T_P : p;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int ND = ((P + 1)*(P + 2))/2;
+   MFEM_VERIFY(P + 1 <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = Reshape(b.Read(), P + 1, P + 1, Q1D);
+   const auto M = map.Read();
+   const auto D = Reshape(d.Read(), Q1D, Q1D, NE);
+   const auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int P = T_P ? T_P : p;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MP1 = T_P ? T_P + 1 : DofQuadLimits::MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      real_t U[MP1][MQ1], V[MQ1];
+
+      for (int j = 0, o = 0; j <= P; o += P + 1 - j, j++)
+      {
+         for (int qa = 0; qa < Q1D; qa++) { U[j][qa] = 0.0; }
+         for (int i = 0; i <= P - j; i++)
+         {
+            const real_t c = X(M[o + i], e);
+            for (int qa = 0; qa < Q1D; qa++) { U[j][qa] += B(i,P-j,qa) * c; }
+         }
+      }
+      for (int qa = 0; qa < Q1D; qa++)
+      {
+         for (int qb = 0; qb < Q1D; qb++)
+         {
+            real_t u = 0.0;
+            for (int j = 0; j <= P; j++) { u += B(j,P,qb) * U[j][qa]; }
+            V[qb] = D(qa,qb,e) * u;
+         }
+         for (int j = 0; j <= P; j++)
+         {
+            real_t v = 0.0;
+            for (int qb = 0; qb < Q1D; qb++) { v += B(j,P,qb) * V[qb]; }
+            U[j][qa] = v;
+         }
+      }
+      for (int j = 0, o = 0; j <= P; o += P + 1 - j, j++)
+      {
+         for (int i = 0; i <= P - j; i++)
+         {
+            real_t v = 0.0;
+            for (int qa = 0; qa < Q1D; qa++) { v += B(i,P-j,qa) * U[j][qa]; }
+            Y(M[o + i], e) += v;
+         }
+      }
+   });
+}
+
+// Bernstein (i,j,k) of the tetrahedron is B(i,p-k-j,a) B(j,p-k,b) B(k,p,c),
+// giving three contractions of O(p^4) operations each per element.
+template<int T_P = 0, int T_Q1D = 0>
+void PABernsteinMassApply3D(const int NE,
+                            const Array<real_t> &b,
+                            const Array<int> &map,
+                            const Vector &d,
+                            const Vector &x,
+                            Vector &y,
+                            const int p = 0,
+                            const int q1d = 0)
+{
+   const int P = T_P ? T_P : p;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int ND = ((P + 1)*(P + 2)*(P + 3))/6;
+   MFEM_VERIFY(P + 1 <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = Reshape(b.Read(), P + 1, P + 1, Q1D);
+   const auto M = map.Read();
+   const auto D = Reshape(d.Read(), Q1D, Q1D, Q1D, NE);
+   const auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int P = T_P ? T_P : p;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MP1 = T_P ? T_P + 1 : DofQuadLimits::MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      real_t U[MP1][MP1][MQ1], V[MP1][MQ1][MQ1], W[MQ1];
+
+      for (int k = 0, o = 0; k <= P; k++)
+      {
+         for (int j = 0; j <= P - k; o += P + 1 - k - j, j++)
+         {
+            for (int qa = 0; qa < Q1D; qa++) { U[k][j][qa] = 0.0; }
+            for (int i = 0; i <= P - k - j; i++)
+            {
+               const real_t c = X(M[o + i], e);
+               for (int qa = 0; qa < Q1D; qa++)
+               {
+                  U[k][j][qa] += B(i,P-k-j,qa) * c;
+               }
+            }
+         }
+      }
+      for (int k = 0; k <= P; k++)
+      {
+         for (int qb = 0; qb < Q1D; qb++)
+         {
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               real_t u = 0.0;
+               for (int j = 0; j <= P - k; j++)
+               {
+                  u += B(j,P-k,qb) * U[k][j][qa];
+               }
+               V[k][qb][qa] = u;
+            }
+         }
+      }
+      for (int qb = 0; qb < Q1D; qb++)
+      {
+         for (int qa = 0; qa < Q1D; qa++)
+         {
+            for (int qc = 0; qc < Q1D; qc++)
+            {
+               real_t u = 0.0;
+               for (int k = 0; k <= P; k++) { u += B(k,P,qc) * V[k][qb][qa]; }
+               W[qc] = D(qa,qb,qc,e) * u;
+            }
+            for (int k = 0; k <= P; k++)
+            {
+               real_t v = 0.0;
+               for (int qc = 0; qc < Q1D; qc++) { v += B(k,P,qc) * W[qc]; }
+               V[k][qb][qa] = v;
+            }
+         }
+      }
+      for (int k = 0; k <= P; k++)
+      {
+         for (int j = 0; j <= P - k; j++)
+         {
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               real_t v = 0.0;
+               for (int qb = 0; qb < Q1D; qb++)
+               {
+                  v += B(j,P-k,qb) * V[k][qb][qa];
+               }
+               U[k][j][qa] = v;
+            }
+         }
+      }
+      for (int k = 0, o = 0; k <= P; k++)
+      {
+         for (int j = 0; j <= P - k; o += P + 1 - k - j, j++)
+         {
+            for (int i = 0; i <= P - k - j; i++)
+            {
+               real_t v = 0.0;
+               for (int qa = 0; qa < Q1D; qa++)
+               {
+                  v += B(i,P-k-j,qa) * U[k][j][qa];
+               }
+               Y(M[o + i], e) += v;
+            }
+         }
+      }
+   });
+}
+
+template<int T_P = 0, int T_Q1D = 0>
+void PABernsteinMassAssembleDiagonal2D(const int NE,
+                                       const Array<real_t> &b,
+                                       const Array<int> &map,
+                                       const Vector &d,
+                                       Vector &y,
+                                       const int p = 0,
+                                       const int q1d = 0)
+{
+   const int P = T_P ? T_P : p;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int ND = ((P + 1)*(P + 2))/2;
+   MFEM_VERIFY(P + 1 <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = Reshape(b.Read(), P + 1, P + 1, Q1D);
+   const auto M = map.Read();
+   const auto D = Reshape(d.Read(), Q1D, Q1D, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int P = T_P ? T_P : p;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      real_t T[MQ1];
+
+      for (int j = 0, o = 0; j <= P; o += P + 1 - j, j++)
+      {
+         for (int qa = 0; qa < Q1D; qa++)
+         {
+            T[qa] = 0.0;
+            for (int qb = 0; qb < Q1D; qb++)
+            {
+               T[qa] += B(j,P,qb) * B(j,P,qb) * D(qa,qb,e);
+            }
+         }
+         for (int i = 0; i <= P - j; i++)
+         {
+            real_t v = 0.0;
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               v += B(i,P-j,qa) * B(i,P-j,qa) * T[qa];
+            }
+            Y(M[o + i], e) += v;
+         }
+      }
+   });
+}
+
+template<int T_P = 0, int T_Q1D = 0>
+void PABernsteinMassAssembleDiagonal3D(const int NE,
+                                       const Array<real_t> &b,
+                                       const Array<int> &map,
+                                       const Vector &d,
+                                       Vector &y,
+                                       const int p = 0,
+                                       const int q1d = 0)
+{
+   const int P = T_P ? T_P : p;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int ND = ((P + 1)*(P + 2)*(P + 3))/6;
+   MFEM_VERIFY(P + 1 <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = Reshape(b.Read(), P + 1, P + 1, Q1D);
+   const auto M = map.Read();
+   const auto D = Reshape(d.Read(), Q1D, Q1D, Q1D, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int P = T_P ? T_P : p;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      real_t V[MQ1][MQ1], T[MQ1];
+
+      for (int k = 0, o = 0; k <= P; k++)
+      {
+         for (int qb = 0; qb < Q1D; qb++)
+         {
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               V[qb][qa] = 0.0;
+               for (int qc = 0; qc < Q1D; qc++)
+               {
+                  V[qb][qa] += B(k,P,qc) * B(k,P,qc) * D(qa,qb,qc,e);
+               }
+            }
+         }
+         for (int j = 0; j <= P - k; o += P + 1 - k - j, j++)
+         {
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               T[qa] = 0.0;
+               for (int qb = 0; qb < Q1D; qb++)
+               {
+                  T[qa] += B(j,P-k,qb) * B(j,P-k,qb) * V[qb][qa];
+               }
+            }
+            for (int i = 0; i <= P - k - j; i++)
+            {
+               real_t v = 0.0;
+               for (int qa = 0; qa < Q1D; qa++)
+               {
+                  v += B(i,P-k-j,qa) * B(i,P-k-j,qa) * T[qa];
+               }
+               Y(M[o + i], e) += v;
+            }
+         }
+      }
+   });
+}
+
+// Index of the entry (r,s) of the diffusion quadrature data, see
+// PADiffusionSetup2D() and PADiffusionSetup3D() for the layouts.
+MFEM_HOST_DEVICE inline int DiffusionIndex2D(bool symmetric, int r, int s)
+{
+   return symmetric ? r + s : r + 2*s;
+}
+
+MFEM_HOST_DEVICE inline int DiffusionIndex3D(bool symmetric, int r, int s)
+{
+   if (!symmetric) { return 3*r + s; }
+   const int lo = r < s ? r : s, hi = r < s ? s : r;
+   return lo == 0 ? hi : (lo == 1 ? hi + 2 : 5);
+}
+
+// The gradient is computed in the collapsed coordinates (a,b[,c]), where the
+// Bernstein polynomials are products of 1D polynomials, using the quadrature
+// data transformed by PABernsteinDiffusionCollapse().
+template<int T_P = 0, int T_Q1D = 0>
+void PABernsteinDiffusionApply2D(const int NE,
+                                 const bool symmetric,
+                                 const Array<real_t> &b,
+                                 const Array<real_t> &g,
+                                 const Array<int> &map,
+                                 const Vector &d,
+                                 const Vector &x,
+                                 Vector &y,
+                                 const int p = 0,
+                                 const int q1d = 0)
+{
+   const int P = T_P ? T_P : p;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int ND = ((P + 1)*(P + 2))/2;
+   MFEM_VERIFY(P + 1 <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = Reshape(b.Read(), P + 1, P + 1, Q1D);
+   const auto G = Reshape(g.Read(), P + 1, P + 1, Q1D);
+   const auto M = map.Read();
+   const auto D = Reshape(d.Read(), Q1D, Q1D, symmetric ? 3 : 4, NE);
+   const auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int P = T_P ? T_P : p;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MP1 = T_P ? T_P + 1 : DofQuadLimits::MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      // U0: value in a, U1: derivative in a
+      real_t U0[MP1][MQ1], U1[MP1][MQ1], Wa[MQ1], Wb[MQ1];
+
+      for (int j = 0, o = 0; j <= P; o += P + 1 - j, j++)
+      {
+         for (int qa = 0; qa < Q1D; qa++) { U0[j][qa] = U1[j][qa] = 0.0; }
+         for (int i = 0; i <= P - j; i++)
+         {
+            const real_t c = X(M[o + i], e);
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               U0[j][qa] += B(i,P-j,qa) * c;
+               U1[j][qa] += G(i,P-j,qa) * c;
+            }
+         }
+      }
+      for (int qa = 0; qa < Q1D; qa++)
+      {
+         for (int qb = 0; qb < Q1D; qb++)
+         {
+            real_t ga = 0.0, gb = 0.0;
+            for (int j = 0; j <= P; j++)
+            {
+               ga += B(j,P,qb) * U1[j][qa];
+               gb += G(j,P,qb) * U0[j][qa];
+            }
+            const real_t O11 = D(qa,qb,0,e);
+            const real_t O21 = D(qa,qb,1,e);
+            const real_t O12 = symmetric ? O21 : D(qa,qb,2,e);
+            const real_t O22 = symmetric ? D(qa,qb,2,e) : D(qa,qb,3,e);
+            Wa[qb] = O11 * ga + O12 * gb;
+            Wb[qb] = O21 * ga + O22 * gb;
+         }
+         for (int j = 0; j <= P; j++)
+         {
+            real_t u0 = 0.0, u1 = 0.0;
+            for (int qb = 0; qb < Q1D; qb++)
+            {
+               u0 += G(j,P,qb) * Wb[qb];
+               u1 += B(j,P,qb) * Wa[qb];
+            }
+            U0[j][qa] = u0;
+            U1[j][qa] = u1;
+         }
+      }
+      for (int j = 0, o = 0; j <= P; o += P + 1 - j, j++)
+      {
+         for (int i = 0; i <= P - j; i++)
+         {
+            real_t v = 0.0;
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               v += B(i,P-j,qa) * U0[j][qa] + G(i,P-j,qa) * U1[j][qa];
+            }
+            Y(M[o + i], e) += v;
+         }
+      }
+   });
+}
+
+template<int T_P = 0, int T_Q1D = 0>
+void PABernsteinDiffusionApply3D(const int NE,
+                                 const bool symmetric,
+                                 const Array<real_t> &b,
+                                 const Array<real_t> &g,
+                                 const Array<int> &map,
+                                 const Vector &d,
+                                 const Vector &x,
+                                 Vector &y,
+                                 const int p = 0,
+                                 const int q1d = 0)
+{
+   const int P = T_P ? T_P : p;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int ND = ((P + 1)*(P + 2)*(P + 3))/6;
+   MFEM_VERIFY(P + 1 <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = Reshape(b.Read(), P + 1, P + 1, Q1D);
+   const auto G = Reshape(g.Read(), P + 1, P + 1, Q1D);
+   const auto M = map.Read();
+   const auto D = Reshape(d.Read(), Q1D, Q1D, Q1D, symmetric ? 6 : 9, NE);
+   const auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int P = T_P ? T_P : p;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MP1 = T_P ? T_P + 1 : DofQuadLimits::MAX_D1D;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      // U0, V0: values; U1, Va: derivative in a; Vb: derivative in b
+      real_t U0[MP1][MP1][MQ1], U1[MP1][MP1][MQ1];
+      real_t V0[MP1][MQ1][MQ1], Va[MP1][MQ1][MQ1], Vb[MP1][MQ1][MQ1];
+      real_t W[3][MQ1];
+
+      for (int k = 0, o = 0; k <= P; k++)
+      {
+         for (int j = 0; j <= P - k; o += P + 1 - k - j, j++)
+         {
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               U0[k][j][qa] = U1[k][j][qa] = 0.0;
+            }
+            for (int i = 0; i <= P - k - j; i++)
+            {
+               const real_t c = X(M[o + i], e);
+               for (int qa = 0; qa < Q1D; qa++)
+               {
+                  U0[k][j][qa] += B(i,P-k-j,qa) * c;
+                  U1[k][j][qa] += G(i,P-k-j,qa) * c;
+               }
+            }
+         }
+      }
+      for (int k = 0; k <= P; k++)
+      {
+         for (int qb = 0; qb < Q1D; qb++)
+         {
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               real_t v0 = 0.0, va = 0.0, vb = 0.0;
+               for (int j = 0; j <= P - k; j++)
+               {
+                  v0 += B(j,P-k,qb) * U0[k][j][qa];
+                  va += B(j,P-k,qb) * U1[k][j][qa];
+                  vb += G(j,P-k,qb) * U0[k][j][qa];
+               }
+               V0[k][qb][qa] = v0;
+               Va[k][qb][qa] = va;
+               Vb[k][qb][qa] = vb;
+            }
+         }
+      }
+      for (int qb = 0; qb < Q1D; qb++)
+      {
+         for (int qa = 0; qa < Q1D; qa++)
+         {
+            for (int qc = 0; qc < Q1D; qc++)
+            {
+               real_t grad[3] = {0.0, 0.0, 0.0};
+               for (int k = 0; k <= P; k++)
+               {
+                  grad[0] += B(k,P,qc) * Va[k][qb][qa];
+                  grad[1] += B(k,P,qc) * Vb[k][qb][qa];
+                  grad[2] += G(k,P,qc) * V0[k][qb][qa];
+               }
+               for (int r = 0; r < 3; r++)
+               {
+                  W[r][qc] = 0.0;
+                  for (int s = 0; s < 3; s++)
+                  {
+                     const int rs = DiffusionIndex3D(symmetric, r, s);
+                     W[r][qc] += D(qa,qb,qc,rs,e) * grad[s];
+                  }
+               }
+            }
+            for (int k = 0; k <= P; k++)
+            {
+               real_t v0 = 0.0, va = 0.0, vb = 0.0;
+               for (int qc = 0; qc < Q1D; qc++)
+               {
+                  va += B(k,P,qc) * W[0][qc];
+                  vb += B(k,P,qc) * W[1][qc];
+                  v0 += G(k,P,qc) * W[2][qc];
+               }
+               V0[k][qb][qa] = v0;
+               Va[k][qb][qa] = va;
+               Vb[k][qb][qa] = vb;
+            }
+         }
+      }
+      for (int k = 0; k <= P; k++)
+      {
+         for (int j = 0; j <= P - k; j++)
+         {
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               real_t u0 = 0.0, u1 = 0.0;
+               for (int qb = 0; qb < Q1D; qb++)
+               {
+                  u0 += B(j,P-k,qb) * V0[k][qb][qa] +
+                        G(j,P-k,qb) * Vb[k][qb][qa];
+                  u1 += B(j,P-k,qb) * Va[k][qb][qa];
+               }
+               U0[k][j][qa] = u0;
+               U1[k][j][qa] = u1;
+            }
+         }
+      }
+      for (int k = 0, o = 0; k <= P; k++)
+      {
+         for (int j = 0; j <= P - k; o += P + 1 - k - j, j++)
+         {
+            for (int i = 0; i <= P - k - j; i++)
+            {
+               real_t v = 0.0;
+               for (int qa = 0; qa < Q1D; qa++)
+               {
+                  v += B(i,P-k-j,qa) * U0[k][j][qa] +
+                       G(i,P-k-j,qa) * U1[k][j][qa];
+               }
+               Y(M[o + i], e) += v;
+            }
+         }
+      }
+   });
+}
+
+// The collapsed gradient of Bernstein (i,j) is (B'(a) B(b), B(a) B'(b)), so
+// each term of the quadratic form can be contracted one direction at a time.
+template<int T_P = 0, int T_Q1D = 0>
+void PABernsteinDiffusionAssembleDiagonal2D(const int NE,
+                                            const bool symmetric,
+                                            const Array<real_t> &b,
+                                            const Array<real_t> &g,
+                                            const Array<int> &map,
+                                            const Vector &d,
+                                            Vector &y,
+                                            const int p = 0,
+                                            const int q1d = 0)
+{
+   const int P = T_P ? T_P : p;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int ND = ((P + 1)*(P + 2))/2;
+   MFEM_VERIFY(P + 1 <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = Reshape(b.Read(), P + 1, P + 1, Q1D);
+   const auto G = Reshape(g.Read(), P + 1, P + 1, Q1D);
+   const auto M = map.Read();
+   const auto D = Reshape(d.Read(), Q1D, Q1D, symmetric ? 3 : 4, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int P = T_P ? T_P : p;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      real_t Taa[MQ1], Tab[MQ1], Tbb[MQ1];
+
+      for (int j = 0, o = 0; j <= P; o += P + 1 - j, j++)
+      {
+         for (int qa = 0; qa < Q1D; qa++)
+         {
+            Taa[qa] = Tab[qa] = Tbb[qa] = 0.0;
+            for (int qb = 0; qb < Q1D; qb++)
+            {
+               const real_t O11 = D(qa,qb,0,e);
+               const real_t O21 = D(qa,qb,1,e);
+               const real_t O12 = symmetric ? O21 : D(qa,qb,2,e);
+               const real_t O22 = symmetric ? D(qa,qb,2,e) : D(qa,qb,3,e);
+               const real_t bj = B(j,P,qb), gj = G(j,P,qb);
+               Taa[qa] += bj * bj * O11;
+               Tab[qa] += bj * gj * (O12 + O21);
+               Tbb[qa] += gj * gj * O22;
+            }
+         }
+         for (int i = 0; i <= P - j; i++)
+         {
+            real_t v = 0.0;
+            for (int qa = 0; qa < Q1D; qa++)
+            {
+               const real_t bi = B(i,P-j,qa), gi = G(i,P-j,qa);
+               v += gi * gi * Taa[qa] + gi * bi * Tab[qa] + bi * bi * Tbb[qa];
+            }
+            Y(M[o + i], e) += v;
+         }
+      }
+   });
+}
+
+// Same as above with the six terms (r,s), r <= s, of the quadratic form in 3D,
+// where direction d of the gradient component r is differentiated iff r == d.
+template<int T_P = 0, int T_Q1D = 0>
+void PABernsteinDiffusionAssembleDiagonal3D(const int NE,
+                                            const bool symmetric,
+                                            const Array<real_t> &b,
+                                            const Array<real_t> &g,
+                                            const Array<int> &map,
+                                            const Vector &d,
+                                            Vector &y,
+                                            const int p = 0,
+                                            const int q1d = 0)
+{
+   const int P = T_P ? T_P : p;
+   const int Q1D = T_Q1D ? T_Q1D : q1d;
+   const int ND = ((P + 1)*(P + 2)*(P + 3))/6;
+   MFEM_VERIFY(P + 1 <= DeviceDofQuadLimits::Get().MAX_D1D, "");
+   MFEM_VERIFY(Q1D <= DeviceDofQuadLimits::Get().MAX_Q1D, "");
+   const auto B = Reshape(b.Read(), P + 1, P + 1, Q1D);
+   const auto G = Reshape(g.Read(), P + 1, P + 1, Q1D);
+   const auto M = map.Read();
+   const auto D = Reshape(d.Read(), Q1D, Q1D, Q1D, symmetric ? 6 : 9, NE);
+   auto Y = Reshape(y.ReadWrite(), ND, NE);
+   mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+   {
+      const int P = T_P ? T_P : p;
+      const int Q1D = T_Q1D ? T_Q1D : q1d;
+      constexpr int MQ1 = T_Q1D ? T_Q1D : DofQuadLimits::MAX_Q1D;
+      real_t V[MQ1][MQ1], T[MQ1];
+
+      for (int r = 0; r < 3; r++)
+      {
+         for (int s = r; s < 3; s++)
+         {
+            const int rs = DiffusionIndex3D(symmetric, r, s);
+            const int sr = DiffusionIndex3D(symmetric, s, r);
+            const real_t f = (r == s) ? 0.5 : 1.0;
+            for (int k = 0, o = 0; k <= P; k++)
+            {
+               for (int qb = 0; qb < Q1D; qb++)
+               {
+                  for (int qa = 0; qa < Q1D; qa++)
+                  {
+                     V[qb][qa] = 0.0;
+                     for (int qc = 0; qc < Q1D; qc++)
+                     {
+                        const real_t fr = (r == 2) ? G(k,P,qc) : B(k,P,qc);
+                        const real_t fs = (s == 2) ? G(k,P,qc) : B(k,P,qc);
+                        const real_t O = f * (D(qa,qb,qc,rs,e) +
+                                              D(qa,qb,qc,sr,e));
+                        V[qb][qa] += fr * fs * O;
+                     }
+                  }
+               }
+               for (int j = 0; j <= P - k; o += P + 1 - k - j, j++)
+               {
+                  for (int qa = 0; qa < Q1D; qa++)
+                  {
+                     T[qa] = 0.0;
+                     for (int qb = 0; qb < Q1D; qb++)
+                     {
+                        const real_t fr = (r == 1) ? G(j,P-k,qb) : B(j,P-k,qb);
+                        const real_t fs = (s == 1) ? G(j,P-k,qb) : B(j,P-k,qb);
+                        T[qa] += fr * fs * V[qb][qa];
+                     }
+                  }
+                  const int n = P - k - j;
+                  for (int i = 0; i <= n; i++)
+                  {
+                     real_t v = 0.0;
+                     for (int qa = 0; qa < Q1D; qa++)
+                     {
+                        const real_t fr = (r == 0) ? G(i,n,qa) : B(i,n,qa);
+                        const real_t fs = (s == 0) ? G(i,n,qa) : B(i,n,qa);
+                        v += fr * fs * T[qa];
+                     }
+                     Y(M[o + i], e) += v;
+                  }
+               }
+            }
+         }
+      }
+   });
+}
+
+using BernsteinMassApplyType = decltype(&PABernsteinMassApply2D<>);
+using BernsteinMassDiagonalType =
+   decltype(&PABernsteinMassAssembleDiagonal2D<>);
+using BernsteinDiffusionApplyType = decltype(&PABernsteinDiffusionApply2D<>);
+using BernsteinDiffusionDiagonalType =
+   decltype(&PABernsteinDiffusionAssembleDiagonal2D<>);
+
+// Dispatch on (dim, order, number of 1D quadrature points)
+MFEM_REGISTER_KERNELS(BernsteinMassApply, BernsteinMassApplyType,
+                      (int, int, int));
+MFEM_REGISTER_KERNELS(BernsteinMassDiagonal, BernsteinMassDiagonalType,
+                      (int, int, int));
+MFEM_REGISTER_KERNELS(BernsteinDiffusionApply, BernsteinDiffusionApplyType,
+                      (int, int, int));
+MFEM_REGISTER_KERNELS(BernsteinDiffusionDiagonal,
+                      BernsteinDiffusionDiagonalType, (int, int, int));
+
+template<int DIM, int P, int Q1D>
+BernsteinMassApplyType BernsteinMassApply::Kernel()
+{
+   if constexpr (DIM == 2) { return PABernsteinMassApply2D<P,Q1D>; }
+   else { return PABernsteinMassApply3D<P,Q1D>; }
+}
+
+BernsteinMassApplyType BernsteinMassApply::Fallback(int DIM, int, int)
+{
+   if (DIM == 2) { return PABernsteinMassApply2D; }
+   else { return PABernsteinMassApply3D; }
+}
+
+template<int DIM, int P, int Q1D>
+BernsteinMassDiagonalType BernsteinMassDiagonal::Kernel()
+{
+   if constexpr (DIM == 2) { return PABernsteinMassAssembleDiagonal2D<P,Q1D>; }
+   else { return PABernsteinMassAssembleDiagonal3D<P,Q1D>; }
+}
+
+BernsteinMassDiagonalType BernsteinMassDiagonal::Fallback(int DIM, int, int)
+{
+   if (DIM == 2) { return PABernsteinMassAssembleDiagonal2D; }
+   else { return PABernsteinMassAssembleDiagonal3D; }
+}
+
+template<int DIM, int P, int Q1D>
+BernsteinDiffusionApplyType BernsteinDiffusionApply::Kernel()
+{
+   if constexpr (DIM == 2) { return PABernsteinDiffusionApply2D<P,Q1D>; }
+   else { return PABernsteinDiffusionApply3D<P,Q1D>; }
+}
+
+BernsteinDiffusionApplyType BernsteinDiffusionApply::Fallback(int DIM, int,
+                                                              int)
+{
+   if (DIM == 2) { return PABernsteinDiffusionApply2D; }
+   else { return PABernsteinDiffusionApply3D; }
+}
+
+template<int DIM, int P, int Q1D>
+BernsteinDiffusionDiagonalType BernsteinDiffusionDiagonal::Kernel()
+{
+   if constexpr (DIM == 2)
+   {
+      return PABernsteinDiffusionAssembleDiagonal2D<P,Q1D>;
+   }
+   else { return PABernsteinDiffusionAssembleDiagonal3D<P,Q1D>; }
+}
+
+BernsteinDiffusionDiagonalType BernsteinDiffusionDiagonal::Fallback(int DIM,
+                                                                    int, int)
+{
+   if (DIM == 2) { return PABernsteinDiffusionAssembleDiagonal2D; }
+   else { return PABernsteinDiffusionAssembleDiagonal3D; }
+}
+
+template<int DIM, int P, int Q1D>
+static void AddBernsteinSpecialization()
+{
+   BernsteinMassApply::Specialization<DIM,P,Q1D>::Add();
+   BernsteinMassDiagonal::Specialization<DIM,P,Q1D>::Add();
+   BernsteinDiffusionApply::Specialization<DIM,P,Q1D>::Add();
+   BernsteinDiffusionDiagonal::Specialization<DIM,P,Q1D>::Add();
+}
+
+struct BernsteinKernels
+{
+   // Number of 1D points of the collapsed rules of the default orders of the
+   // MassIntegrator (Q=P+1 in 2D, P+2 in 3D) and of the DiffusionIntegrator
+   // (Q=P in 2D, P+1 in 3D) on affine meshes.
+   BernsteinKernels()
+   {
+      AddBernsteinSpecialization<2,1,1>();
+      AddBernsteinSpecialization<2,2,2>();
+      AddBernsteinSpecialization<2,3,3>();
+      AddBernsteinSpecialization<2,4,4>();
+      AddBernsteinSpecialization<2,1,2>();
+      AddBernsteinSpecialization<2,2,3>();
+      AddBernsteinSpecialization<2,3,4>();
+      AddBernsteinSpecialization<2,4,5>();
+
+      AddBernsteinSpecialization<3,1,2>();
+      AddBernsteinSpecialization<3,2,3>();
+      AddBernsteinSpecialization<3,3,4>();
+      AddBernsteinSpecialization<3,4,5>();
+      AddBernsteinSpecialization<3,1,3>();
+      AddBernsteinSpecialization<3,2,4>();
+      AddBernsteinSpecialization<3,3,5>();
+      AddBernsteinSpecialization<3,4,6>();
+   }
+};
+
+// Change of basis of the E-vector x from the native basis of a nodal element
+// to the Bernstein basis, y = T x, or y += T^t x if transpose, using |T| if
+// abs_T, see BernsteinSimplexMaps::T.
+static void BernsteinChangeOfBasis(const int NE,
+                                   const BernsteinSimplexMaps &maps,
+                                   const bool transpose, const bool abs_T,
+                                   const Vector &x, Vector &y)
+{
+   const int ND = maps.dof_map.Size();
+   const auto T = Reshape(maps.T.Read(), ND, ND);
+   const auto X = Reshape(x.Read(), ND, NE);
+   auto Y = Reshape(transpose ? y.ReadWrite() : y.Write(), ND, NE);
+   mfem::forall(ND*NE, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int k = idx % ND, e = idx / ND;
+      real_t v = 0.0;
+      for (int i = 0; i < ND; i++)
+      {
+         const real_t t = transpose ? T(i,k) : T(k,i);
+         v += (abs_T ? fabs(t) : t) * X(i,e);
+      }
+      if (transpose) { Y(k,e) += v; }
+      else { Y(k,e) = v; }
+   });
+}
+
+// Y += T^t A T X, where A(Xb,Yb) adds the action of a Bernstein kernel.
+template <typename apply_t>
+static void BernsteinNodalApply(const int NE, const BernsteinSimplexMaps &maps,
+                                const bool abs_T, const Vector &X, Vector &Y,
+                                apply_t &&A)
+{
+   if (maps.T.Size() == 0) { return A(X, Y); }
+   maps.tmp_x.SetSize(X.Size());
+   maps.tmp_y.SetSize(Y.Size());
+   maps.tmp_x.UseDevice(true);
+   maps.tmp_y.UseDevice(true);
+   BernsteinChangeOfBasis(NE, maps, false, abs_T, X, maps.tmp_x);
+   maps.tmp_y = 0.0;
+   A(maps.tmp_x, maps.tmp_y);
+   BernsteinChangeOfBasis(NE, maps, true, abs_T, maps.tmp_y, Y);
+}
+
+// Adds the diagonal of T^t A T to Y, one native basis function at a time, or
+// calls Diag(Y) for Bernstein elements.
+template <typename apply_t, typename diag_t>
+static void BernsteinNodalDiagonal(const int NE,
+                                   const BernsteinSimplexMaps &maps, Vector &Y,
+                                   apply_t &&A, diag_t &&Diag)
+{
+   if (maps.T.Size() == 0) { return Diag(Y); }
+   const int ND = maps.dof_map.Size();
+   maps.tmp_x.SetSize(ND*NE);
+   maps.tmp_y.SetSize(ND*NE);
+   maps.tmp_x.UseDevice(true);
+   maps.tmp_y.UseDevice(true);
+   for (int i = 0; i < ND; i++)
+   {
+      const auto T = Reshape(maps.T.Read(), ND, ND);
+      auto Xb = Reshape(maps.tmp_x.Write(), ND, NE);
+      mfem::forall(ND*NE, [=] MFEM_HOST_DEVICE (int idx)
+      {
+         Xb(idx % ND, idx / ND) = T(idx % ND, i);
+      });
+      maps.tmp_y = 0.0;
+      A(maps.tmp_x, maps.tmp_y);
+      const auto Yb = Reshape(maps.tmp_y.Read(), ND, NE);
+      auto D = Reshape(Y.ReadWrite(), ND, NE);
+      mfem::forall(NE, [=] MFEM_HOST_DEVICE (int e)
+      {
+         real_t v = 0.0;
+         for (int k = 0; k < ND; k++) { v += T(k,i) * Yb(k,e); }
+         D(i,e) += v;
+      });
+   }
+}
+
+void PABernsteinMassApply(const int dim, const int NE,
+                          const BernsteinSimplexMaps &maps,
+                          const Vector &D, const Vector &X, Vector &Y,
+                          const bool abs_T)
+{
+   static BernsteinKernels kernels;
+   const int p = maps.order, q1d = maps.nqpt;
+   BernsteinNodalApply(NE, maps, abs_T, X, Y,
+                       [&](const Vector &Xb, Vector &Yb)
+   {
+      BernsteinMassApply::Run(dim, p, q1d, NE, maps.B, maps.dof_map, D, Xb, Yb,
+                              p, q1d);
+   });
+}
+
+void PABernsteinMassAssembleDiagonal(const int dim, const int NE,
+                                     const BernsteinSimplexMaps &maps,
+                                     const Vector &D, Vector &Y)
+{
+   static BernsteinKernels kernels;
+   const int p = maps.order, q1d = maps.nqpt;
+   BernsteinNodalDiagonal(NE, maps, Y, [&](const Vector &Xb, Vector &Yb)
+   {
+      BernsteinMassApply::Run(dim, p, q1d, NE, maps.B, maps.dof_map, D, Xb, Yb,
+                              p, q1d);
+   },
+   [&](Vector &Yd)
+   {
+      BernsteinMassDiagonal::Run(dim, p, q1d, NE, maps.B, maps.dof_map, D, Yd,
+                                 p, q1d);
+   });
+}
+
+void PABernsteinDiffusionCollapse(const int dim, const int NE,
+                                  const bool symmetric,
+                                  const BernsteinSimplexMaps &maps,
+                                  Vector &d)
+{
+   const int Q1D = maps.nqpt;
+   const int NQ = (dim == 2) ? Q1D*Q1D : Q1D*Q1D*Q1D;
+   const int NC = symmetric ? (dim*(dim + 1))/2 : dim*dim;
+   const auto t = maps.points.Read();
+   auto D = Reshape(d.ReadWrite(), NQ, NC, NE);
+   mfem::forall(NQ*NE, [=] MFEM_HOST_DEVICE (int idx)
+   {
+      const int q = idx % NQ, e = idx / NQ;
+      const real_t a = t[q % Q1D];
+      const real_t b = t[(q / Q1D) % Q1D];
+      const real_t c = (dim == 2) ? 0.0 : t[q / (Q1D*Q1D)];
+      // Inverse of the Jacobian of (a,b) -> (a(1-b), b), resp. of
+      // (a,b,c) -> (a(1-b)(1-c), b(1-c), c); both are upper triangular.
+      real_t Ji[3][3] = {{0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 1.0}};
+      if (dim == 2)
+      {
+         Ji[0][0] = 1.0/(1.0 - b);
+         Ji[0][1] = a/(1.0 - b);
+         Ji[1][1] = 1.0;
+      }
+      else
+      {
+         Ji[0][0] = 1.0/((1.0 - b)*(1.0 - c));
+         Ji[0][1] = Ji[0][2] = a/((1.0 - b)*(1.0 - c));
+         Ji[1][1] = 1.0/(1.0 - c);
+         Ji[1][2] = b/(1.0 - c);
+      }
+      auto index = [=](int r, int s)
+      {
+         return dim == 2 ? DiffusionIndex2D(symmetric, r, s) :
+                DiffusionIndex3D(symmetric, r, s);
+      };
+      real_t O[3][3], JiO[3][3];
+      for (int r = 0; r < dim; r++)
+      {
+         for (int s = 0; s < dim; s++) { O[r][s] = D(q, index(r,s), e); }
+      }
+      for (int r = 0; r < dim; r++)
+      {
+         for (int s = 0; s < dim; s++)
+         {
+            JiO[r][s] = 0.0;
+            for (int l = r; l < dim; l++) { JiO[r][s] += Ji[r][l] * O[l][s]; }
+         }
+      }
+      for (int r = 0; r < dim; r++)
+      {
+         for (int s = symmetric ? r : 0; s < dim; s++)
+         {
+            real_t v = 0.0;
+            for (int l = s; l < dim; l++) { v += JiO[r][l] * Ji[s][l]; }
+            D(q, index(r,s), e) = v;
+         }
+      }
+   });
+}
+
+void PABernsteinDiffusionApply(const int dim, const int NE,
+                               const bool symmetric,
+                               const BernsteinSimplexMaps &maps,
+                               const Vector &D, const Vector &X, Vector &Y)
+{
+   static BernsteinKernels kernels;
+   const int p = maps.order, q1d = maps.nqpt;
+   BernsteinNodalApply(NE, maps, false, X, Y,
+                       [&](const Vector &Xb, Vector &Yb)
+   {
+      BernsteinDiffusionApply::Run(dim, p, q1d, NE, symmetric, maps.B, maps.G,
+                                   maps.dof_map, D, Xb, Yb, p, q1d);
+   });
+}
+
+void PABernsteinDiffusionAssembleDiagonal(const int dim, const int NE,
+                                          const bool symmetric,
+                                          const BernsteinSimplexMaps &maps,
+                                          const Vector &D, Vector &Y)
+{
+   static BernsteinKernels kernels;
+   const int p = maps.order, q1d = maps.nqpt;
+   BernsteinNodalDiagonal(NE, maps, Y, [&](const Vector &Xb, Vector &Yb)
+   {
+      BernsteinDiffusionApply::Run(dim, p, q1d, NE, symmetric, maps.B, maps.G,
+                                   maps.dof_map, D, Xb, Yb, p, q1d);
+   },
+   [&](Vector &Yd)
+   {
+      BernsteinDiffusionDiagonal::Run(dim, p, q1d, NE, symmetric, maps.B,
+                                      maps.G, maps.dof_map, D, Yd, p, q1d);
+   });
+}
+
+} // namespace internal
+
+/// \endcond DO_NOT_DOCUMENT
+
+} // namespace mfem
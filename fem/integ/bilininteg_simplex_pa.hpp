@@ -0,0 +1,65 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+#pragma once
+
+#include "../../config/config.hpp"
+#include "../../linalg/vector.hpp"
+#include "../bilininteg.hpp"
+
+namespace mfem
+{
+
+/// \cond DO_NOT_DOCUMENT
+
+namespace internal
+{
+
+// Sum-factorized PA kernels for Bernstein triangles and tetrahedra. The
+// quadrature data is given at the points of the collapsed rule, with layout
+// (n,n[,n],NE) for the mass and (n,n[,n],comp,NE) for the diffusion, see
+// BernsteinSimplexMaps and IntegrationRules::GetCollapsed(). For nodal
+// elements, X and Y are in the native basis and the kernels are applied
+// through the change of basis BernsteinSimplexMaps::T.
+
+// If abs_T, the absolute value of the change of basis is used, see
+// MassIntegrator::AddAbsMultPA().
+void PABernsteinMassApply(const int dim, const int NE,
+                          const BernsteinSimplexMaps &maps,
+                          const Vector &D, const Vector &X, Vector &Y,
+                          const bool abs_T = false);
+
+void PABernsteinMassAssembleDiagonal(const int dim, const int NE,
+                                     const BernsteinSimplexMaps &maps,
+                                     const Vector &D, Vector &Y);
+
+// Transform the diffusion quadrature data computed by PADiffusionSetup() from
+// reference to collapsed coordinates, i.e. replace D by Jc^{-1} D Jc^{-T},
+// where Jc is the Jacobian of the collapsing map.
+void PABernsteinDiffusionCollapse(const int dim, const int NE,
+                                  const bool symmetric,
+                                  const BernsteinSimplexMaps &maps,
+                                  Vector &D);
+
+void PABernsteinDiffusionApply(const int dim, const int NE,
+                               const bool symmetric,
+                               const BernsteinSimplexMaps &maps,
+                               const Vector &D, const Vector &X, Vector &Y);
+
+void PABernsteinDiffusionAssembleDiagonal(const int dim, const int NE,
+                                          const bool symmetric,
+                                          const BernsteinSimplexMaps &maps,
+                                          const Vector &D, Vector &Y);
+
+} // namespace internal
+
+/// \endcond DO_NOT_DOCUMENT
+
+} // namespace mfem
@@ -280,6 +280,7 @@ void VectorDiffusionIntegrator::AssemblePA(const FiniteElementSpace &fes)
       MFEM_ABORT("Unknown VectorDiffusionIntegrator::AssemblePA kernel for"
                  << " dim:" << dim << ", vdim:" << vdim << ", sdim:" << sdim);
    }
+   StorePADataSingle(pa_data, pa_data_sp);
 }
 
 // PA Diffusion Apply kernel
@@ -292,33 +293,39 @@ void VectorDiffusionIntegrator::AddMultPA(const Vector &x, Vector &y) const
    static const auto vector_diffusion_kernel_specializations =
       (
          // 2D, SDIM = 2
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,2, 2,2>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,2, 3,3>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,2, 4,4>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,2, 5,5>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,2, 6,6>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,2, 7,7>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,2, 8,8>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,2, 9,9>::Add(),
+         VectorDiffusionIntegrator::AddSpecialization<2,2, 2,2>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,2, 3,3>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,2, 4,4>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,2, 5,5>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,2, 6,6>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,2, 7,7>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,2, 8,8>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,2, 9,9>(),
          // 2D, SDIM = 3
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,3, 2,2>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,3, 3,3>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,3, 4,4>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<2,3, 5,5>::Add(),
+         VectorDiffusionIntegrator::AddSpecialization<2,3, 2,2>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,3, 3,3>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,3, 4,4>(),
+         VectorDiffusionIntegrator::AddSpecialization<2,3, 5,5>(),
          // 3D, SDIM = 3
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 2,2>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 2,3>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 3,4>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 4,5>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 4,6>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 5,6>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 5,8>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 6,7>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 7,8>::Add(),
-         VectorDiffusionIntegrator::ApplyPAKernels::Specialization<3,3, 8,9>::Add(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 2,2>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 2,3>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 3,4>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 4,5>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 4,6>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 5,6>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 5,8>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 6,7>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 7,8>(),
+         VectorDiffusionIntegrator::AddSpecialization<3,3, 8,9>(),
          true);
    MFEM_CONTRACT_VAR(vector_diffusion_kernel_specializations);
 
+   if (pa_data_sp.Size() > 0)
+   {
+      return ApplyMixedPAKernels::Run(dim, sdim, dofs1D, quad1D,
+                                      ne, coeff_vdim, maps->B, maps->G,
+                                      pa_data_sp, x, y, sdim, dofs1D, quad1D);
+   }
    ApplyPAKernels::Run(dim, sdim, dofs1D, quad1D,
                        ne, coeff_vdim, maps->B, maps->G, pa_data, x, y,
                        sdim, dofs1D, quad1D);
@@ -528,9 +535,12 @@ void VectorDiffusionIntegrator::AssembleDiagonalPA(Vector &diag)
    else
    {
       MFEM_VERIFY(!VQ && !MQ, "VQ and MQ not supported.");
+      Vector D_sp;
+      if (pa_data_sp.Size() > 0) { LoadPADataSingle(pa_data_sp, D_sp); }
+      const Vector &D = (pa_data_sp.Size() > 0) ? D_sp : pa_data;
       PAVectorDiffusionAssembleDiagonal(dim, dofs1D, quad1D, ne,
                                         maps->B, maps->G,
-                                        pa_data, diag);
+                                        D, diag);
    }
 }
 
@@ -28,12 +28,13 @@ namespace mfem
 namespace internal
 {
 
-template<int T_SDIM = 0, int T_D1D = 0, int T_Q1D = 0>
+template<int T_SDIM = 0, int T_D1D = 0, int T_Q1D = 0,
+         typename DataVector = Vector>
 void SmemPAVectorDiffusionApply2D(const int NE,
                                   const int coeff_vdim,
                                   const Array<real_t> &b,
                                   const Array<real_t> &g,
-                                  const Vector &d,
+                                  const DataVector &d,
                                   const Vector &x,
                                   Vector &y,
                                   const int sdim = 0,
@@ -92,12 +93,13 @@ void SmemPAVectorDiffusionApply2D(const int NE,
    });
 }
 
-template<int T_SDIM = 0, int T_D1D = 0, int T_Q1D = 0>
+template<int T_SDIM = 0, int T_D1D = 0, int T_Q1D = 0,
+         typename DataVector = Vector>
 void SmemPAVectorDiffusionApply3D(const int NE,
                                   const int coeff_vdim,
                                   const Array<real_t> &b,
                                   const Array<real_t> &g,
-                                  const Vector &d,
+                                  const DataVector &d,
                                   const Vector &x,
                                   Vector &y,
                                   const int sdim = 0,
@@ -197,6 +199,38 @@ VectorDiffusionIntegrator::ApplyPAKernels::Fallback(int dim, int sdim,
    else { MFEM_ABORT("Unsupported kernel"); }
 }
 
+template<int DIM, int T_SDIM, int T_D1D, int T_Q1D>
+VectorDiffusionIntegrator::ApplyMixedKernelType
+VectorDiffusionIntegrator::ApplyMixedPAKernels::Kernel()
+{
+   using DV = Array<float>;
+   if (DIM == 2)
+   {
+      return internal::SmemPAVectorDiffusionApply2D<T_SDIM, T_D1D, T_Q1D, DV>;
+   }
+   else if (DIM == 3)
+   {
+      return internal::SmemPAVectorDiffusionApply3D<T_SDIM, T_D1D, T_Q1D, DV>;
+   }
+   else { MFEM_ABORT("Unsupported kernel"); }
+}
+
+inline VectorDiffusionIntegrator::ApplyMixedKernelType
+VectorDiffusionIntegrator::ApplyMixedPAKernels::Fallback(int dim, int sdim,
+                                                         int d1d, int q1d)
+{
+   using DV = Array<float>;
+   if (dim == 2)
+   {
+      return internal::SmemPAVectorDiffusionApply2D<0, 0, 0, DV>;
+   }
+   else if (dim == 3)
+   {
+      return internal::SmemPAVectorDiffusionApply3D<0, 0, 0, DV>;
+   }
+   else { MFEM_ABORT("Unsupported kernel"); }
+}
+
 /// \endcond DO_NOT_DOCUMENT
 
 } // namespace mfem
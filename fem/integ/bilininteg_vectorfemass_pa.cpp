@@ -34,12 +34,14 @@ void VectorFEMassIntegrator::AssemblePA(const FiniteElementSpace &trial_fes,
    const FiniteElement *trial_fel = trial_fes.GetTypicalFE();
    const VectorTensorFiniteElement *trial_el =
       dynamic_cast<const VectorTensorFiniteElement*>(trial_fel);
-   MFEM_VERIFY(trial_el != NULL, "Only VectorTensorFiniteElement is supported!");
+   MFEM_VERIFY(trial_el != NULL, "Only VectorTensorFiniteElement is supported:"
+               " use AssemblyLevel::LEGACY on triangles and tetrahedra");
 
    const FiniteElement *test_fel = test_fes.GetTypicalFE();
    const VectorTensorFiniteElement *test_el =
       dynamic_cast<const VectorTensorFiniteElement*>(test_fel);
-   MFEM_VERIFY(test_el != NULL, "Only VectorTensorFiniteElement is supported!");
+   MFEM_VERIFY(test_el != NULL, "Only VectorTensorFiniteElement is supported:"
+               " use AssemblyLevel::LEGACY on triangles and tetrahedra");
 
    const IntegrationRule *ir
       = IntRule ? IntRule : &MassIntegrator::GetRule(*trial_el, *trial_el,
@@ -0,0 +1,895 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "../../general/forall.hpp"
+#include "../../linalg/dual.hpp"
+#include "../../linalg/tensor.hpp"
+#include "../nonlininteg.hpp"
+#include "../kernels.hpp"
+#include "../qspace.hpp"
+#include "../ceed/interface/util.hpp"
+
+namespace mfem
+{
+
+using future::tensor;
+using future::make_tensor;
+
+// Maximum number of 1D dofs and quadrature points supported by the kernels.
+static constexpr int HYPERELASTIC_MAX_1D = 8;
+
+// Cofactor matrix, cof(F) = det(F) F^{-T}.
+template <typename T> MFEM_HOST_DEVICE inline
+tensor<T, 2, 2> HyperelasticCofactor(const tensor<T, 2, 2> &F)
+{
+   return make_tensor<2, 2>([&](int i, int j)
+   {
+      return (i == j) ? F[1 - i][1 - j] : -F[1 - i][1 - j];
+   });
+}
+
+template <typename T> MFEM_HOST_DEVICE inline
+tensor<T, 3, 3> HyperelasticCofactor(const tensor<T, 3, 3> &F)
+{
+   return make_tensor<3, 3>([&](int i, int j)
+   {
+      const int i1 = (i + 1) % 3, i2 = (i + 2) % 3;
+      const int j1 = (j + 1) % 3, j2 = (j + 2) % 3;
+      return F[i1][j1] * F[i2][j2] - F[i1][j2] * F[i2][j1];
+   });
+}
+
+// Device version of NeoHookeanModel::EvalP(). The parameters are given at the
+// quadrature points, or as a single value (zero stride) when constant.
+struct NeoHookeanPA
+{
+   const real_t *mu, *K, *g;
+   int mu_s, K_s, g_s;
+
+   NeoHookeanPA(const Vector &mu_, const Vector &K_, const Vector &g_)
+      : mu(mu_.Read()), K(K_.Read()), g(g_.Read()),
+        mu_s(mu_.Size() > 1), K_s(K_.Size() > 1), g_s(g_.Size() > 1) { }
+
+   template <typename T, int DIM> MFEM_HOST_DEVICE
+   tensor<T, DIM, DIM> P(const tensor<T, DIM, DIM> &J, const int qe) const
+   {
+      const real_t mu_q = mu[mu_s*qe], K_q = K[K_s*qe], g_q = g[g_s*qe];
+      const T dJ = future::det(J);
+      const T a = mu_q * future::pow(dJ, -2.0_r/DIM);
+      const T b = K_q*(dJ/g_q - 1.0_r)/g_q - a*future::sqnorm(J)/(DIM*dJ);
+      return a*J + b*HyperelasticCofactor(J);
+   }
+};
+
+// Device version of InverseHarmonicModel::EvalP().
+struct InverseHarmonicPA
+{
+   template <typename T, int DIM> MFEM_HOST_DEVICE
+   tensor<T, DIM, DIM> P(const tensor<T, DIM, DIM> &J, const int) const
+   {
+      const auto Z = HyperelasticCofactor(J);
+      auto S = future::dot(Z, future::transpose(Z));
+      const T t = 0.5_r*future::tr(S);
+      for (int i = 0; i < DIM; i++) { S[i][i] = S[i][i] - t; }
+      const T dJ = future::det(J);
+      return (-1.0_r/(dJ*dJ)) * future::dot(S, Z);
+   }
+};
+
+// Calls f(m) where m is the device version of the given HyperelasticModel.
+template <typename F>
+static void HyperelasticModelPA(const HyperelasticModel *model,
+                                const Vector &mu, const Vector &K,
+                                const Vector &g, F &&f)
+{
+   if (dynamic_cast<const NeoHookeanModel *>(model))
+   {
+      f(NeoHookeanPA(mu, K, g));
+   }
+   else if (dynamic_cast<const InverseHarmonicModel *>(model))
+   {
+      f(InverseHarmonicPA());
+   }
+   else
+   {
+      MFEM_ABORT("PA is only supported for NeoHookeanModel and "
+                 "InverseHarmonicModel!");
+   }
+}
+
+// Returns w det(Jtr) P(Jpt) Jrt^T, where Jrt = Jtr^{-1} and Jpt = Jpr Jrt, i.e.
+// the flux that is integrated against the reference shape function gradients.
+template <typename MODEL, int DIM> MFEM_HOST_DEVICE inline
+tensor<real_t, DIM, DIM> HyperelasticFlux(const MODEL &model,
+                                          const tensor<real_t, DIM, DIM> &Jtr,
+                                          const tensor<real_t, DIM, DIM> &Jpr,
+                                          const real_t w, const int qe)
+{
+   const auto Jrt = future::inv(Jtr);
+   const auto P = model.P(future::dot(Jpr, Jrt), qe);
+   return (w * future::det(Jtr)) * future::dot(P, future::transpose(Jrt));
+}
+
+// Computes the derivative of HyperelasticFlux() with respect to Jpr,
+//    H(i,a,k,b) = w det(Jtr) sum_{j,l} Jrt(a,j) dP(i,j)/dJpt(k,l) Jrt(b,l),
+// with one forward-mode dual number evaluation of P per entry of Jpt.
+template <typename MODEL, int DIM> MFEM_HOST_DEVICE inline
+void HyperelasticFluxGrad(const MODEL &model,
+                          const tensor<real_t, DIM, DIM> &Jtr,
+                          const tensor<real_t, DIM, DIM> &Jpr,
+                          const real_t w, const int qe,
+                          real_t (&H)[DIM][DIM][DIM][DIM])
+{
+   using dual_t = future::dual<real_t, real_t>;
+   const auto Jrt = future::inv(Jtr);
+   const auto Jpt = future::dot(Jpr, Jrt);
+   const real_t weight = w * future::det(Jtr);
+   for (int i = 0; i < DIM; i++)
+   {
+      for (int a = 0; a < DIM; a++)
+      {
+         for (int k = 0; k < DIM; k++)
+         {
+            for (int b = 0; b < DIM; b++) { H[i][a][k][b] = 0.0; }
+         }
+      }
+   }
+   for (int k = 0; k < DIM; k++)
+   {
+      for (int l = 0; l < DIM; l++)
+      {
+         const auto dJpt = make_tensor<DIM, DIM>([&](int i, int j)
+         {
+            return dual_t{Jpt[i][j], (i == k && j == l) ? 1.0_r : 0.0_r};
+         });
+         const auto dP = model.P(dJpt, qe);
+         for (int i = 0; i < DIM; i++)
+         {
+            for (int a = 0; a < DIM; a++)
+            {
+               real_t dPJ = 0.0;
+               for (int j = 0; j < DIM; j++)
+               {
+                  dPJ += dP[i][j].gradient * Jrt[a][j];
+               }
+               for (int b = 0; b < DIM; b++)
+               {
+                  H[i][a][k][b] += weight * dPJ * Jrt[b][l];
+               }
+            }
+         }
+      }
+   }
+}
+
+// The derivative H(i,a,k,b) of the flux is the second derivative of the strain
+// energy, so it is symmetric with respect to the pairs (i,a) and (k,b). Only
+// its upper triangular part, with DIM^2 (DIM^2 + 1)/2 entries, is stored: this
+// returns the index of the entry of the pairs I = i + DIM a and J = k + DIM b.
+template <int DIM> MFEM_HOST_DEVICE inline
+int HyperelasticSymIndex(int I, int J)
+{
+   constexpr int N = DIM*DIM;
+   if (I > J) { const int t = I; I = J; J = t; }
+   return J + I*(2*N - I - 1)/2;
+}
+
+// PA hyperelastic residual 2D kernel
+template <typename MODEL>
+static void PAHyperelasticApply2D(const MODEL model,
+                                  const int NE,
+                                  const Array<real_t> &b_,
+                                  const Array<real_t> &g_,
+                                  const Array<real_t> &w_,
+                                  const Vector &j_,
+                                  const Vector &x_,
+                                  Vector &y_,
+                                  const int D1D,
+                                  const int Q1D)
+{
+   constexpr int DIM = 2;
+   const auto *b = b_.Read(), *g = g_.Read();
+   const auto W = Reshape(w_.Read(), Q1D, Q1D);
+   const auto J = Reshape(j_.Read(), Q1D, Q1D, DIM, DIM, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, DIM, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, DIM, NE);
+
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = HYPERELASTIC_MAX_1D;
+      MFEM_SHARED real_t smem[MQ1][MQ1];
+      MFEM_SHARED real_t sB[MQ1][MQ1], sG[MQ1][MQ1];
+      kernels::internal::vd_regs2d_t<DIM, DIM, MQ1> r0, r1;
+
+      kernels::internal::LoadMatrix(D1D, Q1D, b, sB);
+      kernels::internal::LoadMatrix(D1D, Q1D, g, sG);
+
+      kernels::internal::LoadDofs2d(e, D1D, X, r0);
+      kernels::internal::Grad2d(D1D, Q1D, smem, sB, sG, r0, r1);
+
+      MFEM_FOREACH_THREAD_DIRECT(qy, y, Q1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+         {
+            const int qe = qx + Q1D*(qy + Q1D*e);
+            const auto Jtr = make_tensor<DIM, DIM>([&](int i, int j)
+            { return J(qx, qy, i, j, e); });
+            const auto Jpr = make_tensor<DIM, DIM>([&](int i, int a)
+            { return r1[i][a][qy][qx]; });
+            const auto A = HyperelasticFlux(model, Jtr, Jpr, W(qx, qy), qe);
+            for (int i = 0; i < DIM; i++)
+            {
+               for (int a = 0; a < DIM; a++) { r0[i][a][qy][qx] = A[i][a]; }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      kernels::internal::GradTranspose2d(D1D, Q1D, smem, sB, sG, r0, r1);
+      kernels::internal::WriteDofs2d(e, D1D, r1, Y);
+   });
+}
+
+// PA hyperelastic residual 3D kernel
+template <typename MODEL>
+static void PAHyperelasticApply3D(const MODEL model,
+                                  const int NE,
+                                  const Array<real_t> &b_,
+                                  const Array<real_t> &g_,
+                                  const Array<real_t> &w_,
+                                  const Vector &j_,
+                                  const Vector &x_,
+                                  Vector &y_,
+                                  const int D1D,
+                                  const int Q1D)
+{
+   constexpr int DIM = 3;
+   const auto *b = b_.Read(), *g = g_.Read();
+   const auto W = Reshape(w_.Read(), Q1D, Q1D, Q1D);
+   const auto J = Reshape(j_.Read(), Q1D, Q1D, Q1D, DIM, DIM, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, D1D, DIM, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, DIM, NE);
+
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = HYPERELASTIC_MAX_1D;
+      MFEM_SHARED real_t smem[MQ1][MQ1];
+      MFEM_SHARED real_t sB[MQ1][MQ1], sG[MQ1][MQ1];
+      kernels::internal::vd_regs3d_t<DIM, DIM, MQ1> r0, r1;
+
+      kernels::internal::LoadMatrix(D1D, Q1D, b, sB);
+      kernels::internal::LoadMatrix(D1D, Q1D, g, sG);
+
+      kernels::internal::LoadDofs3d(e, D1D, X, r0);
+      kernels::internal::Grad3d(D1D, Q1D, smem, sB, sG, r0, r1);
+
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qy, y, Q1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+            {
+               const int qe = qx + Q1D*(qy + Q1D*(qz + Q1D*e));
+               const auto Jtr = make_tensor<DIM, DIM>([&](int i, int j)
+               { return J(qx, qy, qz, i, j, e); });
+               const auto Jpr = make_tensor<DIM, DIM>([&](int i, int a)
+               { return r1(i, a, qz, qy, qx); });
+               const auto A =
+                  HyperelasticFlux(model, Jtr, Jpr, W(qx, qy, qz), qe);
+               for (int i = 0; i < DIM; i++)
+               {
+                  for (int a = 0; a < DIM; a++)
+                  {
+                     r0(i, a, qz, qy, qx) = A[i][a];
+                  }
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      kernels::internal::GradTranspose3d(D1D, Q1D, smem, sB, sG, r0, r1);
+      kernels::internal::WriteDofs3d(e, D1D, r1, Y);
+   });
+}
+
+// PA hyperelastic gradient setup 2D kernel
+template <typename MODEL>
+static void PAHyperelasticGradSetup2D(const MODEL model,
+                                      const int NE,
+                                      const Array<real_t> &b_,
+                                      const Array<real_t> &g_,
+                                      const Array<real_t> &w_,
+                                      const Vector &j_,
+                                      const Vector &x_,
+                                      Vector &h_,
+                                      const int D1D,
+                                      const int Q1D)
+{
+   constexpr int DIM = 2;
+   const auto *b = b_.Read(), *g = g_.Read();
+   const auto W = Reshape(w_.Read(), Q1D, Q1D);
+   const auto J = Reshape(j_.Read(), Q1D, Q1D, DIM, DIM, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, DIM, NE);
+   constexpr int NS = DIM*DIM*(DIM*DIM + 1)/2;
+   auto H = Reshape(h_.Write(), NS, Q1D, Q1D, NE);
+
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = HYPERELASTIC_MAX_1D;
+      MFEM_SHARED real_t smem[MQ1][MQ1];
+      MFEM_SHARED real_t sB[MQ1][MQ1], sG[MQ1][MQ1];
+      kernels::internal::vd_regs2d_t<DIM, DIM, MQ1> r0, r1;
+
+      kernels::internal::LoadMatrix(D1D, Q1D, b, sB);
+      kernels::internal::LoadMatrix(D1D, Q1D, g, sG);
+
+      kernels::internal::LoadDofs2d(e, D1D, X, r0);
+      kernels::internal::Grad2d(D1D, Q1D, smem, sB, sG, r0, r1);
+
+      MFEM_FOREACH_THREAD_DIRECT(qy, y, Q1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+         {
+            const int qe = qx + Q1D*(qy + Q1D*e);
+            const auto Jtr = make_tensor<DIM, DIM>([&](int i, int j)
+            { return J(qx, qy, i, j, e); });
+            const auto Jpr = make_tensor<DIM, DIM>([&](int i, int a)
+            { return r1[i][a][qy][qx]; });
+            real_t h[DIM][DIM][DIM][DIM];
+            HyperelasticFluxGrad(model, Jtr, Jpr, W(qx, qy), qe, h);
+            for (int I = 0; I < DIM*DIM; I++)
+            {
+               for (int J = I; J < DIM*DIM; J++)
+               {
+                  const real_t hIJ = h[I%DIM][I/DIM][J%DIM][J/DIM];
+                  const real_t hJI = h[J%DIM][J/DIM][I%DIM][I/DIM];
+                  H(HyperelasticSymIndex<DIM>(I, J), qx, qy, e) =
+                     0.5*(hIJ + hJI);
+               }
+            }
+         }
+      }
+   });
+}
+
+// PA hyperelastic gradient setup 3D kernel
+template <typename MODEL>
+static void PAHyperelasticGradSetup3D(const MODEL model,
+                                      const int NE,
+                                      const Array<real_t> &b_,
+                                      const Array<real_t> &g_,
+                                      const Array<real_t> &w_,
+                                      const Vector &j_,
+                                      const Vector &x_,
+                                      Vector &h_,
+                                      const int D1D,
+                                      const int Q1D)
+{
+   constexpr int DIM = 3;
+   const auto *b = b_.Read(), *g = g_.Read();
+   const auto W = Reshape(w_.Read(), Q1D, Q1D, Q1D);
+   const auto J = Reshape(j_.Read(), Q1D, Q1D, Q1D, DIM, DIM, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, D1D, DIM, NE);
+   constexpr int NS = DIM*DIM*(DIM*DIM + 1)/2;
+   auto H = Reshape(h_.Write(), NS, Q1D, Q1D, Q1D, NE);
+
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = HYPERELASTIC_MAX_1D;
+      MFEM_SHARED real_t smem[MQ1][MQ1];
+      MFEM_SHARED real_t sB[MQ1][MQ1], sG[MQ1][MQ1];
+      kernels::internal::vd_regs3d_t<DIM, DIM, MQ1> r0, r1;
+
+      kernels::internal::LoadMatrix(D1D, Q1D, b, sB);
+      kernels::internal::LoadMatrix(D1D, Q1D, g, sG);
+
+      kernels::internal::LoadDofs3d(e, D1D, X, r0);
+      kernels::internal::Grad3d(D1D, Q1D, smem, sB, sG, r0, r1);
+
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qy, y, Q1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+            {
+               const int qe = qx + Q1D*(qy + Q1D*(qz + Q1D*e));
+               const auto Jtr = make_tensor<DIM, DIM>([&](int i, int j)
+               { return J(qx, qy, qz, i, j, e); });
+               const auto Jpr = make_tensor<DIM, DIM>([&](int i, int a)
+               { return r1(i, a, qz, qy, qx); });
+               real_t h[DIM][DIM][DIM][DIM];
+               HyperelasticFluxGrad(model, Jtr, Jpr, W(qx, qy, qz), qe, h);
+               for (int I = 0; I < DIM*DIM; I++)
+               {
+                  for (int J = I; J < DIM*DIM; J++)
+                  {
+                     const real_t hIJ = h[I%DIM][I/DIM][J%DIM][J/DIM];
+                     const real_t hJI = h[J%DIM][J/DIM][I%DIM][I/DIM];
+                     H(HyperelasticSymIndex<DIM>(I, J), qx, qy, qz, e) =
+                        0.5*(hIJ + hJI);
+                  }
+               }
+            }
+         }
+      }
+   });
+}
+
+// PA hyperelastic gradient action 2D kernel
+static void PAHyperelasticGradApply2D(const int NE,
+                                      const Array<real_t> &b_,
+                                      const Array<real_t> &g_,
+                                      const Vector &h_,
+                                      const Vector &x_,
+                                      Vector &y_,
+                                      const int D1D,
+                                      const int Q1D)
+{
+   constexpr int DIM = 2;
+   const auto *b = b_.Read(), *g = g_.Read();
+   constexpr int NS = DIM*DIM*(DIM*DIM + 1)/2;
+   const auto H = Reshape(h_.Read(), NS, Q1D, Q1D, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, DIM, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, DIM, NE);
+
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = HYPERELASTIC_MAX_1D;
+      MFEM_SHARED real_t smem[MQ1][MQ1];
+      MFEM_SHARED real_t sB[MQ1][MQ1], sG[MQ1][MQ1];
+      kernels::internal::vd_regs2d_t<DIM, DIM, MQ1> r0, r1;
+
+      kernels::internal::LoadMatrix(D1D, Q1D, b, sB);
+      kernels::internal::LoadMatrix(D1D, Q1D, g, sG);
+
+      kernels::internal::LoadDofs2d(e, D1D, X, r0);
+      kernels::internal::Grad2d(D1D, Q1D, smem, sB, sG, r0, r1);
+
+      MFEM_FOREACH_THREAD_DIRECT(qy, y, Q1D)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+         {
+            for (int i = 0; i < DIM; i++)
+            {
+               for (int a = 0; a < DIM; a++)
+               {
+                  real_t A = 0.0;
+                  for (int k = 0; k < DIM; k++)
+                  {
+                     for (int c = 0; c < DIM; c++)
+                     {
+                        const int hi = HyperelasticSymIndex<DIM>(i + DIM*a,
+                                                                 k + DIM*c);
+                        A += H(hi, qx, qy, e) * r1[k][c][qy][qx];
+                     }
+                  }
+                  r0[i][a][qy][qx] = A;
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      kernels::internal::GradTranspose2d(D1D, Q1D, smem, sB, sG, r0, r1);
+      kernels::internal::WriteDofs2d(e, D1D, r1, Y);
+   });
+}
+
+// PA hyperelastic gradient action 3D kernel
+static void PAHyperelasticGradApply3D(const int NE,
+                                      const Array<real_t> &b_,
+                                      const Array<real_t> &g_,
+                                      const Vector &h_,
+                                      const Vector &x_,
+                                      Vector &y_,
+                                      const int D1D,
+                                      const int Q1D)
+{
+   constexpr int DIM = 3;
+   const auto *b = b_.Read(), *g = g_.Read();
+   constexpr int NS = DIM*DIM*(DIM*DIM + 1)/2;
+   const auto H = Reshape(h_.Read(), NS, Q1D, Q1D, Q1D, NE);
+   const auto X = Reshape(x_.Read(), D1D, D1D, D1D, DIM, NE);
+   auto Y = Reshape(y_.ReadWrite(), D1D, D1D, D1D, DIM, NE);
+
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = HYPERELASTIC_MAX_1D;
+      MFEM_SHARED real_t smem[MQ1][MQ1];
+      MFEM_SHARED real_t sB[MQ1][MQ1], sG[MQ1][MQ1];
+      kernels::internal::vd_regs3d_t<DIM, DIM, MQ1> r0, r1;
+
+      kernels::internal::LoadMatrix(D1D, Q1D, b, sB);
+      kernels::internal::LoadMatrix(D1D, Q1D, g, sG);
+
+      kernels::internal::LoadDofs3d(e, D1D, X, r0);
+      kernels::internal::Grad3d(D1D, Q1D, smem, sB, sG, r0, r1);
+
+      for (int qz = 0; qz < Q1D; ++qz)
+      {
+         MFEM_FOREACH_THREAD_DIRECT(qy, y, Q1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+            {
+               for (int i = 0; i < DIM; i++)
+               {
+                  for (int a = 0; a < DIM; a++)
+                  {
+                     real_t A = 0.0;
+                     for (int k = 0; k < DIM; k++)
+                     {
+                        for (int c = 0; c < DIM; c++)
+                        {
+                           const int hi =
+                              HyperelasticSymIndex<DIM>(i + DIM*a, k + DIM*c);
+                           A += H(hi, qx, qy, qz, e) * r1(k, c, qz, qy, qx);
+                        }
+                     }
+                     r0(i, a, qz, qy, qx) = A;
+                  }
+               }
+            }
+         }
+      }
+      MFEM_SYNC_THREAD;
+      kernels::internal::GradTranspose3d(D1D, Q1D, smem, sB, sG, r0, r1);
+      kernels::internal::WriteDofs3d(e, D1D, r1, Y);
+   });
+}
+
+// PA hyperelastic gradient diagonal 2D kernel
+static void PAHyperelasticGradDiagonal2D(const int NE,
+                                         const Array<real_t> &b_,
+                                         const Array<real_t> &g_,
+                                         const Vector &h_,
+                                         Vector &d_,
+                                         const int D1D,
+                                         const int Q1D)
+{
+   constexpr int DIM = 2;
+   const auto B = Reshape(b_.Read(), Q1D, D1D);
+   const auto G = Reshape(g_.Read(), Q1D, D1D);
+   constexpr int NS = DIM*DIM*(DIM*DIM + 1)/2;
+   const auto H = Reshape(h_.Read(), NS, Q1D, Q1D, NE);
+   auto D = Reshape(d_.ReadWrite(), D1D, D1D, DIM, NE);
+
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = HYPERELASTIC_MAX_1D;
+      MFEM_SHARED real_t qd[DIM * DIM * MQ1 * MQ1];
+      DeviceTensor<4, real_t> QD(qd, DIM, DIM, MQ1, MQ1);
+
+      for (int v = 0; v < DIM; v++)
+      {
+         // Contract in y.
+         MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(dy, y, D1D)
+            {
+               for (int m = 0; m < DIM; m++)
+               {
+                  for (int n = 0; n < DIM; n++) { QD(m, n, qx, dy) = 0.0; }
+               }
+               for (int qy = 0; qy < Q1D; ++qy)
+               {
+                  const real_t By = B(qy, dy);
+                  const real_t Gy = G(qy, dy);
+                  for (int m = 0; m < DIM; m++)
+                  {
+                     for (int n = 0; n < DIM; n++)
+                     {
+                        const real_t L = (m == 1 ? Gy : By);
+                        const real_t R = (n == 1 ? Gy : By);
+                        const int hi = HyperelasticSymIndex<DIM>(v + DIM*m,
+                                                                 v + DIM*n);
+                        QD(m, n, qx, dy) += L * H(hi, qx, qy, e) * R;
+                     }
+                  }
+               }
+            }
+         }
+         MFEM_SYNC_THREAD;
+
+         // Contract in x.
+         MFEM_FOREACH_THREAD_DIRECT(dy, y, D1D)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(dx, x, D1D)
+            {
+               real_t d = 0.0;
+               for (int qx = 0; qx < Q1D; ++qx)
+               {
+                  const real_t Bx = B(qx, dx);
+                  const real_t Gx = G(qx, dx);
+                  for (int m = 0; m < DIM; m++)
+                  {
+                     for (int n = 0; n < DIM; n++)
+                     {
+                        const real_t L = (m == 0 ? Gx : Bx);
+                        const real_t R = (n == 0 ? Gx : Bx);
+                        d += L * QD(m, n, qx, dy) * R;
+                     }
+                  }
+               }
+               D(dx, dy, v, e) += d;
+            }
+         }
+         MFEM_SYNC_THREAD;
+      }
+   });
+}
+
+// PA hyperelastic gradient diagonal 3D kernel
+static void PAHyperelasticGradDiagonal3D(const int NE,
+                                         const Array<real_t> &b_,
+                                         const Array<real_t> &g_,
+                                         const Vector &h_,
+                                         Vector &d_,
+                                         const int D1D,
+                                         const int Q1D)
+{
+   constexpr int DIM = 3;
+   const auto B = Reshape(b_.Read(), Q1D, D1D);
+   const auto G = Reshape(g_.Read(), Q1D, D1D);
+   constexpr int NS = DIM*DIM*(DIM*DIM + 1)/2;
+   const auto H = Reshape(h_.Read(), NS, Q1D, Q1D, Q1D, NE);
+   auto D = Reshape(d_.ReadWrite(), D1D, D1D, D1D, DIM, NE);
+
+   mfem::forall_2D(NE, Q1D, Q1D, [=] MFEM_HOST_DEVICE (int e)
+   {
+      constexpr int MQ1 = HYPERELASTIC_MAX_1D;
+      MFEM_SHARED real_t smem[DIM][DIM][MQ1][MQ1];
+      kernels::internal::vd_regs3d_t<DIM, DIM, MQ1> r0, r1;
+
+      for (int v = 0; v < DIM; ++v)
+      {
+         // Contract in z.
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            MFEM_FOREACH_THREAD_DIRECT(qy, y, Q1D)
+            {
+               MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+               {
+                  for (int m = 0; m < DIM; m++)
+                  {
+                     for (int n = 0; n < DIM; n++)
+                     {
+                        r0(m, n, dz, qy, qx) = 0.0;
+                     }
+                  }
+                  for (int qz = 0; qz < Q1D; ++qz)
+                  {
+                     const real_t Bz = B(qz, dz), Gz = G(qz, dz);
+                     for (int m = 0; m < DIM; m++)
+                     {
+                        for (int n = 0; n < DIM; n++)
+                        {
+                           const real_t L = (m == 2 ? Gz : Bz);
+                           const real_t R = (n == 2 ? Gz : Bz);
+                           const int hi =
+                              HyperelasticSymIndex<DIM>(v + DIM*m, v + DIM*n);
+                           r0(m, n, dz, qy, qx) += L * H(hi, qx, qy, qz, e) * R;
+                        }
+                     }
+                  }
+               }
+            }
+            MFEM_SYNC_THREAD;
+         }
+
+         // Contract in y.
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            for (int m = 0; m < DIM; m++)
+            {
+               for (int n = 0; n < DIM; n++)
+               {
+                  MFEM_FOREACH_THREAD_DIRECT(qy, y, Q1D)
+                  {
+                     MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+                     {
+                        smem[m][n][qy][qx] = r0(m, n, dz, qy, qx);
+                     }
+                  }
+               }
+            }
+            MFEM_SYNC_THREAD;
+
+            MFEM_FOREACH_THREAD_DIRECT(dy, y, D1D)
+            {
+               MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+               {
+                  for (int m = 0; m < DIM; m++)
+                  {
+                     for (int n = 0; n < DIM; n++)
+                     {
+                        r1(m, n, dz, dy, qx) = 0.0;
+                     }
+                  }
+                  for (int qy = 0; qy < Q1D; ++qy)
+                  {
+                     const real_t By = B(qy, dy), Gy = G(qy, dy);
+                     for (int m = 0; m < DIM; m++)
+                     {
+                        for (int n = 0; n < DIM; n++)
+                        {
+                           const real_t L = (m == 1 ? Gy : By);
+                           const real_t R = (n == 1 ? Gy : By);
+                           r1(m, n, dz, dy, qx) += L * smem[m][n][qy][qx] * R;
+                        }
+                     }
+                  }
+               }
+            }
+            MFEM_SYNC_THREAD;
+         }
+
+         // Contract in x.
+         for (int dz = 0; dz < D1D; ++dz)
+         {
+            for (int m = 0; m < DIM; m++)
+            {
+               for (int n = 0; n < DIM; n++)
+               {
+                  MFEM_FOREACH_THREAD_DIRECT(dy, y, D1D)
+                  {
+                     MFEM_FOREACH_THREAD_DIRECT(qx, x, Q1D)
+                     {
+                        smem[m][n][dy][qx] = r1(m, n, dz, dy, qx);
+                     }
+                  }
+               }
+            }
+            MFEM_SYNC_THREAD;
+
+            MFEM_FOREACH_THREAD_DIRECT(dy, y, D1D)
+            {
+               MFEM_FOREACH_THREAD_DIRECT(dx, x, D1D)
+               {
+                  real_t d = 0.0;
+                  for (int qx = 0; qx < Q1D; ++qx)
+                  {
+                     const real_t Bx = B(qx, dx), Gx = G(qx, dx);
+                     for (int m = 0; m < DIM; m++)
+                     {
+                        for (int n = 0; n < DIM; n++)
+                        {
+                           const real_t L = (m == 0 ? Gx : Bx);
+                           const real_t R = (n == 0 ? Gx : Bx);
+                           d += L * smem[m][n][dy][qx] * R;
+                        }
+                     }
+                  }
+                  D(dx, dy, dz, v, e) += d;
+               }
+            }
+            MFEM_SYNC_THREAD;
+         }
+      }
+   });
+}
+
+void HyperelasticNLFIntegrator::AssemblePA(const FiniteElementSpace &fes)
+{
+   MFEM_VERIFY(!DeviceCanUseCeed(), "libCEED is not supported!");
+   MFEM_VERIFY(fes.GetOrdering() == Ordering::byNODES,
+               "PA Only supports Ordering::byNODES!");
+   Mesh *mesh = fes.GetMesh();
+   dim = mesh->Dimension();
+   MFEM_VERIFY(dim == 2 || dim == 3, "PA is only supported in 2D and 3D!");
+   MFEM_VERIFY(mesh->SpaceDimension() == dim && fes.GetVDim() == dim,
+               "The space must be a vector space of dimension dim!");
+   const FiniteElement &el = *fes.GetTypicalFE();
+   MFEM_VERIFY(dynamic_cast<const TensorBasisElement *>(&el) &&
+               !fes.IsVariableOrder(),
+               "PA requires tensor-product elements of uniform order!");
+   ElementTransformation &T = *mesh->GetTypicalElementTransformation();
+   pa_ir = GetIntegrationRule(el, T);
+   ne = mesh->GetNE();
+   nq = pa_ir->GetNPoints();
+   geom = mesh->GetGeometricFactors(*pa_ir, GeometricFactors::JACOBIANS,
+                                    pa_mt);
+   maps = &el.GetDofToQuad(*pa_ir, DofToQuad::TENSOR);
+   const int D1D = maps->ndof, Q1D = maps->nqpt;
+   MFEM_VERIFY(D1D <= HYPERELASTIC_MAX_1D && Q1D <= HYPERELASTIC_MAX_1D,
+               "Orders higher than " << HYPERELASTIC_MAX_1D - 1 <<
+               " are not supported!");
+
+   if (auto nh = dynamic_cast<NeoHookeanModel *>(model))
+   {
+      QuadratureSpace qs(*mesh, *pa_ir);
+      auto project = [&](Coefficient *c, real_t val, Vector &v)
+      {
+         CoefficientVector cv(qs, CoefficientStorage::COMPRESSED);
+         if (c) { cv.Project(*c); }
+         else { cv.SetConstant(val); }
+         v = cv;
+      };
+      project(nh->GetMuCoefficient(), nh->GetMu(), pa_mu);
+      project(nh->GetKCoefficient(), nh->GetK(), pa_K);
+      project(nh->GetGCoefficient(), nh->GetG(), pa_g);
+   }
+   else
+   {
+      MFEM_VERIFY(dynamic_cast<InverseHarmonicModel *>(model),
+                  "PA is only supported for NeoHookeanModel and "
+                  "InverseHarmonicModel!");
+   }
+}
+
+void HyperelasticNLFIntegrator::AddMultPA(const Vector &x, Vector &y) const
+{
+   const int D1D = maps->ndof, Q1D = maps->nqpt;
+   const Array<real_t> &B = maps->B, &G = maps->G;
+   const Array<real_t> &W = pa_ir->GetWeights();
+   HyperelasticModelPA(model, pa_mu, pa_K, pa_g, [&](const auto &m)
+   {
+      if (dim == 2)
+      {
+         PAHyperelasticApply2D(m, ne, B, G, W, geom->J, x, y, D1D, Q1D);
+      }
+      else
+      {
+         PAHyperelasticApply3D(m, ne, B, G, W, geom->J, x, y, D1D, Q1D);
+      }
+   });
+}
+
+void HyperelasticNLFIntegrator::AssembleGradPA(const Vector &x,
+                                               const FiniteElementSpace &fes)
+{
+   const int D1D = maps->ndof, Q1D = maps->nqpt;
+   const Array<real_t> &B = maps->B, &G = maps->G;
+   const Array<real_t> &W = pa_ir->GetWeights();
+   const int nsym = dim*dim*(dim*dim + 1)/2;
+   pa_grad.SetSize(nsym*nq*ne, Device::GetMemoryType());
+   HyperelasticModelPA(model, pa_mu, pa_K, pa_g, [&](const auto &m)
+   {
+      if (dim == 2)
+      {
+         PAHyperelasticGradSetup2D(m, ne, B, G, W, geom->J, x, pa_grad,
+                                   D1D, Q1D);
+      }
+      else
+      {
+         PAHyperelasticGradSetup3D(m, ne, B, G, W, geom->J, x, pa_grad,
+                                   D1D, Q1D);
+      }
+   });
+}
+
+void HyperelasticNLFIntegrator::AddMultGradPA(const Vector &x,
+                                              Vector &y) const
+{
+   const int D1D = maps->ndof, Q1D = maps->nqpt;
+   if (dim == 2)
+   {
+      PAHyperelasticGradApply2D(ne, maps->B, maps->G, pa_grad, x, y, D1D, Q1D);
+   }
+   else
+   {
+      PAHyperelasticGradApply3D(ne, maps->B, maps->G, pa_grad, x, y, D1D, Q1D);
+   }
+}
+
+void HyperelasticNLFIntegrator::AssembleGradDiagonalPA(Vector &diag) const
+{
+   const int D1D = maps->ndof, Q1D = maps->nqpt;
+   if (dim == 2)
+   {
+      PAHyperelasticGradDiagonal2D(ne, maps->B, maps->G, pa_grad, diag,
+                                   D1D, Q1D);
+   }
+   else
+   {
+      PAHyperelasticGradDiagonal3D(ne, maps->B, maps->G, pa_grad, diag,
+                                   D1D, Q1D);
+   }
+}
+
+} // namespace mfem
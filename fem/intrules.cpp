@@ -995,6 +995,12 @@ IntegrationRules::IntegrationRules(int ref, int type)
    CubeIntRules.SetSize(32, h_mt);
    CubeIntRules = NULL;
 
+   CollapsedTriangleIntRules.SetSize(32, h_mt);
+   CollapsedTriangleIntRules = NULL;
+
+   CollapsedTetrahedronIntRules.SetSize(32, h_mt);
+   CollapsedTetrahedronIntRules = NULL;
+
 #if defined(MFEM_THREAD_SAFE) && defined(MFEM_USE_OPENMP)
    IntRuleLocks.SetSize(Geometry::NUM_GEOMETRIES, h_mt);
    for (int i = 0; i < Geometry::NUM_GEOMETRIES; i++)
@@ -1091,6 +1097,58 @@ void IntegrationRules::Set(int GeomType, int Order, IntegrationRule &IntRule)
 #endif
 }
 
+const IntegrationRule &IntegrationRules::GetCollapsed(int GeomType, int Order)
+{
+   MFEM_VERIFY(GeomType == Geometry::TRIANGLE ||
+               GeomType == Geometry::TETRAHEDRON,
+               "collapsed rules are only defined for triangles and tetrahedra");
+   const bool tri = GeomType == Geometry::TRIANGLE;
+   Array<IntegrationRule *> &ir_array =
+      tri ? CollapsedTriangleIntRules : CollapsedTetrahedronIntRules;
+   if (Order < 0) { Order = 0; }
+
+   // The factors (1-b) and (1-b)(1-c)^2 of the Jacobian of the collapsing
+   // maps raise the degree of the integrand by one per dimension above 1.
+   const IntegrationRule &irs = Get(Geometry::SEGMENT, Order + (tri ? 1 : 2));
+   const int n = irs.GetNPoints();
+
+#if defined(MFEM_THREAD_SAFE) && defined(MFEM_USE_OPENMP)
+   omp_set_lock(&IntRuleLocks[GeomType]);
+#endif
+
+   if (!HaveIntRule(ir_array, Order))
+   {
+      IntegrationRule *ir = new IntegrationRule(tri ? n*n : n*n*n);
+      ir->SetOrder(Order);
+      for (int c = 0; c < (tri ? 1 : n); c++)
+      {
+         const real_t z = tri ? 0.0 : irs.IntPoint(c).x;
+         const real_t wz = tri ? 1.0 : irs.IntPoint(c).weight*(1.0-z)*(1.0-z);
+         for (int b = 0; b < n; b++)
+         {
+            const IntegrationPoint &ipb = irs.IntPoint(b);
+            for (int a = 0; a < n; a++)
+            {
+               const IntegrationPoint &ipa = irs.IntPoint(a);
+               IntegrationPoint &ip = ir->IntPoint(a + n*(b + n*c));
+               ip.x = ipa.x*(1.0 - ipb.x)*(1.0 - z);
+               ip.y = ipb.x*(1.0 - z);
+               ip.z = z;
+               ip.weight = ipa.weight*ipb.weight*(1.0 - ipb.x)*wz;
+            }
+         }
+      }
+      AllocIntRule(ir_array, Order);
+      ir_array[Order] = ir;
+   }
+
+#if defined(MFEM_THREAD_SAFE) && defined(MFEM_USE_OPENMP)
+   omp_unset_lock(&IntRuleLocks[GeomType]);
+#endif
+
+   return *ir_array[Order];
+}
+
 void IntegrationRules::DeleteIntRuleArray(
    Array<IntegrationRule *> &ir_array) const
 {
@@ -1126,6 +1184,8 @@ IntegrationRules::~IntegrationRules()
    DeleteIntRuleArray(CubeIntRules);
    DeleteIntRuleArray(PrismIntRules);
    DeleteIntRuleArray(PyramidIntRules);
+   DeleteIntRuleArray(CollapsedTriangleIntRules);
+   DeleteIntRuleArray(CollapsedTetrahedronIntRules);
 }
 
 
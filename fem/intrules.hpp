@@ -437,6 +437,9 @@ private:
    Array<IntegrationRule *> PrismIntRules;
    Array<IntegrationRule *> CubeIntRules;
 
+   Array<IntegrationRule *> CollapsedTriangleIntRules;
+   Array<IntegrationRule *> CollapsedTetrahedronIntRules;
+
 #if defined(MFEM_THREAD_SAFE) && defined(MFEM_USE_OPENMP)
    Array<omp_lock_t> IntRuleLocks;
 #endif
@@ -482,6 +485,17 @@ public:
 
    void Set(int GeomType, int Order, IntegrationRule &IntRule);
 
+   /** @brief Returns a collapsed-coordinate (Duffy) integration rule for the
+       triangle or the tetrahedron, exact for polynomials of degree @a Order.
+
+       The points are the images of the tensor product of n copies of the 1D
+       rule Get(Geometry::SEGMENT, Order + dim - 1) under the maps
+       (a,b) -> (a(1-b), b) and (a,b,c) -> (a(1-b)(1-c), b(1-c), c). Point
+       a + n*b (+ n*n*c) corresponds to the 1D points (a,b[,c]), so the rule
+       can be used by sum-factorized kernels, see e.g. the MassIntegrator and
+       the DiffusionIntegrator on H1Pos simplices. */
+   const IntegrationRule &GetCollapsed(int GeomType, int Order);
+
    void SetOwnRules(int o) { own_rules = o; }
 
    /// Destroys an IntegrationRules object
@@ -436,6 +436,61 @@ void NonlinearForm::Mult(const Vector &x, Vector &y) const
    // In parallel, the result is in 'py' which is an alias for 'aux2'.
 }
 
+void NonlinearForm::AddDomainGradColored(const Vector &px,
+                                         const Array<int> &attr_marker,
+                                         int skip_zeros) const
+{
+   MFEM_VERIFY(Grad && Grad->Finalized(), "the gradient must be finalized");
+
+   if (!Grad->ColumnsAreSorted()) { Grad->SortColumnIndices(); }
+   Grad->HostReadI();
+   Grad->HostReadJ();
+   Grad->HostReadWriteData();
+   px.HostRead();
+   for (int k = 0; k < dnfi.Size(); k++)
+   {
+      if (dnfi_marker[k]) { dnfi_marker[k]->HostRead(); }
+   }
+
+   const Mesh *mesh = fes->GetMesh();
+   const Table &colors = fes->GetElementColoring();
+   for (int c = 0; c < colors.Size(); c++)
+   {
+      const int *elements = colors.GetRow(c);
+      const int num_elements = colors.RowSize(c);
+      // Elements of the same color do not share any rows of the matrix
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp parallel for
+#endif
+      for (int e = 0; e < num_elements; e++)
+      {
+         const int i = elements[e];
+         const int attr = mesh->GetAttribute(i);
+         if (attr_marker[attr-1] == 0) { continue; }
+
+         Array<int> el_vdofs;
+         Vector el_x;
+         DenseMatrix elmat;
+         DofTransformation doftrans;
+         IsoparametricTransformation T;
+         const FiniteElement *fe = fes->GetFE(i);
+         fes->GetElementVDofs(i, el_vdofs, doftrans);
+         fes->GetElementTransformation(i, &T);
+         px.GetSubVector(el_vdofs, el_x);
+         doftrans.InvTransformPrimal(el_x);
+         for (int k = 0; k < dnfi.Size(); k++)
+         {
+            if (dnfi_marker[k] &&
+                (*dnfi_marker[k])[attr-1] == 0) { continue; }
+
+            dnfi[k]->AssembleElementGrad(*fe, T, el_x, elmat);
+            doftrans.TransformDual(elmat);
+            Grad->AddSubMatrixSorted(el_vdofs, el_vdofs, elmat, skip_zeros);
+         }
+      }
+   }
+}
+
 Operator &NonlinearForm::GetGradient(const Vector &x, bool finalize) const
 {
    if (ext)
@@ -492,6 +547,13 @@ Operator &NonlinearForm::GetGradient(const Vector &x, bool finalize) const
       }
 
       DofTransformation doftrans;
+      // Re-assembly into the existing sparsity pattern of Grad, in parallel
+      // with MFEM_USE_LEGACY_OPENMP
+      if (colored_grad && Grad->Finalized() && !fes->IsVariableOrder())
+      {
+         AddDomainGradColored(px, attr_marker, skip_zeros);
+      }
+      else
       for (int i = 0; i < fes->GetNE(); i++)
       {
          const int attr = mesh->GetAttribute(i);
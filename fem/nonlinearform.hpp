@@ -58,6 +58,9 @@ protected:
    /// Gradient Operator when not assembled as a matrix.
    mutable OperatorHandle hGrad; // has internal ownership flag
 
+   /// Re-assemble #Grad color by color, see EnableColoredGradient().
+   bool colored_grad;
+
    /// A list of all essential true dofs
    Array<int> ess_tdof_list;
 
@@ -75,6 +78,14 @@ protected:
    bool Serial() const { return (!P || cP); }
    const Vector &Prolongate(const Vector &x) const;
 
+   /** @brief Add the gradients of the domain integrators at @a px to the
+       finalized #Grad, processing the elements of each color of the element
+       coloring of the FiniteElementSpace in parallel (with
+       MFEM_USE_LEGACY_OPENMP). Requires integrators whose
+       AssembleElementGrad() is thread-safe, see EnableColoredGradient(). */
+   void AddDomainGradColored(const Vector &px, const Array<int> &attr_marker,
+                             int skip_zeros) const;
+
 public:
    /// Construct a NonlinearForm on the given FiniteElementSpace, @a f.
    /** As an Operator, the NonlinearForm has input and output size equal to the
@@ -82,7 +93,7 @@ public:
    NonlinearForm(FiniteElementSpace *f)
       : Operator(f->GetTrueVSize()), assembly(AssemblyLevel::LEGACY),
         ext(NULL), fes(f), extern_bfs(0), Grad(NULL), cGrad(NULL),
-        sequence(f->GetSequence()), P(f->GetProlongationMatrix()),
+        colored_grad(false), sequence(f->GetSequence()), P(f->GetProlongationMatrix()),
         cP(dynamic_cast<const SparseMatrix*>(P))
    { }
 
@@ -224,6 +235,20 @@ public:
    /** @see GetGradient(const Vector &) */
    Operator &GetGradient(const Vector &x, bool finalize) const;
 
+   /** @brief Re-assemble the gradient of the domain integrators color by
+       color, using the element coloring of the FiniteElementSpace. */
+   /** This is used by GetGradient() once the sparsity pattern of the gradient
+       is known, i.e. from its second call on, and not for variable order
+       spaces. With MFEM_USE_LEGACY_OPENMP, the elements of each color are
+       processed in parallel, calling AssembleElementGrad() of the same domain
+       integrator concurrently from several threads. Enable this only if all
+       domain integrators support that, e.g. HyperelasticNLFIntegrator. The
+       default is disabled. */
+   void EnableColoredGradient(bool enable = true) { colored_grad = enable; }
+
+   /// Return true if the gradient is re-assembled color by color.
+   bool ColoredGradientEnabled() const { return colored_grad; }
+
    /// Update the NonlinearForm to propagate updates of the associated FE space.
    /** After calling this method, the essential boundary conditions need to be
        set again. */
@@ -169,6 +169,9 @@ real_t BlockNonlinearFormIntegrator::GetElementEnergy(
 
 real_t InverseHarmonicModel::EvalW(const DenseMatrix &J) const
 {
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix Z;
+#endif
    Z.SetSize(J.Width());
    CalcAdjugateTranspose(J, Z);
    return 0.5*(Z*Z)/J.Det();
@@ -178,6 +181,9 @@ void InverseHarmonicModel::EvalP(const DenseMatrix &J, DenseMatrix &P) const
 {
    int dim = J.Width();
    real_t t;
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix Z, S;
+#endif
 
    Z.SetSize(dim);
    S.SetSize(dim);
@@ -199,6 +205,9 @@ void InverseHarmonicModel::AssembleH(
 {
    int dof = DS.Height(), dim = DS.Width();
    real_t t;
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix Z, S, G, C;
+#endif
 
    Z.SetSize(dim);
    S.SetSize(dim);
@@ -303,6 +312,9 @@ void NeoHookeanModel::EvalP(const DenseMatrix &J, DenseMatrix &P) const
       EvalCoeffs();
    }
 
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix Z;
+#endif
    Z.SetSize(dim);
    CalcAdjugateTranspose(J, Z);
 
@@ -325,6 +337,9 @@ void NeoHookeanModel::AssembleH(const DenseMatrix &J, const DenseMatrix &DS,
       EvalCoeffs();
    }
 
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix Z, G, C;
+#endif
    Z.SetSize(dim);
    G.SetSize(dof, dim);
    C.SetSize(dof, dim);
@@ -396,6 +411,9 @@ real_t HyperelasticNLFIntegrator::GetElementEnergy(const FiniteElement &el,
 {
    int dof = el.GetDof(), dim = el.GetDim();
    real_t energy;
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix DSh, Jrt, Jpr, Jpt, PMatI;
+#endif
 
    DSh.SetSize(dof, dim);
    Jrt.SetSize(dim);
@@ -428,6 +446,9 @@ void HyperelasticNLFIntegrator::AssembleElementVector(
    const Vector &elfun, Vector &elvect)
 {
    int dof = el.GetDof(), dim = el.GetDim();
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix DSh, DS, Jrt, Jpt, P, PMatI, PMatO;
+#endif
 
    DSh.SetSize(dof, dim);
    DS.SetSize(dof, dim);
@@ -469,6 +490,9 @@ void HyperelasticNLFIntegrator::AssembleElementGrad(const FiniteElement &el,
                                                     DenseMatrix &elmat)
 {
    int dof = el.GetDof(), dim = el.GetDim();
+#ifdef MFEM_THREAD_SAFE
+   DenseMatrix DSh, DS, Jrt, Jpt, PMatI;
+#endif
 
    DSh.SetSize(dof, dim);
    DS.SetSize(dof, dim);
@@ -484,7 +508,9 @@ void HyperelasticNLFIntegrator::AssembleElementGrad(const FiniteElement &el,
    }
 
    elmat = 0.0;
-   model->SetTransformation(Ttr);
+   // The transformation is set, and the model evaluated, by one thread at a
+   // time, unless the model can be shared between threads
+   const bool serial_model = !model->IsThreadSafe();
    for (int i = 0; i < ir->GetNPoints(); i++)
    {
       const IntegrationPoint &ip = ir->IntPoint(i);
@@ -495,7 +521,21 @@ void HyperelasticNLFIntegrator::AssembleElementGrad(const FiniteElement &el,
       Mult(DSh, Jrt, DS);
       MultAtB(PMatI, DS, Jpt);
 
-      model->AssembleH(Jpt, DS, ip.weight * Ttr.Weight(), elmat);
+      const real_t weight = ip.weight * Ttr.Weight();
+      if (serial_model)
+      {
+#ifdef MFEM_USE_LEGACY_OPENMP
+         #pragma omp critical (HyperelasticModel)
+#endif
+         {
+            model->SetTransformation(Ttr);
+            model->AssembleH(Jpt, DS, weight, elmat);
+         }
+      }
+      else
+      {
+         model->AssembleH(Jpt, DS, weight, elmat);
+      }
    }
 }
 
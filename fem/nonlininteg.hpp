@@ -213,6 +213,12 @@ public:
        point of interest. */
    void SetTransformation(ElementTransformation &Ttr_) { Ttr = &Ttr_; }
 
+   /** @brief Return true if EvalW(), EvalP() and AssembleH() can be called
+       concurrently from several threads, without SetTransformation(). */
+   /** This is the case if they do not use the transformation or any mutable
+       member data. The default implementation returns false. */
+   virtual bool IsThreadSafe() const { return false; }
+
    /** @brief Evaluate the strain energy density function, W = W(Jpt).
        @param[in] Jpt  Represents the target->physical transformation
                        Jacobian matrix. */
@@ -248,10 +254,16 @@ public:
 class InverseHarmonicModel : public HyperelasticModel
 {
 protected:
+#ifndef MFEM_THREAD_SAFE
    mutable DenseMatrix Z, S; // dim x dim
    mutable DenseMatrix G, C; // dof x dim
+#endif
 
 public:
+#ifdef MFEM_THREAD_SAFE
+   bool IsThreadSafe() const override { return true; }
+#endif
+
    real_t EvalW(const DenseMatrix &J) const override;
 
    void EvalP(const DenseMatrix &J, DenseMatrix &P) const override;
@@ -273,8 +285,10 @@ protected:
    Coefficient *c_mu, *c_K, *c_g;
    bool have_coeffs;
 
+#ifndef MFEM_THREAD_SAFE
    mutable DenseMatrix Z;    // dim x dim
    mutable DenseMatrix G, C; // dof x dim
+#endif
 
    inline void EvalCoeffs() const;
 
@@ -286,6 +300,25 @@ public:
       : mu(0.0), K(0.0), g(1.0), c_mu(&mu_), c_K(&K_), c_g(g_),
         have_coeffs(true) { }
 
+   /// Return the shear modulus coefficient, or NULL if it is constant.
+   Coefficient *GetMuCoefficient() const { return have_coeffs ? c_mu : NULL; }
+   /// Return the bulk modulus coefficient, or NULL if it is constant.
+   Coefficient *GetKCoefficient() const { return have_coeffs ? c_K : NULL; }
+   /// Return the volumetric scaling coefficient, or NULL if it is constant.
+   Coefficient *GetGCoefficient() const { return have_coeffs ? c_g : NULL; }
+
+   /// Return the constant shear modulus, used if GetMuCoefficient() is NULL.
+   real_t GetMu() const { return mu; }
+   /// Return the constant bulk modulus, used if GetKCoefficient() is NULL.
+   real_t GetK() const { return K; }
+   /// Return the constant volumetric scaling, used if GetGCoefficient() is NULL.
+   real_t GetG() const { return g; }
+
+#ifdef MFEM_THREAD_SAFE
+   /// The coefficients are evaluated into mutable members, using #Ttr.
+   bool IsThreadSafe() const override { return !have_coeffs; }
+#endif
+
    real_t EvalW(const DenseMatrix &J) const override;
 
    void EvalP(const DenseMatrix &J, DenseMatrix &P) const override;
@@ -317,7 +350,20 @@ private:
    // PMatI: coordinates of the deformed configuration (dof x dim).
    // PMatO: reshaped view into the local element contribution to the operator
    //        output - the result of AssembleElementVector() (dof x dim).
+#ifndef MFEM_THREAD_SAFE
    DenseMatrix DSh, DS, Jrt, Jpr, Jpt, P, PMatI, PMatO;
+#endif
+
+   // PA extension
+   const IntegrationRule *pa_ir;  ///< Not owned
+   const DofToQuad *maps;         ///< Not owned
+   const GeometricFactors *geom;  ///< Not owned
+   int dim, ne, nq;
+   // NeoHookeanModel parameters at the quadrature points (size 1 if constant)
+   Vector pa_mu, pa_K, pa_g;
+   // Gradient of the residual w.r.t. the reference derivatives of the state,
+   // at the quadrature points, scaled by the quadrature weights
+   Vector pa_grad;
 
 public:
    /** @param[in] m  HyperelasticModel that will be integrated. */
@@ -335,9 +381,34 @@ public:
                               ElementTransformation &Ttr,
                               const Vector &elfun, Vector &elvect) override;
 
+   /** @brief Assemble the local gradient matrix.
+
+       With MFEM_THREAD_SAFE, this method can be called concurrently from
+       several threads, e.g. by NonlinearForm::EnableColoredGradient(). The
+       HyperelasticModel is then evaluated in parallel if it is thread-safe
+       (see HyperelasticModel::IsThreadSafe()) and by one thread at a time
+       otherwise. */
    void AssembleElementGrad(const FiniteElement &el,
                             ElementTransformation &Ttr,
                             const Vector &elfun, DenseMatrix &elmat) override;
+
+   /** @name Partial assembly
+       Supported for NeoHookeanModel and InverseHarmonicModel on 2D and 3D
+       tensor-product meshes, with a vector space using Ordering::byNODES. The
+       gradient is computed with forward-mode dual numbers. */
+   ///@{
+   using NonlinearFormIntegrator::AssemblePA;
+   void AssemblePA(const FiniteElementSpace &fes) override;
+
+   void AddMultPA(const Vector &x, Vector &y) const override;
+
+   void AssembleGradPA(const Vector &x, const FiniteElementSpace &fes) override;
+
+   void AddMultGradPA(const Vector &x, Vector &y) const override;
+
+   void AssembleGradDiagonalPA(Vector &diag) const override;
+   ///@}
+
 protected:
    const IntegrationRule* GetDefaultIntegrationRule(
       const FiniteElement& trial_fe,
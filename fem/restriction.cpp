@@ -193,6 +193,70 @@ void ElementRestriction::AddMultTranspose(const Vector& x, Vector& y,
    TAddMultTranspose<ADD>(x, y);
 }
 
+void ElementRestriction::MultiMult(int nvec, const Vector& x, Vector& y) const
+{
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const int nv = nvec;
+   const bool t = byvdim;
+   MFEM_ASSERT(x.Size() >= nvec*width, "invalid x.Size() = " << x.Size());
+   MFEM_ASSERT(y.Size() >= nvec*height, "invalid y.Size() = " << y.Size());
+   auto d_x = Reshape(x.Read(), t?vd:ndofs, t?ndofs:vd, nv);
+   auto d_y = Reshape(y.Write(), nd, vd, ne, nv);
+   auto d_gather_map = gather_map.Read();
+   mfem::forall(dof*ne, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int gid = d_gather_map[i];
+      const bool plus = gid >= 0;
+      const int j = plus ? gid : -1-gid;
+      for (int v = 0; v < nv; ++v)
+      {
+         for (int c = 0; c < vd; ++c)
+         {
+            const real_t dof_value = d_x(t?c:j, t?j:c, v);
+            d_y(i % nd, c, i / nd, v) = plus ? dof_value : -dof_value;
+         }
+      }
+   });
+}
+
+void ElementRestriction::MultiMultTranspose(int nvec, const Vector& x,
+                                            Vector& y) const
+{
+   // Assumes all elements have the same number of dofs
+   const int nd = dof;
+   const int vd = vdim;
+   const int nv = nvec;
+   const bool t = byvdim;
+   MFEM_ASSERT(x.Size() >= nvec*height, "invalid x.Size() = " << x.Size());
+   MFEM_ASSERT(y.Size() >= nvec*width, "invalid y.Size() = " << y.Size());
+   auto d_offsets = offsets.Read();
+   auto d_indices = indices.Read();
+   auto d_x = Reshape(x.Read(), nd, vd, ne, nv);
+   auto d_y = Reshape(y.Write(), t?vd:ndofs, t?ndofs:vd, nv);
+   mfem::forall(ndofs, [=] MFEM_HOST_DEVICE (int i)
+   {
+      const int offset = d_offsets[i];
+      const int next_offset = d_offsets[i + 1];
+      for (int v = 0; v < nv; ++v)
+      {
+         for (int c = 0; c < vd; ++c)
+         {
+            real_t dof_value = 0;
+            for (int j = offset; j < next_offset; ++j)
+            {
+               const int idx = d_indices[j];
+               const int idx_j = (idx >= 0) ? idx : -1 - idx;
+               const real_t xj = d_x(idx_j % nd, c, idx_j / nd, v);
+               dof_value += (idx >= 0) ? xj : -xj;
+            }
+            d_y(t?c:i, t?i:c, v) = dof_value;
+         }
+      }
+   });
+}
+
 void ElementRestriction::AbsMultTranspose(const Vector& x, Vector& y) const
 {
    // Assumes all elements have the same number of dofs
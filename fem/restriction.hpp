@@ -58,6 +58,15 @@ public:
    void AddMultTranspose(const Vector &x, Vector &y,
                          const real_t a = 1.0) const override;
 
+   /** @brief Apply Mult() to the @a nvec L-vectors stored one after the other
+       in @a x, storing the E-vectors one after the other in @a y. */
+   /** The gather map is traversed only once for all vectors. */
+   void MultiMult(int nvec, const Vector &x, Vector &y) const;
+
+   /** @brief Apply MultTranspose() to the @a nvec E-vectors stored one after
+       the other in @a x, storing the L-vectors one after the other in @a y. */
+   void MultiMultTranspose(int nvec, const Vector &x, Vector &y) const;
+
    /// Compute Mult without applying signs based on DOF orientations.
    void AbsMult(const Vector &x, Vector &y) const override;
 
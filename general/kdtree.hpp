@@ -96,7 +96,8 @@ public:
    /// @brief Sorts the tree. Should be performed after adding points and before
    /// performing queries. See KDTree::Sort().
    virtual void Sort() = 0;
-   /// Returns the index of the closest point to @a xx.
+   /// @brief Returns the index of the closest point to @a xx. Safe to call
+   /// from multiple threads once the tree is sorted.
    virtual Tindex FindClosestPoint(const Tfloat *xx) const = 0;
    /// Virtual destructor.
    virtual ~KDTreeBase() { }
@@ -354,17 +355,18 @@ private:
       }
    };
 
-   mutable PointND tp; ///< Point for storing tmp data
    Tnorm fnorm;
 
-   /// Computes the distance between two nodes
+   /// Computes the distance between two nodes. The difference is stored in a
+   /// local point, so that the const queries can be called concurrently.
    Tfloat Dist(const PointND &pt1, const PointND &pt2) const
    {
+      Tfloat tp[ndim];
       for (size_t i=0; i<ndim; i++)
       {
-         tp.xx[i]=pt1.xx[i]-pt2.xx[i];
+         tp[i]=pt1.xx[i]-pt2.xx[i];
       }
-      return fnorm(tp.xx);
+      return fnorm(tp);
    }
 
    /// The point cloud is stored in a vector.
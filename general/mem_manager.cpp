@@ -17,6 +17,11 @@
 #include <unordered_map>
 #include <algorithm> // std::max
 #include <cstdint>
+#include <cstdlib> // std::malloc, std::free
+#include <cstddef> // std::max_align_t
+#include <atomic>
+#include <mutex>
+#include <vector>
 
 // Uncomment to try _WIN32 platform
 //#define _WIN32
@@ -185,9 +190,297 @@ struct Alias
    MemoryType h_mt;
 };
 
+/** @brief Thread-safe map from host pointers to the values @a V, sharded by
+    the pointer address.
+
+    The entries are distributed over #num_shards open addressing hash tables.
+    Find() and At() do not lock: they probe the current table of the shard
+    through atomic loads of the slot keys. Emplace(), Update() and Erase()
+    lock the mutex of the shard, so that threads registering and erasing
+    different pointers rarely contend for the same lock. Erased slots are
+    marked and reused by later insertions; when a table fills up, its live
+    entries are moved to a new table.
+
+    A lookup may still probe a replaced table, so the replaced tables are not
+    freed but kept as spares of the shard, to be reused by a later rehash.
+    Refilling a spare is guarded by a sequence counter of the shard, which a
+    lookup checks before and after probing: the lookups only read shared
+    memory. A shard keeps at most a few spares per capacity, so the spares use
+    about as much memory as the current tables.
+
+    The values are allocated separately from the tables, so the pointers
+    returned by Find(), At() and Emplace() stay valid until the entry is
+    erased. Concurrent accesses to the same entry, including its erasure, must
+    be synchronized by the caller. */
+template <typename V>
+class PtrMap
+{
+public:
+   static constexpr int num_shards = 64;
+
+private:
+   struct Slot
+   {
+      std::atomic<const void*> key{nullptr};
+      std::atomic<V*> value{nullptr};
+   };
+
+   struct Table
+   {
+      const int log_capacity;
+      const size_t capacity;
+      Slot *slots;
+
+      explicit Table(int log_cap)
+         : log_capacity(log_cap), capacity(size_t(1) << log_cap),
+           slots(new Slot[capacity]) { }
+      ~Table() { delete [] slots; }
+
+      /// First slot to probe for the hash @a h.
+      size_t Start(uint64_t h) const
+      { return size_t((h << 6) >> (64 - log_capacity)); }
+   };
+
+   struct alignas(64) Shard
+   {
+      std::atomic<Table*> table{nullptr};
+      /// Odd while a spare table is refilled, see Find()
+      std::atomic<unsigned> seq{0};
+      std::atomic<size_t> size{0}; ///< Number of entries
+      size_t used = 0; ///< Number of live and erased slots
+      std::vector<Table*> spares; ///< Replaced tables, may still be probed
+      std::mutex mutex; ///< Guards the modifications of the shard
+
+      ~Shard()
+      {
+         if (Table *t = table.load())
+         {
+            for (size_t i = 0; i < t->capacity; i++)
+            {
+               delete t->slots[i].value.load(std::memory_order_relaxed);
+            }
+            delete t;
+         }
+         for (Table *t : spares) { delete t; }
+      }
+   };
+   Shard shards[num_shards];
+
+   /// Key of the erased slots; it is never a valid host pointer.
+   static const void *Erased()
+   { return reinterpret_cast<const void*>(uintptr_t(1)); }
+
+   static uint64_t Hash(const void *ptr)
+   {
+      // Fibonacci hashing of the address, ignoring the low alignment bits; the
+      // top 6 bits select the shard and the next ones the slot
+      const uint64_t a = uint64_t(reinterpret_cast<uintptr_t>(ptr)) >> 4;
+      return a*UINT64_C(0x9E3779B97F4A7C15);
+   }
+   static_assert(num_shards == 64, "the shard index uses 6 bits");
+
+   /** @brief Return the slot of @a ptr in @a t, or, if it is not there, the
+       first free slot on its probe sequence. */
+   static Slot *Probe(const Table &t, const void *ptr, uint64_t h)
+   {
+      Slot *free_slot = nullptr;
+      for (size_t i = t.Start(h), n = 0; n < t.capacity;
+           i = (i + 1) & (t.capacity - 1), n++)
+      {
+         Slot &slot = t.slots[i];
+         const void *key = slot.key.load(std::memory_order_relaxed);
+         if (key == ptr) { return &slot; }
+         if (key == Erased()) { if (!free_slot) { free_slot = &slot; } }
+         else if (key == nullptr) { return free_slot ? free_slot : &slot; }
+      }
+      return free_slot;
+   }
+
+   /// Move the live entries of @a shard to a new table; the mutex is held.
+   static void Rehash(Shard &shard)
+   {
+      Table *old_t = shard.table.load(std::memory_order_relaxed);
+      const size_t size = shard.size.load(std::memory_order_relaxed);
+      int log_cap = 4;
+      while ((size_t(1) << log_cap) < 4*(size + 1)) { log_cap++; }
+      Table *t = nullptr;
+      const unsigned seq = shard.seq.load(std::memory_order_relaxed);
+      auto &spares = shard.spares;
+      for (size_t i = 0; i < spares.size(); i++)
+      {
+         if (spares[i]->log_capacity != log_cap) { continue; }
+         t = spares[i];
+         spares[i] = spares.back();
+         spares.pop_back();
+         // Lookups probing this table from before it was replaced will retry
+         shard.seq.store(seq + 1, std::memory_order_relaxed);
+         std::atomic_thread_fence(std::memory_order_release);
+         for (size_t j = 0; j < t->capacity; j++)
+         {
+            t->slots[j].key.store(nullptr, std::memory_order_relaxed);
+            t->slots[j].value.store(nullptr, std::memory_order_relaxed);
+         }
+         break;
+      }
+      if (!t) { t = new Table(log_cap); }
+      for (size_t i = 0; old_t && i < old_t->capacity; i++)
+      {
+         const void *key = old_t->slots[i].key.load(std::memory_order_relaxed);
+         if (key == nullptr || key == Erased()) { continue; }
+         Slot *slot = Probe(*t, key, Hash(key));
+         slot->value.store(old_t->slots[i].value.load(std::memory_order_relaxed),
+                           std::memory_order_relaxed);
+         slot->key.store(key, std::memory_order_relaxed);
+      }
+      shard.used = size;
+      shard.table.store(t, std::memory_order_release);
+      if (shard.seq.load(std::memory_order_relaxed) != seq)
+      {
+         shard.seq.store(seq + 2, std::memory_order_release);
+      }
+      if (old_t) { spares.push_back(old_t); }
+   }
+
+public:
+   /// Return a pointer to the value of @a ptr, or nullptr if it is not known.
+   V *Find(const void *ptr)
+   {
+      const uint64_t h = Hash(ptr);
+      const Shard &shard = shards[h >> 58];
+      while (true)
+      {
+         const unsigned seq = shard.seq.load(std::memory_order_acquire);
+         if (seq & 1) { continue; }
+         V *value = nullptr;
+         if (const Table *t = shard.table.load(std::memory_order_acquire))
+         {
+            for (size_t i = t->Start(h), n = 0; n < t->capacity;
+                 i = (i + 1) & (t->capacity - 1), n++)
+            {
+               const Slot &slot = t->slots[i];
+               const void *key = slot.key.load(std::memory_order_acquire);
+               if (key == ptr)
+               {
+                  value = slot.value.load(std::memory_order_acquire);
+                  break;
+               }
+               if (key == nullptr) { break; }
+            }
+         }
+         // Retry if a spare table was refilled in the meantime: the probed
+         // table may have been reused
+         std::atomic_thread_fence(std::memory_order_acquire);
+         if (shard.seq.load(std::memory_order_relaxed) == seq) { return value; }
+      }
+   }
+
+   /// Return the value of @a ptr, which must be known.
+   V &At(const void *ptr)
+   {
+      V *value = Find(ptr);
+      MFEM_VERIFY(value, "unknown pointer: " << ptr);
+      return *value;
+   }
+
+   /** @brief Insert @a value for @a ptr if it is not known; otherwise, call
+       @a update(existing value) under the lock of the shard. Return the value
+       in the map and whether it was inserted. */
+   template <typename F>
+   std::pair<V*, bool> Emplace(const void *ptr, const V &value, F &&update)
+   {
+      const uint64_t h = Hash(ptr);
+      Shard &shard = shards[h >> 58];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      Table *t = shard.table.load(std::memory_order_relaxed);
+      Slot *slot = t ? Probe(*t, ptr, h) : nullptr;
+      if (slot && slot->key.load(std::memory_order_relaxed) == ptr)
+      {
+         V *existing = slot->value.load(std::memory_order_relaxed);
+         update(*existing);
+         return std::make_pair(existing, false);
+      }
+      if (!t || 4*(shard.used + 1) > 3*t->capacity)
+      {
+         Rehash(shard);
+         t = shard.table.load(std::memory_order_relaxed);
+         slot = Probe(*t, ptr, h);
+      }
+      if (slot->key.load(std::memory_order_relaxed) == nullptr) { shard.used++; }
+      V *new_value = new V(value);
+      slot->value.store(new_value, std::memory_order_release);
+      slot->key.store(ptr, std::memory_order_release);
+      shard.size.fetch_add(1, std::memory_order_relaxed);
+      return std::make_pair(new_value, true);
+   }
+
+   /** @brief Insert @a value for @a ptr if it is not known; return the value
+       in the map and whether it was inserted. */
+   std::pair<V*, bool> Emplace(const void *ptr, const V &value)
+   { return Emplace(ptr, value, [](V&) { }); }
+
+   /** @brief Call @a f(value) for the entry of @a ptr under the lock of the
+       shard and erase the entry if it returns true. Return false if @a ptr is
+       not known. */
+   template <typename F>
+   bool Update(const void *ptr, F &&f)
+   {
+      const uint64_t h = Hash(ptr);
+      Shard &shard = shards[h >> 58];
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      Table *t = shard.table.load(std::memory_order_relaxed);
+      Slot *slot = t ? Probe(*t, ptr, h) : nullptr;
+      if (!slot || slot->key.load(std::memory_order_relaxed) != ptr)
+      {
+         return false;
+      }
+      V *value = slot->value.load(std::memory_order_relaxed);
+      if (f(*value))
+      {
+         slot->key.store(Erased(), std::memory_order_release);
+         slot->value.store(nullptr, std::memory_order_relaxed);
+         shard.size.fetch_sub(1, std::memory_order_relaxed);
+         delete value;
+      }
+      return true;
+   }
+
+   /// Erase the entry of @a ptr; return false if it is not known.
+   bool Erase(const void *ptr)
+   { return Update(ptr, [](V&) { return true; }); }
+
+   /// Return the total number of entries.
+   size_t Size() const
+   {
+      size_t size = 0;
+      for (const Shard &shard : shards)
+      {
+         size += shard.size.load(std::memory_order_relaxed);
+      }
+      return size;
+   }
+
+   /** @brief Call @a f(key, value) for all entries, locking one shard at a
+       time. @a f must not modify the map. */
+   template <typename F>
+   void ForEach(F &&f)
+   {
+      for (Shard &shard : shards)
+      {
+         std::lock_guard<std::mutex> lock(shard.mutex);
+         const Table *t = shard.table.load(std::memory_order_relaxed);
+         for (size_t i = 0; t && i < t->capacity; i++)
+         {
+            const void *key = t->slots[i].key.load(std::memory_order_relaxed);
+            if (key == nullptr || key == Erased()) { continue; }
+            f(key, *t->slots[i].value.load(std::memory_order_relaxed));
+         }
+      }
+   }
+};
+
 /// Maps for the Memory and the Alias classes
-typedef std::unordered_map<const void*, Memory> MemoryMap;
-typedef std::unordered_map<const void*, Alias> AliasMap;
+typedef PtrMap<Memory> MemoryMap;
+typedef PtrMap<Alias> AliasMap;
 
 struct Maps
 {
@@ -263,6 +556,217 @@ public:
    void Dealloc(void *ptr) override { mfem_aligned_free(ptr); }
 };
 
+/** @brief Thread-safe pool of host blocks, grouped in size classes.
+
+    The requested sizes are rounded up to one of four classes per power of two
+    (with a minimum of 64 bytes), so that the rounding wastes at most 25% of a
+    block. Freed blocks are first kept in a small cache of the calling thread,
+    and then in free lists shared by all threads. Each block starts with a
+    header storing its size class, which keeps the returned pointers aligned to
+    alignof(std::max_align_t). Requests above 2^max_log bytes bypass the pool.
+
+    The pool never returns memory to the system, except in Release(). */
+class HostPool
+{
+public:
+   static constexpr int min_log = 6, max_log = 28;
+   static constexpr int num_classes = 1 + 4*(max_log - min_log);
+   /// Largest class kept in the per-thread caches
+   static constexpr int max_thread_class = 1 + 4*(20 - min_log);
+   /// Maximum number of blocks per class in a per-thread cache
+   static constexpr int max_thread_blocks = 8;
+
+private:
+   struct Header { size_t bytes; int cls; };
+   static constexpr size_t header_bytes = alignof(std::max_align_t);
+   static_assert(sizeof(Header) <= header_bytes, "invalid header size");
+
+   std::mutex mutex;
+   std::vector<void*> free_blocks[num_classes];
+
+   std::atomic<size_t> allocations{0}, hits{0};
+   std::atomic<size_t> bytes_in_use{0}, peak_bytes{0}, bytes_cached{0};
+
+   struct ThreadCache
+   {
+      HostPool *pool = nullptr;
+      std::vector<void*> blocks[max_thread_class];
+      ~ThreadCache() { if (pool) { pool->Flush(*this); } }
+   };
+
+   static ThreadCache &GetThreadCache()
+   {
+      static thread_local ThreadCache cache;
+      return cache;
+   }
+
+   static int ILog2(size_t n)
+   {
+      int k = 0;
+      while (n >>= 1) { k++; }
+      return k;
+   }
+
+   static Header *GetHeader(void *ptr)
+   { return (Header*)((char*)ptr - header_bytes); }
+
+   void Flush(ThreadCache &cache)
+   {
+      std::lock_guard<std::mutex> lock(mutex);
+      for (int c = 0; c < max_thread_class; c++)
+      {
+         free_blocks[c].insert(free_blocks[c].end(), cache.blocks[c].begin(),
+                               cache.blocks[c].end());
+         cache.blocks[c].clear();
+      }
+   }
+
+   void AddInUse(size_t bytes)
+   {
+      const size_t in_use = bytes_in_use.fetch_add(bytes) + bytes;
+      size_t peak = peak_bytes.load(std::memory_order_relaxed);
+      while (in_use > peak &&
+             !peak_bytes.compare_exchange_weak(peak, in_use,
+                                               std::memory_order_relaxed)) { }
+   }
+
+public:
+   /// Return the size class of a block of @a bytes, or -1 if it is too large.
+   static int SizeClass(size_t bytes)
+   {
+      if (bytes <= (size_t(1) << min_log)) { return 0; }
+      const int k = ILog2(bytes - 1);
+      if (k >= max_log) { return -1; }
+      const int j = int((bytes - 1 - (size_t(1) << k)) >> (k - 2));
+      return 1 + 4*(k - min_log) + j;
+   }
+
+   /// Return the size in bytes of the blocks in the size class @a cls.
+   static size_t ClassBytes(int cls)
+   {
+      if (cls == 0) { return size_t(1) << min_log; }
+      const int k = min_log + (cls - 1)/4, j = (cls - 1) % 4;
+      return (size_t(1) << k) + (j + 1)*(size_t(1) << (k - 2));
+   }
+
+   void *Alloc(size_t bytes)
+   {
+      const int cls = SizeClass(bytes);
+      const size_t block_bytes = (cls < 0) ? bytes : ClassBytes(cls);
+      allocations.fetch_add(1, std::memory_order_relaxed);
+      void *ptr = nullptr;
+      if (cls >= 0 && cls < max_thread_class)
+      {
+         ThreadCache &cache = GetThreadCache();
+         if (!cache.blocks[cls].empty())
+         {
+            ptr = cache.blocks[cls].back();
+            cache.blocks[cls].pop_back();
+         }
+      }
+      if (!ptr && cls >= 0)
+      {
+         std::lock_guard<std::mutex> lock(mutex);
+         if (!free_blocks[cls].empty())
+         {
+            ptr = free_blocks[cls].back();
+            free_blocks[cls].pop_back();
+         }
+      }
+      if (ptr)
+      {
+         hits.fetch_add(1, std::memory_order_relaxed);
+         bytes_cached.fetch_sub(block_bytes, std::memory_order_relaxed);
+      }
+      else
+      {
+         char *raw = (char*)std::malloc(header_bytes + block_bytes);
+         if (!raw) { throw ::std::bad_alloc(); }
+         ptr = raw + header_bytes;
+         GetHeader(ptr)->bytes = block_bytes;
+         GetHeader(ptr)->cls = cls;
+      }
+      AddInUse(block_bytes);
+      return ptr;
+   }
+
+   void Dealloc(void *ptr)
+   {
+      if (!ptr) { return; }
+      const Header *header = GetHeader(ptr);
+      const int cls = header->cls;
+      const size_t block_bytes = header->bytes;
+      bytes_in_use.fetch_sub(block_bytes, std::memory_order_relaxed);
+      if (cls < 0) { std::free((char*)ptr - header_bytes); return; }
+      bytes_cached.fetch_add(block_bytes, std::memory_order_relaxed);
+      if (cls < max_thread_class)
+      {
+         ThreadCache &cache = GetThreadCache();
+         if (cache.blocks[cls].size() < max_thread_blocks)
+         {
+            cache.pool = this;
+            cache.blocks[cls].push_back(ptr);
+            return;
+         }
+      }
+      std::lock_guard<std::mutex> lock(mutex);
+      free_blocks[cls].push_back(ptr);
+   }
+
+   /// Free the cached blocks of the calling thread and of the shared pool.
+   void Release()
+   {
+      Flush(GetThreadCache());
+      std::lock_guard<std::mutex> lock(mutex);
+      for (int c = 0; c < num_classes; c++)
+      {
+         for (void *ptr : free_blocks[c])
+         {
+            bytes_cached.fetch_sub(ClassBytes(c), std::memory_order_relaxed);
+            std::free((char*)ptr - header_bytes);
+         }
+         free_blocks[c].clear();
+         free_blocks[c].shrink_to_fit();
+      }
+   }
+
+   MemoryManager::HostPoolStats GetStats() const
+   {
+      MemoryManager::HostPoolStats stats;
+      stats.allocations = allocations.load();
+      stats.hits = hits.load();
+      stats.bytes_in_use = bytes_in_use.load();
+      stats.peak_bytes = peak_bytes.load();
+      stats.bytes_cached = bytes_cached.load();
+      return stats;
+   }
+
+   void ResetStats()
+   {
+      allocations = 0;
+      hits = 0;
+      peak_bytes = bytes_in_use.load();
+   }
+
+   /// The pool used by MemoryType::HOST_POOL. It is never destroyed, so that
+   /// it outlives the objects that may return memory to it at exit.
+   static HostPool &Get()
+   {
+      static HostPool *pool = new HostPool;
+      return *pool;
+   }
+};
+
+/// The pooled host memory space, see HostPool
+class PoolHostMemorySpace : public HostMemorySpace
+{
+public:
+   PoolHostMemorySpace(): HostMemorySpace() { }
+   void Alloc(void **ptr, size_t bytes) override
+   { *ptr = HostPool::Get().Alloc(bytes); }
+   void Dealloc(void *ptr) override { HostPool::Get().Dealloc(ptr); }
+};
+
 #ifndef _WIN32
 static uintptr_t pagesize = 0;
 static uintptr_t pagemask = 0;
@@ -409,7 +913,7 @@ class MmuHostMemorySpace : public HostMemorySpace
 public:
    MmuHostMemorySpace(): HostMemorySpace() { MmuInit(); }
    void Alloc(void **ptr, size_t bytes) override { MmuAlloc(ptr, bytes); }
-   void Dealloc(void *ptr) override { MmuDealloc(ptr, maps->memories.at(ptr).bytes); }
+   void Dealloc(void *ptr) override { MmuDealloc(ptr, maps->memories.At(ptr).bytes); }
    void Protect(const Memory& mem, size_t bytes) override
    { if (mem.h_rw) { mem.h_rw = false; MmuProtect(mem.h_ptr, bytes); } }
    void Unprotect(const Memory &mem, size_t bytes) override
@@ -704,6 +1208,7 @@ public:
       host[static_cast<int>(MT::HOST)] = new StdHostMemorySpace();
       host[static_cast<int>(MT::HOST_32)] = new Aligned32HostMemorySpace();
       host[static_cast<int>(MT::HOST_64)] = new Aligned64HostMemorySpace();
+      host[static_cast<int>(MT::HOST_POOL)] = new PoolHostMemorySpace();
       // HOST_DEBUG is delayed, as it reroutes signals
       host[static_cast<int>(MT::HOST_DEBUG)] = nullptr;
       host[static_cast<int>(MT::HOST_UMPIRE)] = nullptr;
@@ -950,9 +1455,9 @@ void MemoryManager::SetDeviceMemoryType_(void *h_ptr, unsigned flags,
    MFEM_VERIFY(h_ptr, "cannot set the device memory type: Memory is empty!");
    if (!(flags & Mem::ALIAS))
    {
-      auto mem_iter = maps->memories.find(h_ptr);
-      MFEM_VERIFY(mem_iter != maps->memories.end(), "internal error");
-      internal::Memory &mem = mem_iter->second;
+      internal::Memory *mem_ptr = maps->memories.Find(h_ptr);
+      MFEM_VERIFY(mem_ptr, "internal error");
+      internal::Memory &mem = *mem_ptr;
       if (mem.d_mt == d_mt) { return; }
       MFEM_VERIFY(mem.d_ptr == nullptr, "cannot set the device memory type:"
                   " device memory is allocated!");
@@ -960,10 +1465,9 @@ void MemoryManager::SetDeviceMemoryType_(void *h_ptr, unsigned flags,
    }
    else
    {
-      auto alias_iter = maps->aliases.find(h_ptr);
-      MFEM_VERIFY(alias_iter != maps->aliases.end(), "internal error");
-      internal::Alias &alias = alias_iter->second;
-      internal::Memory &base_mem = *alias.mem;
+      internal::Alias *alias = maps->aliases.Find(h_ptr);
+      MFEM_VERIFY(alias, "internal error");
+      internal::Memory &base_mem = *alias->mem;
       if (base_mem.d_mt == d_mt) { return; }
       MFEM_VERIFY(base_mem.d_ptr == nullptr,
                   "cannot set the device memory type:"
@@ -995,7 +1499,7 @@ void MemoryManager::Delete_(void *h_ptr, MemoryType h_mt, unsigned flags)
       if (owns_internal)
       {
          MFEM_ASSERT(mm.IsAlias(h_ptr), "");
-         MFEM_ASSERT(h_mt == maps->aliases.at(h_ptr).h_mt, "");
+         MFEM_ASSERT(h_mt == maps->aliases.At(h_ptr).h_mt, "");
          mm.EraseAlias(h_ptr);
       }
    }
@@ -1006,7 +1510,7 @@ void MemoryManager::Delete_(void *h_ptr, MemoryType h_mt, unsigned flags)
       if (owns_internal)
       {
          MFEM_ASSERT(mm.IsKnown(h_ptr), "");
-         MFEM_ASSERT(h_mt == maps->memories.at(h_ptr).h_mt, "");
+         MFEM_ASSERT(h_mt == maps->memories.At(h_ptr).h_mt, "");
          mm.Erase(h_ptr, owns_device);
       }
    }
@@ -1022,6 +1526,31 @@ void MemoryManager::DeleteDevice_(void *h_ptr, unsigned & flags)
    }
 }
 
+void *MemoryManager::PoolNew_(size_t bytes)
+{
+   return internal::HostPool::Get().Alloc(bytes);
+}
+
+void MemoryManager::PoolDelete_(void *h_ptr)
+{
+   internal::HostPool::Get().Dealloc(h_ptr);
+}
+
+MemoryManager::HostPoolStats MemoryManager::GetHostPoolStats()
+{
+   return internal::HostPool::Get().GetStats();
+}
+
+void MemoryManager::ResetHostPoolStats()
+{
+   internal::HostPool::Get().ResetStats();
+}
+
+void MemoryManager::ReleaseHostPool()
+{
+   internal::HostPool::Get().Release();
+}
+
 bool MemoryManager::MemoryClassCheck_(MemoryClass mc, void *h_ptr,
                                       MemoryType h_mt, size_t bytes,
                                       unsigned flags)
@@ -1034,15 +1563,15 @@ bool MemoryManager::MemoryClassCheck_(MemoryClass mc, void *h_ptr,
    MemoryType d_mt;
    if (!(flags & Mem::ALIAS))
    {
-      auto iter = maps->memories.find(h_ptr);
-      MFEM_VERIFY(iter != maps->memories.end(), "internal error");
-      d_mt = iter->second.d_mt;
+      const internal::Memory *mem = maps->memories.Find(h_ptr);
+      MFEM_VERIFY(mem, "internal error");
+      d_mt = mem->d_mt;
    }
    else
    {
-      auto iter = maps->aliases.find(h_ptr);
-      MFEM_VERIFY(iter != maps->aliases.end(), "internal error");
-      d_mt = iter->second.mem->d_mt;
+      const internal::Alias *alias = maps->aliases.Find(h_ptr);
+      MFEM_VERIFY(alias, "internal error");
+      d_mt = alias->mem->d_mt;
    }
    if (d_mt == MemoryType::DEFAULT) { d_mt = GetDualMemoryType(h_mt); }
    switch (mc)
@@ -1179,14 +1708,14 @@ MemoryType MemoryManager::GetDeviceMemoryType_(void *h_ptr, bool alias)
    {
       if (!alias)
       {
-         auto iter = maps->memories.find(h_ptr);
-         MFEM_ASSERT(iter != maps->memories.end(), "internal error");
-         return iter->second.d_mt;
+         const internal::Memory *mem = maps->memories.Find(h_ptr);
+         MFEM_ASSERT(mem, "internal error");
+         return mem->d_mt;
       }
       // alias == true
-      auto iter = maps->aliases.find(h_ptr);
-      MFEM_ASSERT(iter != maps->aliases.end(), "internal error");
-      return iter->second.mem->d_mt;
+      const internal::Alias *alias = maps->aliases.Find(h_ptr);
+      MFEM_ASSERT(alias, "internal error");
+      return alias->mem->d_mt;
    }
    MFEM_ABORT("internal error");
    return MemoryManager::host_mem_type;
@@ -1195,8 +1724,8 @@ MemoryType MemoryManager::GetDeviceMemoryType_(void *h_ptr, bool alias)
 MemoryType MemoryManager::GetHostMemoryType_(void *h_ptr)
 {
    if (!mm.exists) { return MemoryManager::host_mem_type; }
-   if (mm.IsKnown(h_ptr)) { return maps->memories.at(h_ptr).h_mt; }
-   if (mm.IsAlias(h_ptr)) { return maps->aliases.at(h_ptr).h_mt; }
+   if (const auto *mem = maps->memories.Find(h_ptr)) { return mem->h_mt; }
+   if (const auto *alias = maps->aliases.Find(h_ptr)) { return alias->h_mt; }
    return MemoryManager::host_mem_type;
 }
 
@@ -1252,8 +1781,8 @@ void MemoryManager::Copy_(void *dst_h_ptr, const void *src_h_ptr,
          if (dst_h_ptr != src_d_ptr && bytes != 0)
          {
             MemoryType src_d_mt = (src_flags & Mem::ALIAS) ?
-                                  maps->aliases.at(src_h_ptr).mem->d_mt :
-                                  maps->memories.at(src_h_ptr).d_mt;
+                                  maps->aliases.At(src_h_ptr).mem->d_mt :
+                                  maps->memories.At(src_h_ptr).d_mt;
             ctrl->Device(src_d_mt)->DtoH(dst_h_ptr, src_d_ptr, bytes);
          }
       }
@@ -1269,8 +1798,8 @@ void MemoryManager::Copy_(void *dst_h_ptr, const void *src_h_ptr,
          const bool alias = dst_flags & Mem::ALIAS;
          MFEM_VERIFY(alias||known,"");
          const MemoryType d_mt = known ?
-                                 maps->memories.at(dst_h_ptr).d_mt :
-                                 maps->aliases.at(dst_h_ptr).mem->d_mt;
+                                 maps->memories.At(dst_h_ptr).d_mt :
+                                 maps->aliases.At(dst_h_ptr).mem->d_mt;
          ctrl->Device(d_mt)->HtoD(dest_d_ptr, src_h_ptr, bytes);
       }
       else
@@ -1281,8 +1810,8 @@ void MemoryManager::Copy_(void *dst_h_ptr, const void *src_h_ptr,
             const bool alias = dst_flags & Mem::ALIAS;
             MFEM_VERIFY(alias||known,"");
             const MemoryType d_mt = known ?
-                                    maps->memories.at(dst_h_ptr).d_mt :
-                                    maps->aliases.at(dst_h_ptr).mem->d_mt;
+                                    maps->memories.At(dst_h_ptr).d_mt :
+                                    maps->aliases.At(dst_h_ptr).mem->d_mt;
             ctrl->Device(d_mt)->DtoD(dest_d_ptr, src_d_ptr, bytes);
          }
       }
@@ -1314,8 +1843,8 @@ void MemoryManager::CopyToHost_(void *dest_h_ptr, const void *src_h_ptr,
                               mm.GetAliasDevicePtr(src_h_ptr, bytes, false) :
                               mm.GetDevicePtr(src_h_ptr, bytes, false);
       MemoryType src_d_mt = (src_flags & Mem::ALIAS) ?
-                            maps->aliases.at(src_h_ptr).mem->d_mt :
-                            maps->memories.at(src_h_ptr).d_mt;
+                            maps->aliases.At(src_h_ptr).mem->d_mt :
+                            maps->memories.At(src_h_ptr).d_mt;
       ctrl->Device(src_d_mt)->DtoH(dest_h_ptr, src_d_ptr, bytes);
    }
 }
@@ -1344,8 +1873,8 @@ void MemoryManager::CopyFromHost_(void *dest_h_ptr, const void *src_h_ptr,
                          mm.GetAliasDevicePtr(dest_h_ptr, bytes, false) :
                          mm.GetDevicePtr(dest_h_ptr, bytes, false);
       MemoryType dest_d_mt = (dest_flags & Mem::ALIAS) ?
-                             maps->aliases.at(dest_h_ptr).mem->d_mt :
-                             maps->memories.at(dest_h_ptr).d_mt;
+                             maps->aliases.At(dest_h_ptr).mem->d_mt :
+                             maps->memories.At(dest_h_ptr).d_mt;
       ctrl->Device(dest_d_mt)->HtoD(dest_d_ptr, src_h_ptr, bytes);
    }
    dest_flags = dest_flags &
@@ -1354,12 +1883,12 @@ void MemoryManager::CopyFromHost_(void *dest_h_ptr, const void *src_h_ptr,
 
 bool MemoryManager::IsKnown_(const void *h_ptr)
 {
-   return maps->memories.find(h_ptr) != maps->memories.end();
+   return maps->memories.Find(h_ptr) != nullptr;
 }
 
 bool MemoryManager::IsAlias_(const void *h_ptr)
 {
-   return maps->aliases.find(h_ptr) != maps->aliases.end();
+   return maps->aliases.Find(h_ptr) != nullptr;
 }
 
 void MemoryManager::Insert(void *h_ptr, size_t bytes,
@@ -1378,11 +1907,11 @@ void MemoryManager::Insert(void *h_ptr, size_t bytes,
 #ifdef MFEM_DEBUG
    auto res =
 #endif
-      maps->memories.emplace(h_ptr, internal::Memory(h_ptr, bytes, h_mt, d_mt));
+      maps->memories.Emplace(h_ptr, internal::Memory(h_ptr, bytes, h_mt, d_mt));
 #ifdef MFEM_DEBUG
    if (res.second == false)
    {
-      auto &m = res.first->second;
+      auto &m = *res.first;
       MFEM_VERIFY(m.bytes >= bytes && m.h_mt == h_mt &&
                   (m.d_mt == d_mt ||
                    (d_mt == MemoryType::DEFAULT &&
@@ -1404,7 +1933,7 @@ void MemoryManager::InsertDevice(void *d_ptr, void *h_ptr, size_t bytes,
    // MFEM_VERIFY_TYPES(h_mt, d_mt); // done by Insert() below
    MFEM_ASSERT(h_ptr != NULL, "internal error");
    Insert(h_ptr, bytes, h_mt, d_mt);
-   internal::Memory &mem = maps->memories.at(h_ptr);
+   internal::Memory &mem = maps->memories.At(h_ptr);
    if (d_ptr == NULL && bytes != 0) { ctrl->Device(d_mt)->Alloc(mem); }
    else { mem.d_ptr = d_ptr; }
 }
@@ -1427,7 +1956,7 @@ void MemoryManager::InsertAlias(const void *base_ptr, void *alias_ptr,
    }
    if (base_is_alias)
    {
-      const internal::Alias &alias = maps->aliases.at(base_ptr);
+      const internal::Alias &alias = maps->aliases.At(base_ptr);
       MFEM_ASSERT(alias.mem,"");
       base_ptr = alias.mem->h_ptr;
       offset += alias.offset;
@@ -1436,20 +1965,18 @@ void MemoryManager::InsertAlias(const void *base_ptr, void *alias_ptr,
                 << std::endl;
 #endif
    }
-   internal::Memory &mem = maps->memories.at(base_ptr);
+   internal::Memory &mem = maps->memories.At(base_ptr);
    MFEM_VERIFY(offset + bytes <= mem.bytes, "invalid alias");
-   auto res =
-      maps->aliases.emplace(alias_ptr,
-                            internal::Alias{&mem, offset, 1, mem.h_mt});
-   if (res.second == false) // alias_ptr was already in the map
+   maps->aliases.Emplace(alias_ptr, internal::Alias{&mem, offset, 1, mem.h_mt},
+                         [&](internal::Alias &alias)
    {
-      internal::Alias &alias = res.first->second;
-      // Update the alias data in case the existing alias is dangling
+      // alias_ptr was already in the map: update the alias data in case the
+      // existing alias is dangling
       alias.mem = &mem;
       alias.offset = offset;
       alias.h_mt = mem.h_mt;
       alias.counter++;
-   }
+   });
 }
 
 void MemoryManager::Erase(void *h_ptr, bool free_dev_ptr)
@@ -1459,21 +1986,19 @@ void MemoryManager::Erase(void *h_ptr, bool free_dev_ptr)
              << std::endl;
 #endif
    if (!h_ptr) { return; }
-   auto mem_map_iter = maps->memories.find(h_ptr);
-   if (mem_map_iter == maps->memories.end()) { mfem_error("Unknown pointer!"); }
-   internal::Memory &mem = mem_map_iter->second;
-   if (mem.d_ptr && free_dev_ptr) { ctrl->Device(mem.d_mt)->Dealloc(mem);}
-   maps->memories.erase(mem_map_iter);
+   internal::Memory *mem = maps->memories.Find(h_ptr);
+   if (!mem) { mfem_error("Unknown pointer!"); }
+   if (mem->d_ptr && free_dev_ptr) { ctrl->Device(mem->d_mt)->Dealloc(*mem);}
+   maps->memories.Erase(h_ptr);
 }
 
 void MemoryManager::EraseDevice(void *h_ptr)
 {
    if (!h_ptr) { return; }
-   auto mem_map_iter = maps->memories.find(h_ptr);
-   if (mem_map_iter == maps->memories.end()) { mfem_error("Unknown pointer!"); }
-   internal::Memory &mem = mem_map_iter->second;
-   if (mem.d_ptr) { ctrl->Device(mem.d_mt)->Dealloc(mem);}
-   mem.d_ptr = nullptr;
+   internal::Memory *mem = maps->memories.Find(h_ptr);
+   if (!mem) { mfem_error("Unknown pointer!"); }
+   if (mem->d_ptr) { ctrl->Device(mem->d_mt)->Dealloc(*mem);}
+   mem->d_ptr = nullptr;
 }
 
 void MemoryManager::EraseAlias(void *alias_ptr)
@@ -1483,11 +2008,9 @@ void MemoryManager::EraseAlias(void *alias_ptr)
              << std::endl;
 #endif
    if (!alias_ptr) { return; }
-   auto alias_map_iter = maps->aliases.find(alias_ptr);
-   if (alias_map_iter == maps->aliases.end()) { mfem_error("Unknown alias!"); }
-   internal::Alias &alias = alias_map_iter->second;
-   if (--alias.counter) { return; }
-   maps->aliases.erase(alias_map_iter);
+   const bool known = maps->aliases.Update(alias_ptr, [](internal::Alias &alias)
+   { return --alias.counter == 0; });
+   if (!known) { mfem_error("Unknown alias!"); }
 }
 
 void *MemoryManager::GetDevicePtr(const void *h_ptr, size_t bytes,
@@ -1498,7 +2021,7 @@ void *MemoryManager::GetDevicePtr(const void *h_ptr, size_t bytes,
       MFEM_VERIFY(bytes == 0, "Trying to access NULL with size " << bytes);
       return NULL;
    }
-   internal::Memory &mem = maps->memories.at(h_ptr);
+   internal::Memory &mem = maps->memories.At(h_ptr);
    const MemoryType &h_mt = mem.h_mt;
    MemoryType &d_mt = mem.d_mt;
    MFEM_VERIFY_TYPES(h_mt, d_mt);
@@ -1526,10 +2049,9 @@ void *MemoryManager::GetAliasDevicePtr(const void *alias_ptr, size_t bytes,
       MFEM_VERIFY(bytes == 0, "Trying to access NULL with size " << bytes);
       return NULL;
    }
-   auto &alias_map = maps->aliases;
-   auto alias_map_iter = alias_map.find(alias_ptr);
-   if (alias_map_iter == alias_map.end()) { mfem_error("alias not found"); }
-   const internal::Alias &alias = alias_map_iter->second;
+   const internal::Alias *alias_p = maps->aliases.Find(alias_ptr);
+   if (!alias_p) { mfem_error("alias not found"); }
+   const internal::Alias &alias = *alias_p;
    const size_t offset = alias.offset;
    internal::Memory &mem = *alias.mem;
    const MemoryType &h_mt = mem.h_mt;
@@ -1555,7 +2077,7 @@ void *MemoryManager::GetAliasDevicePtr(const void *alias_ptr, size_t bytes,
 
 void *MemoryManager::GetHostPtr(const void *ptr, size_t bytes, bool copy)
 {
-   const internal::Memory &mem = maps->memories.at(ptr);
+   const internal::Memory &mem = maps->memories.At(ptr);
    MFEM_ASSERT(mem.h_ptr == ptr, "internal error");
    MFEM_ASSERT(bytes <= mem.bytes, "internal error")
    const MemoryType &h_mt = mem.h_mt;
@@ -1572,7 +2094,7 @@ void *MemoryManager::GetHostPtr(const void *ptr, size_t bytes, bool copy)
 void *MemoryManager::GetAliasHostPtr(const void *ptr, size_t bytes,
                                      bool copy_data)
 {
-   const internal::Alias &alias = maps->aliases.at(ptr);
+   const internal::Alias &alias = maps->aliases.At(ptr);
    const internal::Memory *const mem = alias.mem;
    const MemoryType &h_mt = mem->h_mt;
    const MemoryType &d_mt = mem->d_mt;
@@ -1656,8 +2178,8 @@ void MemoryManager::Destroy()
 {
    MFEM_VERIFY(exists, "MemoryManager has already been destroyed!");
 #ifdef MFEM_TRACK_MEM_MANAGER
-   size_t num_memories = maps->memories.size();
-   size_t num_aliases = maps->aliases.size();
+   size_t num_memories = maps->memories.Size();
+   size_t num_aliases = maps->aliases.Size();
    if (num_memories != 0 || num_aliases != 0)
    {
       MFEM_WARNING("...\n\t number of registered pointers: " << num_memories
@@ -1668,16 +2190,20 @@ void MemoryManager::Destroy()
 #if 0
    mfem::out << "Destroying the MemoryManager ...\n"
              << "remaining registered pointers : "
-             << maps->memories.size() << '\n'
+             << maps->memories.Size() << '\n'
              << "remaining registered aliases  : "
-             << maps->aliases.size() << '\n';
+             << maps->aliases.Size() << '\n';
 #endif
-   for (auto& n : maps->memories)
+   // Collect the entries first: the deallocation may look up the maps
+   std::vector<internal::Memory*> memories;
+   memories.reserve(maps->memories.Size());
+   maps->memories.ForEach([&](const void*, internal::Memory &mem)
+   { memories.push_back(&mem); });
+   for (internal::Memory *mem : memories)
    {
-      internal::Memory &mem = n.second;
-      bool mem_h_ptr = mem.h_mt != MemoryType::HOST && mem.h_ptr;
-      if (mem_h_ptr) { ctrl->Host(mem.h_mt)->Dealloc(mem.h_ptr); }
-      if (mem.d_ptr) { ctrl->Device(mem.d_mt)->Dealloc(mem); }
+      bool mem_h_ptr = mem->h_mt != MemoryType::HOST && mem->h_ptr;
+      if (mem_h_ptr) { ctrl->Host(mem->h_mt)->Dealloc(mem->h_ptr); }
+      if (mem->d_ptr) { ctrl->Device(mem->d_mt)->Dealloc(*mem); }
    }
    delete maps; maps = nullptr;
    delete ctrl; ctrl = nullptr;
@@ -1701,31 +2227,29 @@ void MemoryManager::RegisterCheck(void *ptr)
 int MemoryManager::PrintPtrs(std::ostream &os)
 {
    int n_out = 0;
-   for (const auto& n : maps->memories)
+   maps->memories.ForEach([&](const void *key, const internal::Memory &mem)
    {
-      const internal::Memory &mem = n.second;
-      os << "\nkey " << n.first << ", "
+      os << "\nkey " << key << ", "
          << "h_ptr " << mem.h_ptr << ", "
          << "d_ptr " << mem.d_ptr;
       n_out++;
-   }
-   if (maps->memories.size() > 0) { os << std::endl; }
+   });
+   if (n_out > 0) { os << std::endl; }
    return n_out;
 }
 
 int MemoryManager::PrintAliases(std::ostream &os)
 {
    int n_out = 0;
-   for (const auto& n : maps->aliases)
+   maps->aliases.ForEach([&](const void *key, const internal::Alias &alias)
    {
-      const internal::Alias &alias = n.second;
-      os << "\nalias: key " << n.first << ", "
+      os << "\nalias: key " << key << ", "
          << "h_ptr " << alias.mem->h_ptr << ", "
          << "offset " << alias.offset << ", "
          << "counter " << alias.counter;
       n_out++;
-   }
-   if (maps->aliases.size() > 0) { os << std::endl; }
+   });
+   if (n_out > 0) { os << std::endl; }
    return n_out;
 }
 
@@ -1770,17 +2294,15 @@ void MemoryManager::CheckHostMemoryType_(MemoryType h_mt, void *h_ptr,
    if (!mm.exists) {return;}
    if (!alias)
    {
-      auto it = maps->memories.find(h_ptr);
-      MFEM_VERIFY(it != maps->memories.end(),
-                  "host pointer is not registered: h_ptr = " << h_ptr);
-      MFEM_VERIFY(h_mt == it->second.h_mt, "host pointer MemoryType mismatch");
+      const internal::Memory *mem = maps->memories.Find(h_ptr);
+      MFEM_VERIFY(mem, "host pointer is not registered: h_ptr = " << h_ptr);
+      MFEM_VERIFY(h_mt == mem->h_mt, "host pointer MemoryType mismatch");
    }
    else
    {
-      auto it = maps->aliases.find(h_ptr);
-      MFEM_VERIFY(it != maps->aliases.end(),
-                  "alias pointer is not registered: h_ptr = " << h_ptr);
-      MFEM_VERIFY(h_mt == it->second.h_mt, "alias pointer MemoryType mismatch");
+      const internal::Alias *alias = maps->aliases.Find(h_ptr);
+      MFEM_VERIFY(alias, "alias pointer is not registered: h_ptr = " << h_ptr);
+      MFEM_VERIFY(h_mt == alias->h_mt, "alias pointer MemoryType mismatch");
    }
 }
 
@@ -1800,6 +2322,7 @@ MemoryType MemoryManager::dual_map[MemoryTypeSize] =
    /* HOST_DEBUG      */  MemoryType::DEVICE_DEBUG,
    /* HOST_UMPIRE     */  MemoryType::DEVICE_UMPIRE,
    /* HOST_PINNED     */  MemoryType::DEVICE,
+   /* HOST_POOL       */  MemoryType::DEVICE,
    /* MANAGED         */  MemoryType::MANAGED,
    /* DEVICE          */  MemoryType::HOST,
    /* DEVICE_DEBUG    */  MemoryType::HOST_DEBUG,
@@ -1817,6 +2340,7 @@ const char * MemoryManager::d_umpire_2_name = "MFEM_DEVICE_2";
 const char *MemoryTypeName[MemoryTypeSize] =
 {
    "host-std", "host-32", "host-64", "host-debug", "host-umpire", "host-pinned",
+   "host-pool",
 #if defined(MFEM_USE_CUDA)
    "cuda-uvm",
    "cuda",
@@ -44,6 +44,8 @@ enum class MemoryType
    HOST_UMPIRE,    /**< Host memory; using an Umpire allocator which can be set
                         with MemoryManager::SetUmpireHostAllocatorName */
    HOST_PINNED,    ///< Host memory: pinned (page-locked)
+   HOST_POOL,      /**< Host memory; using a thread-safe pool of size classes,
+                        see MemoryManager::GetHostPoolStats() */
    MANAGED,        /**< Managed memory; using CUDA or HIP *MallocManaged
                         and *Free */
    DEVICE,         ///< Device memory; using CUDA or HIP *Malloc and *Free
@@ -80,7 +82,8 @@ extern MFEM_EXPORT const char *MemoryTypeName[MemoryTypeSize];
 enum class MemoryClass
 {
    HOST,    /**< Memory types: { HOST, HOST_32, HOST_64, HOST_DEBUG,
-                                 HOST_UMPIRE, HOST_PINNED, MANAGED } */
+                                 HOST_UMPIRE, HOST_PINNED, HOST_POOL,
+                                 MANAGED } */
    HOST_32, ///< Memory types: { HOST_32, HOST_64, HOST_DEBUG }
    HOST_64, ///< Memory types: { HOST_64, HOST_DEBUG }
    DEVICE,  /**< Memory types: { DEVICE, DEVICE_DEBUG, DEVICE_UMPIRE,
@@ -606,6 +609,9 @@ private:
    {
       return Alloc<new_align_bytes>::New(size);
    }
+
+   // Allocate from the MemoryType::HOST_POOL pool
+   static inline T *NewHOST_POOL(std::size_t size);
 };
 
 
@@ -696,6 +702,13 @@ private: // Static methods used by the Memory<T> class
    /// Free device memory identified by its host pointer
    static void DeleteDevice_(void *h_ptr, unsigned & flags);
 
+   /// Allocate @a bytes from the MemoryType::HOST_POOL pool, without
+   /// registering the pointer.
+   static void *PoolNew_(size_t bytes);
+
+   /// Return a pointer allocated with PoolNew_() to the pool.
+   static void PoolDelete_(void *h_ptr);
+
    /// Check if the memory types given the memory class are valid
    static bool MemoryClassCheck_(MemoryClass mc, void *h_ptr,
                                  MemoryType h_mt, size_t bytes, unsigned flags);
@@ -811,6 +824,7 @@ public:
        HOST_DEBUG      | DEVICE_DEBUG
        HOST_UMPIRE     | DEVICE_UMPIRE
        HOST_PINNED     | DEVICE
+       HOST_POOL       | DEVICE
        MANAGED         | MANAGED
        DEVICE          | HOST
        DEVICE_DEBUG    | HOST_DEBUG
@@ -878,6 +892,36 @@ public:
    static MemoryType GetHostMemoryType() { return host_mem_type; }
    static MemoryType GetDeviceMemoryType() { return device_mem_type; }
 
+   /// Statistics of the MemoryType::HOST_POOL allocator.
+   struct HostPoolStats
+   {
+      size_t allocations = 0;  ///< Number of allocations from the pool
+      size_t hits = 0;         ///< Allocations that reused a cached block
+      size_t bytes_in_use = 0; ///< Bytes in the blocks currently allocated
+      size_t peak_bytes = 0;   ///< Maximum value of bytes_in_use
+      size_t bytes_cached = 0; ///< Bytes in the free blocks kept by the pool
+
+      /// Fraction of the allocations that reused a cached block.
+      double HitRate() const
+      { return allocations ? double(hits)/double(allocations) : 0.0; }
+   };
+
+   /** @brief Return the statistics of the MemoryType::HOST_POOL allocator,
+       accumulated over all threads. */
+   /** The pool rounds the requested sizes up to size classes (four per power
+       of two), so the byte counts include this rounding. Freed blocks are kept
+       in small per-thread caches and in a pool shared by all threads, to be
+       reused by later requests of the same size class. */
+   static HostPoolStats GetHostPoolStats();
+
+   /** @brief Reset the allocation and hit counters of the MemoryType::HOST_POOL
+       allocator and set the peak to the bytes currently in use. */
+   static void ResetHostPoolStats();
+
+   /** @brief Free the blocks cached by the MemoryType::HOST_POOL allocator in
+       the shared pool and in the cache of the calling thread. */
+   static void ReleaseHostPool();
+
 #ifdef MFEM_USE_ENZYME
    static void myfree(void* mem, MemoryType MT, unsigned &flags)
    {
@@ -937,6 +981,14 @@ inline bool HypreUsingGPU()
 
 // Inline methods
 
+template <typename T>
+inline T *Memory<T>::NewHOST_POOL(std::size_t size)
+{
+   MFEM_ASSERT(alignof(T) <= alignof(std::max_align_t),
+               "overaligned type cannot use MemoryType::HOST_POOL");
+   return (T*)MemoryManager::PoolNew_(size*sizeof(T));
+}
+
 template <typename T>
 inline void Memory<T>::Reset()
 {
@@ -962,6 +1014,7 @@ inline void Memory<T>::New(int size)
    flags = OWNS_HOST | VALID_HOST;
    h_mt = MemoryManager::GetHostMemoryType();
    h_ptr = (h_mt == MemoryType::HOST) ? NewHOST(size) :
+           (h_mt == MemoryType::HOST_POOL) ? NewHOST_POOL(size) :
            (T*)MemoryManager::New_(nullptr, size*sizeof(T), h_mt, flags);
 }
 
@@ -969,6 +1022,14 @@ template <typename T>
 inline void Memory<T>::New(int size, MemoryType mt)
 {
    capacity = size;
+   if (mt == MemoryType::HOST_POOL)
+   {
+      // Unregistered, like MemoryType::HOST
+      flags = OWNS_HOST | VALID_HOST;
+      h_mt = mt;
+      h_ptr = NewHOST_POOL(size);
+      return;
+   }
    const size_t bytes = size*sizeof(T);
    const bool mt_host = mt == MemoryType::HOST;
    if (mt_host) { flags = OWNS_HOST | VALID_HOST; }
@@ -1115,7 +1176,8 @@ inline void Memory<T>::Delete()
 {
    const bool registered = flags & Registered;
    const bool mt_host = h_mt == MemoryType::HOST;
-   const bool std_delete = !registered && mt_host;
+   const bool mt_pool = h_mt == MemoryType::HOST_POOL;
+   const bool std_delete = !registered && (mt_host || mt_pool);
 
    if (!std_delete)
    {
@@ -1126,6 +1188,11 @@ inline void Memory<T>::Delete()
    {
       if (flags & OWNS_HOST) { delete [] h_ptr; }
    }
+   else if (mt_pool && !registered)
+   {
+      // Registered pool memory is returned to the pool by Delete_()
+      if (flags & OWNS_HOST) { MemoryManager::PoolDelete_(h_ptr); }
+   }
    Reset(h_mt);
 }
 
@@ -15,6 +15,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 namespace mfem
 {
@@ -636,9 +637,17 @@ void ConstrainedOperator::ConstrainedMult(const Vector &x, Vector &y,
          });
          break;
       case DIAG_KEEP:
-         // Needs action of the operator diagonal on vector
-         mfem_error("ConstrainedOperator::Mult #1");
+      {
+         // Action of the diagonal of the unconstrained operator
+         A->AssembleDiagonal(w);
+         auto d_w = w.Read();
+         mfem::forall(csz, [=] MFEM_HOST_DEVICE (int i)
+         {
+            const int id = idx[i];
+            d_y[id] = d_w[id]*d_x[id];
+         });
          break;
+      }
       default:
          mfem_error("ConstrainedOperator::Mult #2");
          break;
@@ -713,6 +722,49 @@ void ConstrainedOperator::Mult(const Vector &x, Vector &y) const
    ConstrainedMult(x, y, transpose);
 }
 
+void ConstrainedOperator::ArrayMult(const Array<const Vector *> &X,
+                                    Array<Vector *> &Y) const
+{
+   const int csz = constraint_list.Size();
+   const int nvec = X.Size();
+   if (csz == 0)
+   {
+      A->ArrayMult(X, Y);
+      return;
+   }
+   auto idx = constraint_list.Read();
+   if ((int) multi_z.size() < nvec) { multi_z.resize(nvec); }
+   multi_Z.SetSize(nvec);
+   for (int v = 0; v < nvec; v++)
+   {
+      Vector &zv = multi_z[v];
+      zv.SetSize(width, GetMemoryType(mem_class));
+      zv = *X[v];
+      auto d_z = zv.ReadWrite();
+      mfem::forall(csz, [=] MFEM_HOST_DEVICE (int i) { d_z[idx[i]] = 0.0; });
+      multi_Z[v] = &zv;
+   }
+
+   A->ArrayMult(multi_Z, Y);
+
+   // The diagonal of the unconstrained operator is assembled once for all
+   // vectors
+   const DiagonalPolicy policy = diag_policy;
+   if (policy == DIAG_KEEP) { A->AssembleDiagonal(w); }
+   const real_t *d_w = (policy == DIAG_KEEP) ? w.Read() : nullptr;
+   for (int v = 0; v < nvec; v++)
+   {
+      auto d_x = X[v]->Read();
+      auto d_y = Y[v]->ReadWrite();
+      mfem::forall(csz, [=] MFEM_HOST_DEVICE (int i)
+      {
+         const int id = idx[i];
+         d_y[id] = (policy == DIAG_ONE) ? d_x[id] :
+                   (policy == DIAG_KEEP) ? d_w[id]*d_x[id] : 0.0;
+      });
+   }
+}
+
 void ConstrainedOperator::AbsMult(const Vector &x, Vector &y) const
 {
    constexpr bool transpose = false;
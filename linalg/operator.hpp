@@ -14,6 +14,8 @@
 
 #include "vector.hpp"
 
+#include <vector>
+
 namespace mfem
 {
 
@@ -1053,6 +1055,8 @@ protected:
    Operator *A;                 ///< The unconstrained Operator.
    bool own_A;                  ///< Ownership flag for A.
    mutable Vector z, w;         ///< Auxiliary vectors.
+   mutable std::vector<Vector> multi_z; ///< Auxiliary vectors for ArrayMult().
+   mutable Array<const Vector *> multi_Z; ///< Pointers to #multi_z.
    MemoryClass mem_class;
    DiagonalPolicy diag_policy;  ///< Diagonal policy for constrained dofs
 
@@ -1098,11 +1102,20 @@ public:
            z = A((x_i,0));  y_i = z_i;  y_b = x_b;
 
        where the "_b" subscripts denote the essential (boundary) indices/dofs of
-       the vectors, and "_i" -- the rest of the entries. */
+       the vectors, and "_i" -- the rest of the entries. This is the DIAG_ONE
+       policy: with DIAG_ZERO, y_b = 0, and with DIAG_KEEP, y_b = D_b x_b,
+       where D is the diagonal of A, computed with A->AssembleDiagonal() on
+       each call. */
    void Mult(const Vector &x, Vector &y) const override;
 
    void AddMult(const Vector &x, Vector &y, const real_t a = 1.0) const override;
 
+   /** @brief Constrained operator action on several vectors, passing all of
+       them to the unconstrained Operator at once with ArrayMult(). With
+       DIAG_KEEP, the diagonal of A is computed once for all vectors. */
+   void ArrayMult(const Array<const Vector *> &X,
+                  Array<Vector *> &Y) const override;
+
    void AbsMult(const Vector &x, Vector &y) const override;
 
    void MultTranspose(const Vector &x, Vector &y) const override;
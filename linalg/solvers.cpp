@@ -208,6 +208,104 @@ bool IterativeSolver::Monitor(int it, real_t norm, const Vector& r,
    return false;
 }
 
+void IterativeSolver::StartDots(int n, const Vector *const *x,
+                                const Vector *const *y, real_t *res) const
+{
+   if (dot_oper)
+   {
+      for (int i = 0; i < n; i++) { res[i] = dot_oper->Eval(*x[i], *y[i]); }
+      return;
+   }
+   for (int i = 0; i < n; i++) { res[i] = (*x[i]) * (*y[i]); }
+#ifdef MFEM_USE_MPI
+   if (dot_prod_type != 0)
+   {
+      MPI_Iallreduce(MPI_IN_PLACE, res, n, MPITypeMap<real_t>::mpi_type,
+                     MPI_SUM, comm, &dots_request);
+   }
+#endif
+}
+
+void IterativeSolver::FinishDots() const
+{
+#ifdef MFEM_USE_MPI
+   if (dots_request != MPI_REQUEST_NULL)
+   {
+      MPI_Wait(&dots_request, MPI_STATUS_IGNORE);
+   }
+#endif
+}
+
+real_t IterativeSolver::ReduceDot(real_t loc_dot) const
+{
+   MFEM_ASSERT(dot_oper == nullptr, "not valid with a custom inner product");
+#ifdef MFEM_USE_MPI
+   if (dot_prod_type != 0)
+   {
+      real_t glb_dot;
+      MPI_Allreduce(&loc_dot, &glb_dot, 1, MPITypeMap<real_t>::mpi_type,
+                    MPI_SUM, comm);
+      return glb_dot;
+   }
+#endif
+   return loc_dot;
+}
+
+void IterativeSolver::BlockDots(int nx, const Vector *X, int ny,
+                                const Vector *Y, DenseMatrix &G) const
+{
+   G.SetSize(nx, ny);
+   if (nx == 0 || ny == 0) { return; }
+
+   if (dot_oper)
+   {
+      for (int j = 0; j < ny; j++)
+      {
+         for (int i = 0; i < nx; i++) { G(i,j) = dot_oper->Eval(X[i], Y[j]); }
+      }
+      return;
+   }
+
+   const bool use_dev = X[0].UseDevice() || Y[0].UseDevice();
+   if (use_dev && Device::Allows(Backend::DEVICE_MASK))
+   {
+      for (int j = 0; j < ny; j++)
+      {
+         for (int i = 0; i < nx; i++) { G(i,j) = X[i] * Y[j]; }
+      }
+   }
+   else
+   {
+      const int n = X[0].Size();
+      Array<const real_t *> x(nx), y(ny);
+      for (int i = 0; i < nx; i++) { x[i] = X[i].HostRead(); }
+      for (int j = 0; j < ny; j++) { y[j] = Y[j].HostRead(); }
+      G = 0.0;
+      // Process the vectors in chunks that stay in cache for all the products
+      constexpr int chunk = 256;
+      for (int l0 = 0; l0 < n; l0 += chunk)
+      {
+         const int l1 = std::min(n, l0 + chunk);
+         for (int j = 0; j < ny; j++)
+         {
+            for (int i = 0; i < nx; i++)
+            {
+               real_t sum = 0.0;
+               for (int l = l0; l < l1; l++) { sum += x[i][l] * y[j][l]; }
+               G(i,j) += sum;
+            }
+         }
+      }
+   }
+#ifdef MFEM_USE_MPI
+   if (dot_prod_type != 0)
+   {
+      MPI_Allreduce(MPI_IN_PLACE, G.Data(), nx*ny,
+                    MPITypeMap<real_t>::mpi_type, MPI_SUM, comm);
+   }
+#endif
+}
+
 void ConstrainedInnerProduct::SetIndices(const Array<int> &list)
 {
    list.Read(); // TODO: just ensure 'list' is registered, no need to copy it
@@ -954,18 +1052,23 @@ void CGSolver::Mult(const Vector &b, Vector &x) const
    for (i = 1; true; )
    {
       alpha = nom/den;
-      add(x,  alpha, d, x);     //  x = x + alpha d
-      add(r, -alpha, z, r);     //  r = r - alpha A d
-
       if (prec)
       {
+         // x = x + alpha d, r = r - alpha A d
+         AddTwo(x, alpha, d, r, -alpha, z);
          prec->Mult(r, z);      //  z = B r
          betanom = Dot(r, z);
       }
-      else
+      else if (dot_oper)
       {
+         AddTwo(x, alpha, d, r, -alpha, z);
          betanom = Dot(r, r);
       }
+      else
+      {
+         // Fused update of x and r and computation of (r, r)
+         betanom = ReduceDot(AddTwoAndDot(x, alpha, d, r, -alpha, z, r));
+      }
       MFEM_VERIFY(IsFinite(betanom), "betanom = " << betanom);
       if (betanom < 0.0)
       {
@@ -1080,136 +1183,566 @@ void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
    pcg.Mult(b, x);
 }
 
+void PipelinedCGSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
 
-inline void GeneratePlaneRotation(real_t &dx, real_t &dy,
-                                  real_t &cs, real_t &sn)
+   for (Vector *v : {&r, &u, &w, &m, &n, &p, &s, &q, &z})
+   {
+      v->SetSize(width, mt);
+      v->UseDevice(true);
+   }
+}
+
+void PipelinedCGSolver::Mult(const Vector &b, Vector &x) const
 {
-   if (dy == 0.0)
+   int i;
+   real_t r0 = 0.0, nom = 0.0, nom0 = 0.0, den, alpha = 0.0, beta;
+   real_t dots[2]; // (u, r) = (B r, r) and (w, u) = (A B r, B r)
+   const Vector *dots_x[2] = { &r, &w };
+   const Vector *dots_y[2] = { &u, &u };
+
+   x.UseDevice(true);
+   if (iterative_mode)
    {
-      cs = 1.0;
-      sn = 0.0;
+      oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
    }
-   else if (fabs(dy) > fabs(dx))
+   else
    {
-      real_t temp = dx / dy;
-      sn = 1.0 / sqrt( 1.0 + temp*temp );
-      cs = temp * sn;
+      r = b;
+      x = 0.0;
+   }
+
+   if (prec)
+   {
+      prec->Mult(r, u); // u = B r
    }
    else
    {
-      real_t temp = dy / dx;
-      cs = 1.0 / sqrt( 1.0 + temp*temp );
-      sn = temp * cs;
+      u = r;
    }
-}
+   oper->Mult(u, w);    // w = A u
 
-inline void ApplyPlaneRotation(real_t &dx, real_t &dy, real_t &cs, real_t &sn)
-{
-   real_t temp = cs * dx + sn * dy;
-   dy = -sn * dx + cs * dy;
-   dx = temp;
+   converged = false;
+   final_iter = max_iter;
+   for (i = 0; true; i++)
+   {
+      // The reduction overlaps with the preconditioner and operator actions
+      StartDots(2, dots_x, dots_y, dots);
+      if (prec)
+      {
+         prec->Mult(w, m); // m = B w
+      }
+      else
+      {
+         m = w;
+      }
+      oper->Mult(m, n);    // n = A m
+      FinishDots();
+
+      const real_t nom_old = nom;
+      nom = dots[0];
+      den = dots[1];
+      MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+      if (i == 0)
+      {
+         nom0 = nom;
+         if (nom0 >= 0.0) { initial_norm = sqrt(nom0); }
+         r0 = std::max(nom*rel_tol*rel_tol, abs_tol*abs_tol);
+      }
+      if (print_options.iterations || (i == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << i << "  (B r, r) = "
+                   << nom << (print_options.iterations ? "\n" : " ...\n");
+      }
+      if (nom < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PCG: The preconditioner is not positive definite. "
+                      "(Br, r) = " << nom << '\n';
+         }
+         final_iter = i;
+         break;
+      }
+      if (Monitor(i, nom, r, x) || nom <= r0)
+      {
+         converged = true;
+         final_iter = i;
+         break;
+      }
+      if (i >= max_iter)
+      {
+         break;
+      }
+
+      // den = (A p, p), computed from the recurrences
+      beta = (i == 0) ? 0.0 : nom/nom_old;
+      if (i > 0) { den -= beta*nom/alpha; }
+      MFEM_VERIFY(IsFinite(den), "den = " << den);
+      if (den <= 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "PCG: The operator is not positive definite. "
+                      "(Ap, p) = " << den << '\n';
+         }
+         if (den == 0.0)
+         {
+            final_iter = i;
+            break;
+         }
+      }
+      alpha = nom/den;
+
+      if (i == 0)
+      {
+         z = n;
+         q = m;
+         s = w;
+         p = u;
+      }
+      else
+      {
+         add(n, beta, z, z); //  z = n + beta z = A B A p
+         add(m, beta, q, q); //  q = m + beta q = B A p
+         add(w, beta, s, s); //  s = w + beta s = A p
+         add(u, beta, p, p); //  p = u + beta p
+      }
+      add(x,  alpha, p, x);  //  x = x + alpha p
+      add(r, -alpha, s, r);  //  r = r - alpha A p
+      add(u, -alpha, q, u);  //  u = u - alpha B A p = B r
+      add(w, -alpha, z, w);  //  w = w - alpha A B A p = A u
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << nom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "PCG: Number of iterations: " << final_iter << '\n';
+   }
+   if ((print_options.summary || print_options.iterations ||
+        print_options.first_and_last) && final_iter > 0)
+   {
+      const auto arf = pow (nom/nom0, 0.5/final_iter);
+      mfem::out << "Average reduction factor = " << arf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "PCG: No convergence!" << '\n';
+   }
+
+   final_norm = sqrt(std::abs(nom));
+
+   Monitor(final_iter, final_norm, r, x, true);
 }
 
-inline void Update(Vector &x, int k, DenseMatrix &h, Vector &s,
-                   Array<Vector*> &v)
-{
-   Vector y(s);
 
-   // Backsolve:
-   for (int i = k; i >= 0; i--)
+// Cholesky factorization G = L L^t of the leading block of the symmetric matrix
+// G, stopping at the first pivot that is not larger than tol times the
+// corresponding diagonal entry of Gref (G by default), i.e. at the first vector
+// (of a set with Gram matrix G) that is numerically dependent on the previous
+// ones. The factor is stored in the lower triangle of L; returns the number of
+// factored rows.
+static int PartialCholesky(const DenseMatrix &G, DenseMatrix &L, real_t tol,
+                           const DenseMatrix *Gref = nullptr)
+{
+   const int n = G.Height();
+   const DenseMatrix &D = Gref ? *Gref : G;
+   L = G;
+   int k = 0;
+   for ( ; k < n; k++)
    {
-      y(i) /= h(i,i);
-      for (int j = i - 1; j >= 0; j--)
+      real_t d = L(k,k);
+      for (int l = 0; l < k; l++) { d -= L(k,l)*L(k,l); }
+      if (!(d > 0.0 && d > tol*D(k,k))) { break; }
+      L(k,k) = d = sqrt(d);
+      for (int i = k+1; i < n; i++)
       {
-         y(j) -= h(j,i) * y(i);
+         real_t v = L(i,k);
+         for (int l = 0; l < k; l++) { v -= L(i,l)*L(k,l); }
+         L(i,k) = v/d;
       }
    }
+   return k;
+}
 
-   for (int j = 0; j <= k; j++)
+// Solve L L^t y = y using the leading k x k block of the Cholesky factor L
+static void CholeskySolve(const DenseMatrix &L, int k, real_t *y)
+{
+   for (int i = 0; i < k; i++)
    {
-      x.Add(y(j), *v[j]);
+      for (int l = 0; l < i; l++) { y[i] -= L(i,l)*y[l]; }
+      y[i] /= L(i,i);
+   }
+   for (int i = k-1; i >= 0; i--)
+   {
+      for (int l = i+1; l < k; l++) { y[i] -= L(l,i)*y[l]; }
+      y[i] /= L(i,i);
    }
 }
 
-void GMRESSolver::Mult(const Vector &b, Vector &x) const
+// Resize the set of vectors V to n vectors of size s with memory type mt
+static void ResizeVectors(std::vector<Vector> &V, int n, int s, MemoryType mt)
 {
-   // Generalized Minimum Residual method following the algorithm
-   // on p. 20 of the SIAM Templates book.
-
-   int n = width;
+   V.resize(n);
+   for (Vector &v : V)
+   {
+      v.SetSize(s, mt);
+      v.UseDevice(true);
+   }
+}
 
-   DenseMatrix H(m+1, m);
-   Vector s(m+1), cs(m+1), sn(m+1);
-   Vector r(n), w(n), x_monitor;
-   Array<Vector *> v;
+void SStepCGSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
 
-   b.UseDevice(true);
-   x.UseDevice(true);
+   r.SetSize(width, mt);
    r.UseDevice(true);
-   w.UseDevice(true);
 
-   if (ControllerRequiresUpdate())
-   {
-      x_monitor.SetSize(n);
-      x_monitor.UseDevice(true);
-   }
-   else
+   for (std::vector<Vector> *basis : {&V, &AV, &P, &AP})
    {
-      x_monitor.MakeRef(x, 0, n);
+      ResizeVectors(*basis, s_steps, width, mt);
    }
+}
 
-   int i, j, k;
+void SStepCGSolver::SetNumSteps(int s)
+{
+   MFEM_VERIFY(s > 0, "invalid number of steps: " << s);
+   s_steps = s;
+   if (oper) { UpdateVectors(); }
+}
+
+void SStepCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   const int ns = s_steps;
+   // All inner products of an outer iteration, reduced together:
+   // g(i) = (V_i, r), G(i,j) = (V_i, A V_j), W(i,j) = (A P_i, V_j) and
+   // h(i) = (P_i, r), where P are the directions of the previous outer
+   // iteration. In exact arithmetic h = 0, but including it limits the drift
+   // of the residual at small tolerances.
+   const int num_dots = 2*ns + 2*ns*ns;
+   Vector dots(num_dots);
+   std::vector<const Vector *> dots_x(num_dots), dots_y(num_dots);
+   DenseMatrix G(ns), W(ns), Bc(ns), GBc(ns), Gprev(ns), Gfact(ns);
+   Vector g(ns), h(ns);
+   // Relative size of the Cholesky pivots below which a direction is treated
+   // as linearly dependent on the previous ones
+   const real_t dep_tol = sqrt(std::numeric_limits<real_t>::epsilon());
+   // Scaling of the monomial basis, Rayleigh quotient estimate for B A
+   real_t theta = 1.0;
+   real_t r0 = 0.0, nom = 0.0, nom0 = 0.0;
+   // Number of directions of the previous outer iteration, 0 on (re)start
+   int num_prev = 0;
 
+   x.UseDevice(true);
    if (iterative_mode)
    {
       oper->Mult(x, r);
+      subtract(b, r, r); // r = b - A x
    }
    else
    {
+      r = b;
       x = 0.0;
    }
 
-   if (prec)
+   converged = false;
+   final_iter = max_iter;
+   for (int it = 0; true; )
    {
-      if (iterative_mode)
+      // Scaled monomial basis of the preconditioned Krylov space
+      if (prec) { prec->Mult(r, V[0]); }
+      else { V[0] = r; }
+      for (int j = 0; j < ns; j++)
       {
-         subtract(b, r, w);
-         prec->Mult(w, r);    // r = M (b - A x)
+         oper->Mult(V[j], AV[j]);
+         if (j+1 < ns)
+         {
+            if (prec) { prec->Mult(AV[j], V[j+1]); }
+            else { V[j+1] = AV[j]; }
+            V[j+1] *= 1.0/theta;
+         }
       }
-      else
+
+      int nd = 0;
+      for (int i = 0; i < ns; i++)
       {
-         prec->Mult(b, r);
+         dots_x[nd] = &V[i]; dots_y[nd++] = &r;
       }
-   }
-   else
-   {
-      if (iterative_mode)
+      for (int j = 0; j < ns; j++)
       {
-         subtract(b, r, r);
+         for (int i = 0; i < ns; i++)
+         {
+            dots_x[nd] = &V[i]; dots_y[nd++] = &AV[j];
+         }
       }
-      else
+      for (int j = 0; j < ns; j++)
       {
-         r = b;
+         for (int i = 0; i < num_prev; i++)
+         {
+            dots_x[nd] = &AP[i]; dots_y[nd++] = &V[j];
+         }
       }
-   }
-   real_t beta = initial_norm = Norm(r);  // beta = ||r||
-   MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
-
-   final_norm = std::max(rel_tol*beta, abs_tol);
-
-   if (Monitor(0, beta, r, x) || beta <= final_norm)
-   {
-      final_norm = beta;
-      final_iter = 0;
-      converged = true;
-      j = 0;
-      goto finish;
-   }
+      for (int i = 0; i < num_prev; i++)
+      {
+         dots_x[nd] = &P[i]; dots_y[nd++] = &r;
+      }
+      StartDots(nd, dots_x.data(), dots_y.data(), dots.GetData());
+      FinishDots();
+      for (int i = 0; i < ns; i++) { g(i) = dots(i); }
+      G = dots.GetData() + ns;
 
-   if (print_options.iterations || print_options.first_and_last)
-   {
-      mfem::out << "   Pass : " << setw(2) << 1
-                << "   Iteration : " << setw(3) << 0
+      nom = g(0); // (B r, r)
+      MFEM_VERIFY(IsFinite(nom), "nom = " << nom);
+      if (it == 0)
+      {
+         nom0 = nom;
+         if (nom0 >= 0.0) { initial_norm = sqrt(nom0); }
+         r0 = std::max(nom*rel_tol*rel_tol, abs_tol*abs_tol);
+      }
+      if (print_options.iterations || (it == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << it << "  (B r, r) = "
+                   << nom << (print_options.iterations ? "\n" : " ...\n");
+      }
+      if (nom < 0.0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "SStepCG: The preconditioner is not positive definite."
+                      " (Br, r) = " << nom << '\n';
+         }
+         final_iter = it;
+         break;
+      }
+      if (Monitor(it, nom, r, x) || nom <= r0)
+      {
+         converged = true;
+         final_iter = it;
+         break;
+      }
+      if (it >= max_iter)
+      {
+         break;
+      }
+
+      // New estimate of the basis scaling: Rayleigh quotient of B A at V_0
+      const real_t rayleigh = (ns > 1 && G(0,0) > 0.0) ?
+                              theta*G(1,0)/G(0,0) : 0.0;
+
+      if (num_prev == ns)
+      {
+         // A-orthogonalize against the previous directions:
+         // P = V + P_prev Bc, Bc = -G_prev^{-1} W, g = g + Bc^t h,
+         // G = G + W^t Bc + Bc^t W + Bc^t G_prev Bc
+         W = dots.GetData() + ns + ns*ns;
+         for (int i = 0; i < ns; i++) { h(i) = dots(ns + 2*ns*ns + i); }
+         Bc = W;
+         for (int j = 0; j < ns; j++) { CholeskySolve(Gfact, ns, Bc.GetColumn(j)); }
+         Bc.Neg();
+         for (int j = 0; j < ns; j++)
+         {
+            for (int i = 0; i < ns; i++)
+            {
+               V[j].Add(Bc(i,j), P[i]);
+               AV[j].Add(Bc(i,j), AP[i]);
+            }
+         }
+         Bc.AddMultTranspose(h, g);
+         mfem::Mult(Gprev, Bc, GBc);
+         GBc += W;
+         AddMultAtB(Bc, GBc, G);
+         AddMultAtB(W, Bc, G);
+      }
+      std::swap(P, V);
+      std::swap(AP, AV);
+
+      // Minimize the A-norm of the error over the new directions, using the
+      // Cholesky factorization G = L L^t. If the directions become linearly
+      // dependent, e.g. when the Krylov space is exhausted, only the leading
+      // independent ones are used and the A-orthogonalization is restarted.
+      G.Symmetrize();
+      Gprev = G;
+      const int k = PartialCholesky(G, Gfact, dep_tol);
+      if (k == 0)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "SStepCG: The operator is not positive definite."
+                      " (Ap, p) = " << G(0,0) << '\n';
+         }
+         final_iter = it;
+         break;
+      }
+      CholeskySolve(Gfact, k, g.GetData());
+      for (int j = 0; j < k; j++)
+      {
+         x.Add( g(j), P[j]);  //  x = x + P G^{-1} P^t r
+         r.Add(-g(j), AP[j]); //  r = r - A P G^{-1} P^t r
+      }
+      num_prev = (k == ns) ? ns : 0;
+      if (rayleigh > 0.0) { theta = rayleigh; }
+      it += ns;
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter << "  (B r, r) = "
+                << nom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "SStepCG: Number of iterations: " << final_iter << '\n';
+   }
+   if ((print_options.summary || print_options.iterations ||
+        print_options.first_and_last) && final_iter > 0)
+   {
+      const auto arf = pow (nom/nom0, 0.5/final_iter);
+      mfem::out << "Average reduction factor = " << arf << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "SStepCG: No convergence!" << '\n';
+   }
+
+   final_norm = sqrt(std::abs(nom));
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
+
+inline void GeneratePlaneRotation(real_t &dx, real_t &dy,
+                                  real_t &cs, real_t &sn)
+{
+   if (dy == 0.0)
+   {
+      cs = 1.0;
+      sn = 0.0;
+   }
+   else if (fabs(dy) > fabs(dx))
+   {
+      real_t temp = dx / dy;
+      sn = 1.0 / sqrt( 1.0 + temp*temp );
+      cs = temp * sn;
+   }
+   else
+   {
+      real_t temp = dy / dx;
+      cs = 1.0 / sqrt( 1.0 + temp*temp );
+      sn = temp * cs;
+   }
+}
+
+inline void ApplyPlaneRotation(real_t &dx, real_t &dy, real_t &cs, real_t &sn)
+{
+   real_t temp = cs * dx + sn * dy;
+   dy = -sn * dx + cs * dy;
+   dx = temp;
+}
+
+inline void Update(Vector &x, int k, DenseMatrix &h, Vector &s,
+                   Array<Vector*> &v)
+{
+   Vector y(s);
+
+   // Backsolve:
+   for (int i = k; i >= 0; i--)
+   {
+      y(i) /= h(i,i);
+      for (int j = i - 1; j >= 0; j--)
+      {
+         y(j) -= h(j,i) * y(i);
+      }
+   }
+
+   for (int j = 0; j <= k; j++)
+   {
+      x.Add(y(j), *v[j]);
+   }
+}
+
+void GMRESSolver::Mult(const Vector &b, Vector &x) const
+{
+   // Generalized Minimum Residual method following the algorithm
+   // on p. 20 of the SIAM Templates book.
+
+   int n = width;
+
+   DenseMatrix H(m+1, m);
+   Vector s(m+1), cs(m+1), sn(m+1);
+   Vector r(n), w(n), x_monitor;
+   Array<Vector *> v;
+
+   b.UseDevice(true);
+   x.UseDevice(true);
+   r.UseDevice(true);
+   w.UseDevice(true);
+
+   if (ControllerRequiresUpdate())
+   {
+      x_monitor.SetSize(n);
+      x_monitor.UseDevice(true);
+   }
+   else
+   {
+      x_monitor.MakeRef(x, 0, n);
+   }
+
+   int i, j, k;
+
+   if (iterative_mode)
+   {
+      oper->Mult(x, r);
+   }
+   else
+   {
+      x = 0.0;
+   }
+
+   if (prec)
+   {
+      if (iterative_mode)
+      {
+         subtract(b, r, w);
+         prec->Mult(w, r);    // r = M (b - A x)
+      }
+      else
+      {
+         prec->Mult(b, r);
+      }
+   }
+   else
+   {
+      if (iterative_mode)
+      {
+         subtract(b, r, r);
+      }
+      else
+      {
+         r = b;
+      }
+   }
+   real_t beta = initial_norm = Norm(r);  // beta = ||r||
+   MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
+
+   final_norm = std::max(rel_tol*beta, abs_tol);
+
+   if (Monitor(0, beta, r, x) || beta <= final_norm)
+   {
+      final_norm = beta;
+      final_iter = 0;
+      converged = true;
+      j = 0;
+      goto finish;
+   }
+
+   if (print_options.iterations || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << 1
+                << "   Iteration : " << setw(3) << 0
                 << "  ||B r|| = " << beta
                 << (print_options.first_and_last ? " ...\n" : "\n");
    }
@@ -1549,30 +2082,874 @@ void FGMRESSolver::Mult(const Vector &b, Vector &x) const
    Monitor(final_iter, final_norm, r, x, true);
 }
 
+void SStepGMRESSolver::UpdateVectors()
+{
+   MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+
+   for (Vector *v : {&r, &w})
+   {
+      v->SetSize(width, mt);
+      v->UseDevice(true);
+   }
+   ResizeVectors(Q, m+1, width, mt);
+   ResizeVectors(V, s_steps, width, mt);
+}
 
-int GMRES(const Operator &A, Vector &x, const Vector &b, Solver &M,
-          int &max_iter, int m, real_t &tol, real_t atol, int printit)
+void SStepGMRESSolver::SetKDim(int dim)
 {
-   MFEM_PERF_FUNCTION;
+   MFEM_VERIFY(dim > 0, "invalid dimension: " << dim);
+   m = dim;
+   if (oper) { UpdateVectors(); }
+}
 
-   GMRESSolver gmres;
-   gmres.SetPrintLevel(printit);
-   gmres.SetMaxIter(max_iter);
-   gmres.SetKDim(m);
-   gmres.SetRelTol(sqrt(tol));
-   gmres.SetAbsTol(sqrt(atol));
-   gmres.SetOperator(A);
-   gmres.SetPreconditioner(M);
-   gmres.Mult(b, x);
-   max_iter = gmres.GetNumIterations();
-   tol = gmres.GetFinalNorm()*gmres.GetFinalNorm();
-   return gmres.GetConverged();
+void SStepGMRESSolver::SetNumSteps(int s)
+{
+   MFEM_VERIFY(s > 0, "invalid number of steps: " << s);
+   s_steps = s;
+   if (oper) { UpdateVectors(); }
 }
 
-void GMRES(const Operator &A, Solver &B, const Vector &b, Vector &x,
-           int print_iter, int max_num_iter, int m, real_t rtol, real_t atol)
+void SStepGMRESSolver::Mult(const Vector &b, Vector &x) const
 {
-   GMRES(A, x, b, B, max_num_iter, m, rtol, atol, print_iter);
+   // The Arnoldi vectors Q and the Hessenberg matrix H, triangularized with
+   // Givens rotations, are stored as in GMRESSolver
+   DenseMatrix H(m+1, m), C, W, G, L, C2, W2, L2, Z;
+   Vector s(m+1), cs(m+1), sn(m+1), dots, x_monitor;
+   std::vector<const Vector *> dots_x, dots_y;
+   Array<Vector *> q(m+1);
+   for (int i = 0; i <= m; i++) { q[i] = &Q[i]; }
+   // Relative size of the Cholesky pivots below which a new basis vector is
+   // treated as linearly dependent on the previous ones
+   const real_t dep_tol = sqrt(std::numeric_limits<real_t>::epsilon());
+   // Scaling of the monomial basis, estimate of the growth factor of B A
+   real_t theta = 1.0;
+
+   b.UseDevice(true);
+   x.UseDevice(true);
+   if (ControllerRequiresUpdate())
+   {
+      x_monitor.SetSize(width);
+      x_monitor.UseDevice(true);
+   }
+   else
+   {
+      x_monitor.MakeRef(x, 0, width);
+   }
+
+   if (iterative_mode)
+   {
+      oper->Mult(x, w);
+      subtract(b, w, w);
+   }
+   else
+   {
+      w = b;
+      x = 0.0;
+   }
+   if (prec) { prec->Mult(w, r); } // r = B (b - A x)
+   else { r = w; }
+   real_t beta = initial_norm = Norm(r);
+   MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
+
+   const real_t target = std::max(rel_tol*beta, abs_tol);
+   final_norm = beta;
+   int j = 0, pass = 1;
+   converged = false;
+   if (Monitor(0, beta, r, x) || beta <= target)
+   {
+      converged = true;
+   }
+   else if (print_options.iterations || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << 1
+                << "   Iteration : " << setw(3) << 0
+                << "  ||B r|| = " << beta
+                << (print_options.first_and_last ? " ...\n" : "\n");
+   }
+
+   while (!converged)
+   {
+      Q[0].Set(1.0/beta, r);
+      s = 0.0; s(0) = beta;
+      // Q[0..k] are the current Arnoldi vectors
+      int k = 0;
+      bool breakdown = false;
+      while (k < m && j < max_iter && !breakdown && !converged)
+      {
+         const int ns = std::min(std::min(s_steps, m - k), max_iter - j);
+
+         // Scaled monomial basis, V_i = (B A)^{i+1} q_k / theta^{i+1}
+         for (int i = 0; i < ns; i++)
+         {
+            const Vector &v = (i == 0) ? Q[k] : V[i-1];
+            if (prec)
+            {
+               oper->Mult(v, w);
+               prec->Mult(w, V[i]);
+            }
+            else
+            {
+               oper->Mult(v, V[i]);
+            }
+            V[i] *= 1.0/theta;
+         }
+
+         // All inner products of the block, reduced together: C(l,i) =
+         // (Q_l, V_i) and the lower triangle of W(l,i) = (V_l, V_i)
+         const int nd = ns*(k+1) + ns*(ns+1)/2;
+         dots.SetSize(nd);
+         dots_x.resize(nd);
+         dots_y.resize(nd);
+         int d = 0;
+         for (int i = 0; i < ns; i++)
+         {
+            for (int l = 0; l <= k; l++)
+            {
+               dots_x[d] = &Q[l]; dots_y[d++] = &V[i];
+            }
+            for (int l = 0; l <= i; l++)
+            {
+               dots_x[d] = &V[l]; dots_y[d++] = &V[i];
+            }
+         }
+         StartDots(nd, dots_x.data(), dots_y.data(), dots.GetData());
+         FinishDots();
+         C.SetSize(k+1, ns);
+         W.SetSize(ns);
+         d = 0;
+         for (int i = 0; i < ns; i++)
+         {
+            for (int l = 0; l <= k; l++) { C(l,i) = dots(d++); }
+            for (int l = 0; l <= i; l++) { W(l,i) = W(i,l) = dots(d++); }
+         }
+         MFEM_VERIFY(IsFinite(W(ns-1,ns-1)), "(V, V) = " << W(ns-1,ns-1));
+
+         // Cholesky QR of the vectors projected out of the previous ones:
+         // V - Q C = Q_new L^t, where L L^t = W - C^t C. The vectors that are
+         // numerically dependent on the previous ones are dropped.
+         G = W;
+         AddMult_a_AtB(-1.0, C, C, G);
+         int kd = PartialCholesky(G, L, dep_tol, &W);
+         for (int i = 0; i < kd; i++)
+         {
+            Vector &qi = Q[k+1+i];
+            qi = V[i];
+            for (int l = 0; l <= k; l++) { qi.Add(-C(l,i), Q[l]); }
+            for (int l = 0; l < i; l++) { qi.Add(-L(i,l), Q[k+1+l]); }
+            qi *= 1.0/L(i,i);
+         }
+         if (kd == 0)
+         {
+            // The Gram matrix cannot resolve the first vector: orthogonalize
+            // it with a separate norm, as in GMRESSolver
+            Vector &q1 = Q[k+1];
+            q1 = V[0];
+            for (int l = 0; l <= k; l++) { q1.Add(-C(l,0), Q[l]); }
+            L.SetSize(1);
+            L(0,0) = Norm(q1);
+            MFEM_VERIFY(IsFinite(L(0,0)), "Norm(w) = " << L(0,0));
+            if (L(0,0) > 0.0)
+            {
+               q1 *= 1.0/L(0,0);
+               kd = 1;
+            }
+            else
+            {
+               breakdown = true; // B A q_k is in the span of Q[0..k]
+            }
+         }
+         if (kd > 0)
+         {
+            // Second pass, with one more reduction, to restore the
+            // orthogonality lost in the first one: Q_1 - Q C_2 = Q_new L_2^t,
+            // so that V = Q (C + C_2 L^t) + Q_new (L L_2)^t
+            const int nd2 = kd*(k+1) + kd*(kd+1)/2;
+            d = 0;
+            for (int i = 0; i < kd; i++)
+            {
+               for (int l = 0; l <= k+1+i; l++)
+               {
+                  dots_x[d] = &Q[l]; dots_y[d++] = &Q[k+1+i];
+               }
+            }
+            MFEM_ASSERT(d == nd2, "invalid number of inner products");
+            StartDots(nd2, dots_x.data(), dots_y.data(), dots.GetData());
+            FinishDots();
+            C2.SetSize(k+1, kd);
+            W2.SetSize(kd);
+            d = 0;
+            for (int i = 0; i < kd; i++)
+            {
+               for (int l = 0; l <= k; l++) { C2(l,i) = dots(d++); }
+               for (int l = 0; l <= i; l++) { W2(l,i) = W2(i,l) = dots(d++); }
+            }
+            G = W2;
+            AddMult_a_AtB(-1.0, C2, C2, G);
+            kd = PartialCholesky(G, L2, dep_tol);
+            for (int i = 0; i < kd; i++)
+            {
+               Vector &qi = Q[k+1+i];
+               for (int l = 0; l <= k; l++) { qi.Add(-C2(l,i), Q[l]); }
+               for (int l = 0; l < i; l++) { qi.Add(-L2(i,l), Q[k+1+l]); }
+               qi *= 1.0/L2(i,i);
+            }
+            for (int i = 0; i < kd; i++)
+            {
+               for (int p = 0; p <= i; p++)
+               {
+                  for (int l = 0; l <= k; l++) { C(l,i) += C2(l,p)*L(i,p); }
+               }
+               for (int l = 0; l <= i; l++) // L(i,p), p > l, are still needed
+               {
+                  real_t v = 0.0;
+                  for (int p = l; p <= i; p++) { v += L(i,p)*L2(p,l); }
+                  L(i,l) = v;
+               }
+            }
+            if (kd == 0) { breakdown = true; }
+         }
+         const int nc = std::max(kd, 1);
+
+         // The new columns of H follow from B A u_t = theta V_t, where u_0 =
+         // q_k and u_t = V_{t-1}. With u_t = Q U(:,t), theta V_t = Q Y(:,t)
+         // and B A Q_{0:k-1} = Q H_old, they are (Y - H_old U_top) U_sub^{-1},
+         // where U_top and U_sub are the rows 0..k-1 and k..k+nc-1 of U. The
+         // previous rotations are applied to Y, which turns H_old into its
+         // stored triangular factor.
+         Z.SetSize(k+1+nc, nc);
+         Z = 0.0;
+         for (int t = 0; t < nc; t++)
+         {
+            for (int l = 0; l <= k; l++) { Z(l,t) = theta*C(l,t); }
+            if (t < kd)
+            {
+               for (int l = 0; l <= t; l++) { Z(k+1+l,t) = theta*L(t,l); }
+            }
+            for (int l = 0; l < k; l++)
+            {
+               ApplyPlaneRotation(Z(l,t), Z(l+1,t), cs(l), sn(l));
+            }
+            if (t == 0) { continue; } // U(:,0) = e_k
+            for (int l = 0; l < k; l++)
+            {
+               for (int c = l; c < k; c++) { Z(l,t) -= H(l,c)*C(c,t-1); }
+            }
+            // U_sub(0,t) = C(k,t-1) and U_sub(c,t) = L(t-1,c-1) for c > 0
+            for (int c = 0; c < t; c++)
+            {
+               const real_t u = (c == 0) ? C(k,t-1) : L(t-1,c-1);
+               for (int l = 0; l < Z.Height(); l++) { Z(l,t) -= u*Z(l,c); }
+            }
+            for (int l = 0; l < Z.Height(); l++) { Z(l,t) /= L(t-1,t-1); }
+         }
+
+         for (int t = 0; t < nc && !converged; t++)
+         {
+            const int i = k + t;
+            for (int l = 0; l <= i+1; l++) { H(l,i) = Z(l,t); }
+            for (int l = k; l < i; l++)
+            {
+               ApplyPlaneRotation(H(l,i), H(l+1,i), cs(l), sn(l));
+            }
+            GeneratePlaneRotation(H(i,i), H(i+1,i), cs(i), sn(i));
+            ApplyPlaneRotation(H(i,i), H(i+1,i), cs(i), sn(i));
+            ApplyPlaneRotation(s(i), s(i+1), cs(i), sn(i));
+            j++;
+
+            const real_t resid = fabs(s(i+1));
+            MFEM_VERIFY(IsFinite(resid), "resid = " << resid);
+
+            if (ControllerRequiresUpdate())
+            {
+               x_monitor = x;
+               Update(x_monitor, i, H, s, q);
+            }
+
+            if (Monitor(j, resid, r, x_monitor) || resid <= target)
+            {
+               Update(x, i, H, s, q);
+               final_norm = resid;
+               converged = true;
+            }
+            else if (print_options.iterations)
+            {
+               mfem::out << "   Pass : " << setw(2) << pass
+                         << "   Iteration : " << setw(3) << j
+                         << "  ||B r|| = " << resid << '\n';
+            }
+         }
+         k += nc;
+         if (W(ns-1,ns-1) > 0.0) { theta *= pow(W(ns-1,ns-1), 0.5/ns); }
+      }
+      if (converged) { break; }
+
+      Update(x, k-1, H, s, q);
+
+      oper->Mult(x, w);
+      subtract(b, w, w);
+      if (prec) { prec->Mult(w, r); } // r = B (b - A x)
+      else { r = w; }
+      beta = final_norm = Norm(r);
+      MFEM_VERIFY(IsFinite(beta), "beta = " << beta);
+      if (beta <= target)
+      {
+         converged = true;
+      }
+      else if (j >= max_iter)
+      {
+         break;
+      }
+      else
+      {
+         if (print_options.iterations) { mfem::out << "Restarting..." << '\n'; }
+         pass++;
+      }
+   }
+   final_iter = j;
+
+   if ((print_options.iterations && converged) || print_options.first_and_last)
+   {
+      mfem::out << "   Pass : " << setw(2) << pass
+                << "   Iteration : " << setw(3) << final_iter
+                << "  ||B r|| = " << final_norm << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "SStepGMRES: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "SStepGMRES: No convergence!\n";
+   }
+
+   Monitor(final_iter, final_norm, r, x, true);
+}
+
+
+int GMRES(const Operator &A, Vector &x, const Vector &b, Solver &M,
+          int &max_iter, int m, real_t &tol, real_t atol, int printit)
+{
+   MFEM_PERF_FUNCTION;
+
+   GMRESSolver gmres;
+   gmres.SetPrintLevel(printit);
+   gmres.SetMaxIter(max_iter);
+   gmres.SetKDim(m);
+   gmres.SetRelTol(sqrt(tol));
+   gmres.SetAbsTol(sqrt(atol));
+   gmres.SetOperator(A);
+   gmres.SetPreconditioner(M);
+   gmres.Mult(b, x);
+   max_iter = gmres.GetNumIterations();
+   tol = gmres.GetFinalNorm()*gmres.GetFinalNorm();
+   return gmres.GetConverged();
+}
+
+void GMRES(const Operator &A, Solver &B, const Vector &b, Vector &x,
+           int print_iter, int max_num_iter, int m, real_t rtol, real_t atol)
+{
+   GMRES(A, x, b, B, max_num_iter, m, rtol, atol, print_iter);
+}
+
+void BlockCGSolver::Mult(const Vector &b, Vector &x) const
+{
+   Array<const Vector *> B({&b});
+   Array<Vector *> X({&x});
+   ArrayMult(B, X);
+}
+
+void BlockCGSolver::ArrayMult(const Array<const Vector *> &B,
+                              Array<Vector *> &X) const
+{
+   MFEM_VERIFY(B.Size() == X.Size(), "incompatible numbers of vectors");
+   const int k = B.Size();
+   const MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+   for (std::vector<Vector> *vecs : {&R, &Z, &P, &Q})
+   {
+      ResizeVectors(*vecs, k, width, mt);
+   }
+
+   // Only the first na columns of R, Z, P and Q are active; act[j] is the
+   // index of the right-hand side of column j
+   int na = k;
+   Array<int> act(k), keep;
+   Array<const Vector *> in(k);
+   Array<Vector *> out(k);
+   for (int j = 0; j < k; j++)
+   {
+      act[j] = j;
+      X[j]->UseDevice(true);
+      in[j] = X[j];
+      out[j] = &R[j];
+   }
+   auto ArrayApply = [&](const Operator &op, const std::vector<Vector> &from,
+                         std::vector<Vector> &to)
+   {
+      in.SetSize(na);
+      out.SetSize(na);
+      for (int j = 0; j < na; j++)
+      {
+         in[j] = &from[j];
+         out[j] = &to[j];
+      }
+      op.ArrayMult(in, out);
+   };
+
+   if (iterative_mode)
+   {
+      oper->ArrayMult(in, out);
+      for (int j = 0; j < k; j++) { subtract(*B[j], R[j], R[j]); }
+   }
+   else
+   {
+      for (int j = 0; j < k; j++)
+      {
+         R[j] = *B[j];
+         *X[j] = 0.0;
+      }
+   }
+
+   // Relative size of the Cholesky pivots below which the block of vectors is
+   // treated as linearly dependent
+   const real_t dep_tol = sqrt(std::numeric_limits<real_t>::epsilon());
+   DenseMatrix RtZ, RtZ_fact, PtQ, PtQ_fact, Coef;
+   // Last (B r, r) and stopping threshold of each right-hand side
+   Vector nom(k), r0(k);
+   real_t max_nom0 = 0.0;
+   bool restart = true, rtz_fact_ok = false;
+
+   converged = false;
+   final_iter = max_iter;
+   for (int it = 0; true; )
+   {
+      if (prec)
+      {
+         ArrayApply(*prec, R, Z);  //  Z = B R
+      }
+      else
+      {
+         for (int j = 0; j < na; j++) { Z[j] = R[j]; }
+      }
+      BlockDots(na, R.data(), na, Z.data(), RtZ);
+      RtZ.Symmetrize();
+
+      bool negative = false;
+      for (int j = 0; j < na; j++)
+      {
+         nom(act[j]) = RtZ(j,j);
+         MFEM_VERIFY(IsFinite(nom(act[j])), "nom = " << nom(act[j]));
+         if (nom(act[j]) < 0.0) { negative = true; }
+      }
+      const real_t max_nom = nom.Max();
+      if (it == 0)
+      {
+         max_nom0 = max_nom;
+         if (max_nom0 >= 0.0) { initial_norm = sqrt(max_nom0); }
+         for (int j = 0; j < k; j++)
+         {
+            r0(j) = std::max(nom(j)*rel_tol*rel_tol, abs_tol*abs_tol);
+         }
+      }
+      if (print_options.iterations || (it == 0 && print_options.first_and_last))
+      {
+         mfem::out << "   Iteration : " << setw(3) << it
+                   << "  max (B r, r) = " << max_nom
+                   << (print_options.iterations ? "\n" : " ...\n");
+      }
+      if (negative)
+      {
+         if (print_options.warnings)
+         {
+            mfem::out << "BlockCG: The preconditioner is not positive "
+                      "definite.\n";
+         }
+         final_iter = it;
+         break;
+      }
+
+      // Remove the converged columns from the block
+      keep.SetSize(0);
+      for (int j = 0; j < na; j++)
+      {
+         if (RtZ(j,j) > r0(act[j])) { keep.Append(j); }
+      }
+      if (keep.Size() < na)
+      {
+         const int nk = keep.Size();
+         for (int c = 0; c < nk; c++)
+         {
+            const int j = keep[c];
+            if (c == j) { continue; }
+            R[c].Swap(R[j]);
+            Z[c].Swap(Z[j]);
+            act[c] = act[j];
+         }
+         Coef.SetSize(nk);
+         for (int c2 = 0; c2 < nk; c2++)
+         {
+            for (int c1 = 0; c1 < nk; c1++)
+            {
+               Coef(c1,c2) = RtZ(keep[c1],keep[c2]);
+            }
+         }
+         RtZ = Coef;
+         na = nk;
+         restart = true;
+      }
+
+      if (na == 0 || Monitor(it, max_nom, R[0], *X[act[0]]))
+      {
+         converged = true;
+         final_iter = it;
+         break;
+      }
+      if (it >= max_iter)
+      {
+         break;
+      }
+
+      if (restart)
+      {
+         for (int j = 0; j < na; j++) { P[j] = Z[j]; }
+      }
+      else
+      {
+         // P = Z + P beta, beta = (R_old^t Z_old)^{-1} (R^t Z)
+         Coef = RtZ;
+         for (int c = 0; c < na; c++)
+         {
+            CholeskySolve(RtZ_fact, na, Coef.GetColumn(c));
+         }
+         for (int c = 0; c < na; c++)
+         {
+            Q[c] = Z[c];
+            for (int i = 0; i < na; i++) { Q[c].Add(Coef(i,c), P[i]); }
+         }
+         std::swap(P, Q);
+      }
+      rtz_fact_ok = (PartialCholesky(RtZ, RtZ_fact, dep_tol) == na);
+
+      ArrayApply(*oper, P, Q);  //  Q = A P
+      BlockDots(na, P.data(), na, Q.data(), PtQ);
+      PtQ.Symmetrize();
+      if (PartialCholesky(PtQ, PtQ_fact, dep_tol) < na)
+      {
+         if (restart)
+         {
+            if (print_options.warnings)
+            {
+               mfem::out << "BlockCG: The operator is not positive definite or"
+                         " the residuals are linearly dependent.\n";
+            }
+            final_iter = it;
+            break;
+         }
+         // Restart the recurrences with P = Z
+         restart = true;
+         continue;
+      }
+
+      // X = X + P alpha, R = R - Q alpha, alpha = (P^t A P)^{-1} (R^t Z)
+      Coef = RtZ;
+      for (int c = 0; c < na; c++)
+      {
+         CholeskySolve(PtQ_fact, na, Coef.GetColumn(c));
+      }
+      for (int c = 0; c < na; c++)
+      {
+         for (int i = 0; i < na; i++)
+         {
+            X[act[c]]->Add( Coef(i,c), P[i]);
+            R[c].Add(-Coef(i,c), Q[i]);
+         }
+      }
+      restart = !rtz_fact_ok;
+      it++;
+   }
+   const real_t max_nom = nom.Max();
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter
+                << "  max (B r, r) = " << max_nom << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "BlockCG: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "BlockCG: No convergence!" << '\n';
+   }
+
+   final_norm = sqrt(std::abs(max_nom));
+
+   Monitor(final_iter, final_norm, R[0], *X[0], true);
+}
+
+
+void BlockGMRESSolver::Mult(const Vector &b, Vector &x) const
+{
+   Array<const Vector *> B({&b});
+   Array<Vector *> X({&x});
+   ArrayMult(B, X);
+}
+
+void BlockGMRESSolver::ArrayMult(const Array<const Vector *> &B,
+                                 Array<Vector *> &X) const
+{
+   MFEM_VERIFY(B.Size() == X.Size(), "incompatible numbers of vectors");
+   const int k = B.Size();
+   const MemoryType mt = GetMemoryType(oper->GetMemoryClass());
+   // Block Krylov basis, followed by k work vectors
+   ResizeVectors(V, (m+2)*k, width, mt);
+   Vector *T = V.data() + (m+1)*k;
+
+   // Relative size of the Cholesky pivots below which a new basis vector is
+   // treated as linearly dependent on the previous ones
+   const real_t dep_tol = 1e4*std::numeric_limits<real_t>::epsilon();
+   DenseMatrix H((m+1)*k, m*k), S((m+1)*k, k), C, Gram, L, Y;
+   // Plane rotations: rotation t acts on rows rot_row[t] and rot_row[t]+1
+   Array<int> rot_row;
+   std::vector<real_t> rot_cs, rot_sn;
+   Array<int> act;
+   Array<const Vector *> in(k), Xc(k);
+   Array<Vector *> out(k);
+   Vector resid(k), target(k);
+   for (int j = 0; j < k; j++)
+   {
+      X[j]->UseDevice(true);
+      Xc[j] = X[j];
+   }
+   if (!iterative_mode)
+   {
+      for (int j = 0; j < k; j++) { *X[j] = 0.0; }
+   }
+
+   converged = false;
+   final_iter = max_iter;
+   int it = 0;
+   for (int pass = 1; true; pass++)
+   {
+      // V_0 = B (b - A x) for all right-hand sides
+      out.SetSize(k);
+      for (int j = 0; j < k; j++) { out[j] = &T[j]; }
+      oper->ArrayMult(Xc, out);
+      for (int j = 0; j < k; j++) { subtract(*B[j], T[j], T[j]); }
+      if (prec)
+      {
+         in.SetSize(k);
+         for (int j = 0; j < k; j++) { in[j] = &T[j]; out[j] = &V[j]; }
+         prec->ArrayMult(in, out);
+      }
+      else
+      {
+         for (int j = 0; j < k; j++) { V[j].Swap(T[j]); }
+      }
+      BlockDots(k, V.data(), k, V.data(), Gram);
+      for (int j = 0; j < k; j++)
+      {
+         resid(j) = sqrt(Gram(j,j));
+         MFEM_VERIFY(IsFinite(resid(j)), "||B r|| = " << resid(j));
+      }
+      if (pass == 1)
+      {
+         initial_norm = resid.Max();
+         for (int j = 0; j < k; j++)
+         {
+            target(j) = std::max(rel_tol*resid(j), abs_tol);
+         }
+      }
+      final_norm = resid.Max();
+      if (print_options.iterations || (pass == 1 && print_options.first_and_last))
+      {
+         mfem::out << "   Pass : " << setw(2) << pass
+                   << "   Iteration : " << setw(3) << it
+                   << "  max ||B r|| = " << final_norm
+                   << (print_options.iterations ? "\n" : " ...\n");
+      }
+
+      // The block of this pass contains the unconverged right-hand sides,
+      // compacted at the beginning of V
+      act.SetSize(0);
+      for (int j = 0; j < k; j++)
+      {
+         if (resid(j) > target(j))
+         {
+            if (act.Size() != j) { V[act.Size()].Swap(V[j]); }
+            act.Append(j);
+         }
+      }
+      if (act.Size() == 0 || Monitor(it, final_norm, V[0], *X[0]))
+      {
+         converged = true;
+         final_iter = it;
+         break;
+      }
+      if (it >= max_iter)
+      {
+         break;
+      }
+
+      // Cholesky QR of the residuals: R = V_0 S, S = L^t. Residuals that are
+      // dependent on the previous ones are left for the next pass.
+      C.SetSize(act.Size());
+      for (int c2 = 0; c2 < act.Size(); c2++)
+      {
+         for (int c1 = 0; c1 < act.Size(); c1++)
+         {
+            C(c1,c2) = Gram(act[c1],act[c2]);
+         }
+      }
+      const int kb = PartialCholesky(C, L, dep_tol);
+      MFEM_VERIFY(kb > 0, "invalid residual");
+      S = 0.0;
+      for (int c = 0; c < kb; c++)
+      {
+         for (int i = 0; i < c; i++) { V[c].Add(-L(c,i), V[i]); }
+         V[c] *= 1.0/L(c,c);
+         for (int i = 0; i <= c; i++) { S(i,c) = L(c,i); }
+      }
+
+      H = 0.0;
+      rot_row.SetSize(0);
+      rot_cs.clear();
+      rot_sn.clear();
+      int j = 0;
+      bool pass_done = false;
+      while (!pass_done)
+      {
+         Vector *Vj = V.data() + j*kb, *W = V.data() + (j+1)*kb;
+         // W = B A V_j
+         in.SetSize(kb);
+         out.SetSize(kb);
+         for (int c = 0; c < kb; c++)
+         {
+            in[c] = &Vj[c];
+            out[c] = prec ? &T[c] : &W[c];
+         }
+         oper->ArrayMult(in, out);
+         if (prec)
+         {
+            for (int c = 0; c < kb; c++)
+            {
+               in[c] = &T[c];
+               out[c] = &W[c];
+            }
+            prec->ArrayMult(in, out);
+         }
+
+         // Block classical Gram-Schmidt, with reorthogonalization
+         const int nv = (j+1)*kb;
+         for (int sweep = 0; sweep < 2; sweep++)
+         {
+            BlockDots(nv, V.data(), kb, W, C);
+            for (int c = 0; c < kb; c++)
+            {
+               for (int i = 0; i < nv; i++)
+               {
+                  W[c].Add(-C(i,c), V[i]);
+                  H(i, j*kb + c) += C(i,c);
+               }
+            }
+         }
+
+         // Cholesky QR of the new block: W = V_{j+1} H_{j+1,j}
+         BlockDots(kb, W, kb, W, Gram);
+         Gram.Symmetrize();
+         const int rank = PartialCholesky(Gram, L, dep_tol);
+         for (int c = 0; c < rank; c++)
+         {
+            for (int i = 0; i < c; i++) { W[c].Add(-L(c,i), W[i]); }
+            W[c] *= 1.0/L(c,c);
+            for (int i = 0; i <= c; i++) { H(nv + i, j*kb + c) = L(c,i); }
+         }
+         for (int c = rank; c < kb; c++)
+         {
+            for (int i = 0; i < rank; i++) { H(nv + i, j*kb + c) = L(c,i); }
+         }
+         // If the block is (partially) dependent, the Krylov space is nearly
+         // invariant and the pass ends after this iteration.
+         pass_done = (rank < kb);
+
+         // Reduce the new columns to upper triangular form with rotations
+         for (int c = 0; c < kb; c++)
+         {
+            const int col = j*kb + c;
+            for (int t = 0; t < rot_row.Size(); t++)
+            {
+               ApplyPlaneRotation(H(rot_row[t],col), H(rot_row[t]+1,col),
+                                  rot_cs[t], rot_sn[t]);
+            }
+            for (int row = col + kb; row > col; row--)
+            {
+               real_t cs, sn;
+               GeneratePlaneRotation(H(row-1,col), H(row,col), cs, sn);
+               ApplyPlaneRotation(H(row-1,col), H(row,col), cs, sn);
+               for (int a = 0; a < kb; a++)
+               {
+                  ApplyPlaneRotation(S(row-1,a), S(row,a), cs, sn);
+               }
+               rot_row.Append(row-1);
+               rot_cs.push_back(cs);
+               rot_sn.push_back(sn);
+            }
+         }
+
+         // Residual norms of the least squares problems
+         bool all_converged = true;
+         real_t max_resid = 0.0;
+         for (int a = 0; a < kb; a++)
+         {
+            real_t r2 = 0.0;
+            for (int row = nv; row < nv + kb; row++) { r2 += S(row,a)*S(row,a); }
+            resid(act[a]) = sqrt(r2);
+            max_resid = std::max(max_resid, resid(act[a]));
+            if (resid(act[a]) > target(act[a])) { all_converged = false; }
+         }
+         it++;
+         j++;
+         if (print_options.iterations)
+         {
+            mfem::out << "   Pass : " << setw(2) << pass
+                      << "   Iteration : " << setw(3) << it
+                      << "  max ||B r|| = " << max_resid << '\n';
+         }
+         pass_done = pass_done || all_converged || j == m || it >= max_iter;
+      }
+
+      // Solve the triangular systems and update the solutions
+      const int nc = j*kb;
+      Y.SetSize(nc, kb);
+      for (int a = 0; a < kb; a++)
+      {
+         for (int i = nc-1; i >= 0; i--)
+         {
+            real_t y = S(i,a);
+            for (int l = i+1; l < nc; l++) { y -= H(i,l)*Y(l,a); }
+            Y(i,a) = y/H(i,i);
+         }
+         for (int i = 0; i < nc; i++) { X[act[a]]->Add(Y(i,a), V[i]); }
+      }
+      if (print_options.iterations && it < max_iter)
+      {
+         mfem::out << "Restarting..." << '\n';
+      }
+   }
+   if (print_options.first_and_last && !print_options.iterations)
+   {
+      mfem::out << "   Iteration : " << setw(3) << final_iter
+                << "  max ||B r|| = " << final_norm << '\n';
+   }
+   if (print_options.summary || (print_options.warnings && !converged))
+   {
+      mfem::out << "BlockGMRES: Number of iterations: " << final_iter << '\n';
+   }
+   if (print_options.warnings && !converged)
+   {
+      mfem::out << "BlockGMRES: No convergence!\n";
+   }
+
+   Monitor(final_iter, final_norm, V[0], *X[0], true);
 }
 
 
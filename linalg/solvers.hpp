@@ -16,6 +16,7 @@
 #include "densemat.hpp"
 #include "handle.hpp"
 #include <memory>
+#include <vector>
 
 #ifdef MFEM_USE_MPI
 #include <mpi.h>
@@ -139,6 +140,7 @@ public:
 private:
    int dot_prod_type; // 0 - local, 1 - global over 'comm'
    MPI_Comm comm = MPI_COMM_NULL;
+   mutable MPI_Request dots_request = MPI_REQUEST_NULL; // see StartDots()
 #endif
 
 protected:
@@ -205,6 +207,35 @@ protected:
    /// Return the inner product norm of @a x, using the inner product defined by Dot()
    real_t Norm(const Vector &x) const { return sqrt(Dot(x, x)); }
 
+   /** @brief Start the computation of the @a n inner products
+       @a res[i] = (@a x[i], @a y[i]) with a single, non-blocking, global
+       reduction. */
+   /** The values in @a res are valid only after the matching call to
+       FinishDots(); the work done in between (e.g. operator or preconditioner
+       applications) overlaps with the reduction. When a custom inner product is
+       set with SetInnerProduct(), the inner products are evaluated with it
+       without overlap. */
+   void StartDots(int n, const Vector *const *x, const Vector *const *y,
+                  real_t *res) const;
+
+   /// Complete the inner products started by StartDots().
+   void FinishDots() const;
+
+   /** @brief Return the inner product corresponding to the local inner product
+       @a loc_dot, i.e. its sum over the processors of the communicator when a
+       global inner product is used. */
+   /** This is used with fused vector kernels that compute local inner products,
+       e.g. AddTwoAndDot(), and it is only valid when no custom inner product is
+       set with SetInnerProduct(). */
+   real_t ReduceDot(real_t loc_dot) const;
+
+   /** @brief Compute the matrix of inner products @a G(i,j) = (@a X[i],
+       @a Y[j]), i < @a nx, j < @a ny, with a single global reduction. */
+   /** On the host, each Vector is read once instead of once per inner product.
+       @a G is resized to @a nx x @a ny. */
+   void BlockDots(int nx, const Vector *X, int ny, const Vector *Y,
+                  DenseMatrix &G) const;
+
    /// Indicated if the controller requires an update of the solution
    bool ControllerRequiresUpdate() const { return controller && controller->RequiresUpdatedSolution(); }
 
@@ -656,6 +687,172 @@ void PCG(const Operator &A, Solver &B, const Vector &b, Vector &x,
          real_t RTOLERANCE = 1e-12, real_t ATOLERANCE = 1e-24);
 
 
+/// Pipelined conjugate gradient method
+/** This is the pipelined (preconditioned) conjugate gradient method of
+    P. Ghysels and W. Vanroose, "Hiding global synchronization latency in the
+    preconditioned Conjugate Gradient algorithm", Parallel Computing, 2014.
+
+    It is mathematically equivalent to CGSolver and uses the same stopping
+    criterion, based on (B r, r), but it performs a single global reduction per
+    iteration which is overlapped with the application of the preconditioner
+    and the operator. This hides the latency of the reductions at large MPI
+    rank counts, at the expense of four additional vector updates per
+    iteration and a somewhat lower attainable accuracy. */
+class PipelinedCGSolver : public IterativeSolver
+{
+protected:
+   mutable Vector r, u, w, m, n, p, s, q, z;
+
+   void UpdateVectors();
+
+public:
+   PipelinedCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   PipelinedCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Iterative solution of the linear system using the pipelined
+       Conjugate Gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+/// Communication-avoiding s-step conjugate gradient method
+/** Each outer iteration of this s-step method (A. T. Chronopoulos and C. W.
+    Gear, 1989) builds a basis of s vectors of the preconditioned Krylov space,
+    v_{j+1} = B A v_j with v_0 = B r, makes the resulting search directions
+    A-orthogonal to the previous ones, and minimizes the error in the energy
+    norm over the new directions. All inner products of an outer iteration are
+    combined into a single global reduction, so the number of reductions is
+    reduced by a factor of s compared to CGSolver, for the same number of
+    operator and preconditioner applications.
+
+    The basis vectors are scaled by an estimate of the spectrum of B A, but the
+    monomial basis becomes ill-conditioned for large s; values of s up to about
+    5 are recommended. The stopping criterion is the same as in CGSolver and is
+    checked once per outer iteration; GetNumIterations() returns the number of
+    inner steps, i.e. s times the number of outer iterations.
+
+    The reduction is not overlapped with computation: the Gram matrix needs
+    (V_{s-1}, A V_{s-1}), so it can only be started after the last operator
+    application of the outer iteration, and its result is needed before the
+    next basis can be built. The latency of each reduction is therefore
+    exposed, but it is paid once per s steps. For overlapping the reductions
+    with the operator and preconditioner applications, see
+    PipelinedCGSolver. */
+class SStepCGSolver : public IterativeSolver
+{
+protected:
+   int s_steps;
+   mutable Vector r;
+   mutable std::vector<Vector> V, AV, P, AP;
+
+   void UpdateVectors();
+
+public:
+   SStepCGSolver(int s = 4) : s_steps(s) { }
+
+#ifdef MFEM_USE_MPI
+   SStepCGSolver(MPI_Comm comm_, int s = 4)
+      : IterativeSolver(comm_), s_steps(s) { }
+#endif
+
+   /// Set the number of steps per outer iteration, default is 4.
+   void SetNumSteps(int s);
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Iterative solution of the linear system using the s-step
+       Conjugate Gradient method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
+
+/// Block conjugate gradient method for multiple right-hand sides
+/** This is the block (preconditioned) conjugate gradient method of D. P.
+    O'Leary, "The block conjugate gradient algorithm and related methods",
+    Linear Algebra Appl., 1980, for k right-hand sides given to ArrayMult().
+
+    The operator and the preconditioner are applied to all k vectors at once
+    with Operator::ArrayMult(), and the k x k matrices of inner products are
+    computed with one global reduction each, i.e. two reductions per iteration
+    instead of 2k for k separate CGSolver solves. Since the search space is
+    shared by all right-hand sides, the number of iterations is also usually
+    smaller.
+
+    Each right-hand side uses the CGSolver stopping criterion. Converged
+    columns are removed from the block, which then restarts the recurrences
+    for the remaining ones. Mult() solves a single system. */
+class BlockCGSolver : public IterativeSolver
+{
+protected:
+   mutable std::vector<Vector> R, Z, P, Q;
+
+public:
+   BlockCGSolver() { }
+
+#ifdef MFEM_USE_MPI
+   BlockCGSolver(MPI_Comm comm_) : IterativeSolver(comm_) { }
+#endif
+
+   /// Solve the linear system with the single right-hand side @a b.
+   void Mult(const Vector &b, Vector &x) const override;
+
+   /** @brief Solve the linear system with the right-hand sides @a B, using the
+       block conjugate gradient method. */
+   /** GetNumIterations() returns the number of block iterations and
+       GetFinalNorm() the largest final (B r, r)^{1/2}. */
+   void ArrayMult(const Array<const Vector *> &B,
+                  Array<Vector *> &X) const override;
+};
+
+/// Block GMRES method for multiple right-hand sides
+/** For k right-hand sides given to ArrayMult(), this method builds a single
+    block Krylov space with block Arnoldi iterations (block classical
+    Gram-Schmidt with reorthogonalization, and Cholesky QR of each new block)
+    and minimizes the preconditioned residual norms of all right-hand sides
+    over it. Like GMRESSolver, it uses left preconditioning and restarts every
+    SetKDim() block iterations.
+
+    The operator and the preconditioner are applied to all k vectors at once
+    with Operator::ArrayMult(), and each block iteration performs three global
+    reductions, independently of k. The method stops when the residuals of all
+    the right-hand sides satisfy the GMRESSolver stopping criterion. Mult()
+    solves a single system. */
+class BlockGMRESSolver : public IterativeSolver
+{
+protected:
+   int m; // see SetKDim()
+   mutable std::vector<Vector> V;
+
+public:
+   BlockGMRESSolver() { m = 10; }
+
+#ifdef MFEM_USE_MPI
+   BlockGMRESSolver(MPI_Comm comm_) : IterativeSolver(comm_) { m = 10; }
+#endif
+
+   /** @brief Set the number of block iterations to perform between restarts,
+       default is 10. */
+   /** The memory usage is (dim+1)*k vectors for k right-hand sides. */
+   void SetKDim(int dim) { m = dim; }
+
+   /// Solve the linear system with the single right-hand side @a b.
+   void Mult(const Vector &b, Vector &x) const override;
+
+   /** @brief Solve the linear system with the right-hand sides @a B, using the
+       block GMRES method. */
+   /** GetNumIterations() returns the number of block iterations and
+       GetFinalNorm() the largest final ||B r||. */
+   void ArrayMult(const Array<const Vector *> &B,
+                  Array<Vector *> &X) const override;
+};
+
+
 /// GMRES method
 class GMRESSolver : public IterativeSolver
 {
@@ -695,6 +892,61 @@ public:
    void Mult(const Vector &b, Vector &x) const override;
 };
 
+/// Communication-avoiding s-step GMRES method
+/** This is the s-step (left preconditioned) GMRES method, see M. Hoemmen,
+    "Communication-avoiding Krylov subspace methods", PhD thesis, UC Berkeley,
+    2010. It computes the same iterates as GMRESSolver in exact arithmetic and
+    uses the same stopping criterion, based on ||B r||.
+
+    Each block of s steps builds a scaled monomial basis of s vectors, v_{j+1}
+    = B A v_j / theta starting from the last Arnoldi vector, and
+    orthonormalizes it against the previous Arnoldi vectors and within itself
+    (block classical Gram-Schmidt followed by a Cholesky QR). This is done
+    twice to keep the Arnoldi vectors orthogonal, and the inner products of
+    each pass are combined into a single global reduction. A block of s steps
+    thus needs two reductions, while the modified Gram-Schmidt of GMRESSolver
+    needs i+2 reductions in step i.
+    The Hessenberg matrix is recovered from the change of basis, so the
+    residual norm is still available after every step.
+
+    The monomial basis becomes ill-conditioned for large s; values of s up to
+    about 5 are recommended. When the new vectors are numerically dependent on
+    the previous ones, only the independent ones are used and the method is
+    restarted. As in SStepCGSolver, the reductions are not overlapped with
+    computation: they need the whole block, and their results are needed to
+    start the next one. */
+class SStepGMRESSolver : public IterativeSolver
+{
+protected:
+   int m; // see SetKDim()
+   int s_steps;
+   mutable Vector r, w;
+   mutable std::vector<Vector> Q, V;
+
+   void UpdateVectors();
+
+public:
+   SStepGMRESSolver(int s = 4) : m(50), s_steps(s) { }
+
+#ifdef MFEM_USE_MPI
+   SStepGMRESSolver(MPI_Comm comm_, int s = 4)
+      : IterativeSolver(comm_), m(50), s_steps(s) { }
+#endif
+
+   /// Set the number of iteration to perform between restarts, default is 50.
+   void SetKDim(int dim);
+
+   /// Set the number of steps per block, default is 4.
+   void SetNumSteps(int s);
+
+   void SetOperator(const Operator &op) override
+   { IterativeSolver::SetOperator(op); UpdateVectors(); }
+
+   /** @brief Iterative solution of the linear system using the s-step GMRES
+       method. */
+   void Mult(const Vector &b, Vector &x) const override;
+};
+
 /// GMRES method. (tolerances are squared)
 int GMRES(const Operator &A, Vector &x, const Vector &b, Solver &M,
           int &max_iter, int m, real_t &tol, real_t atol, int printit);
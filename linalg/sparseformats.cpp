@@ -0,0 +1,350 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "sparseformats.hpp"
+#include "simd.hpp"
+
+#include <algorithm>
+
+namespace mfem
+{
+
+SlicedEllpackMatrix::SlicedEllpackMatrix(const SparseMatrix &A, int sigma_)
+   : Operator(A.Height(), A.Width()), sigma(std::max(sigma_, 1))
+{
+   MFEM_VERIFY(A.Finalized(), "the SparseMatrix must be finalized");
+
+   const int n = height;
+   const int *Ai = A.HostReadI();
+   const int *Aj = A.HostReadJ();
+   const real_t *Aa = A.HostReadData();
+
+   // Sort the rows by decreasing length within each window of sigma rows
+   row_perm.SetSize(n);
+   for (int i = 0; i < n; i++) { row_perm[i] = i; }
+   auto longer = [Ai](int r1, int r2)
+   {
+      return (Ai[r1+1] - Ai[r1]) > (Ai[r2+1] - Ai[r2]);
+   };
+   for (int w = 0; w < n; w += sigma)
+   {
+      std::stable_sort(row_perm.begin() + w,
+                       row_perm.begin() + std::min(n, w + sigma), longer);
+   }
+
+   // Each chunk is padded to the length of its longest row
+   const int C = chunk_size;
+   const int num_chunks = (n + C - 1)/C;
+   chunk_ptr.SetSize(num_chunks + 1);
+   chunk_ptr[0] = 0;
+   for (int c = 0; c < num_chunks; c++)
+   {
+      int width = 0;
+      for (int l = 0; l < C && c*C + l < n; l++)
+      {
+         const int r = row_perm[c*C + l];
+         width = std::max(width, Ai[r+1] - Ai[r]);
+      }
+      chunk_ptr[c+1] = chunk_ptr[c] + width*C;
+   }
+
+   col.SetSize(chunk_ptr[num_chunks]);
+   val.SetSize(chunk_ptr[num_chunks]);
+   col = 0;
+   val = 0.0;
+   for (int c = 0; c < num_chunks; c++)
+   {
+      int *chunk_col = col.GetData() + chunk_ptr[c];
+      real_t *chunk_val = val.GetData() + chunk_ptr[c];
+      for (int l = 0; l < C && c*C + l < n; l++)
+      {
+         const int r = row_perm[c*C + l];
+         for (int k = 0, j = Ai[r]; j < Ai[r+1]; k++, j++)
+         {
+            chunk_col[k*C + l] = Aj[j];
+            chunk_val[k*C + l] = Aa[j];
+         }
+      }
+   }
+}
+
+void SlicedEllpackMatrix::Mult(const Vector &x, Vector &y) const
+{
+   y = 0.0;
+   AddMult(x, y);
+}
+
+void SlicedEllpackMatrix::AddMult(const Vector &x, Vector &y,
+                                  const real_t a) const
+{
+   MFEM_ASSERT(x.Size() == width, "invalid x.Size() = " << x.Size()
+               << ", expected size = " << width);
+   MFEM_ASSERT(y.Size() == height, "invalid y.Size() = " << y.Size()
+               << ", expected size = " << height);
+
+   constexpr int C = chunk_size;
+   typedef AutoSIMD<real_t, C, C*sizeof(real_t)> vreal_t;
+
+   const int n = height;
+   const int num_chunks = NumChunks();
+   const int *d_ptr = chunk_ptr.GetData();
+   const int *d_perm = row_perm.GetData();
+   const int *d_col = col.GetData();
+   const real_t *d_val = val.HostRead();
+   const real_t *X = x.HostRead();
+   real_t *Y = y.HostReadWrite();
+
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int c = 0; c < num_chunks; c++)
+   {
+      const int *chunk_col = d_col + d_ptr[c];
+      const real_t *chunk_val = d_val + d_ptr[c];
+      const int chunk_width = (d_ptr[c+1] - d_ptr[c])/C;
+      vreal_t sum;
+      sum = 0.0;
+      for (int k = 0; k < chunk_width; k++)
+      {
+         vreal_t xv, av;
+         MFEM_VECTORIZE_LOOP
+         for (int l = 0; l < C; l++)
+         {
+            av[l] = chunk_val[k*C + l];
+            xv[l] = X[chunk_col[k*C + l]];
+         }
+         sum.fma(av, xv);
+      }
+      for (int l = 0; l < C && c*C + l < n; l++)
+      {
+         Y[d_perm[c*C + l]] += a*sum[l];
+      }
+   }
+}
+
+void SlicedEllpackMatrix::MultTranspose(const Vector &x, Vector &y) const
+{
+   y = 0.0;
+   AddMultTranspose(x, y);
+}
+
+void SlicedEllpackMatrix::AddMultTranspose(const Vector &x, Vector &y,
+                                           const real_t a) const
+{
+   MFEM_ASSERT(x.Size() == height, "invalid x.Size() = " << x.Size()
+               << ", expected size = " << height);
+   MFEM_ASSERT(y.Size() == width, "invalid y.Size() = " << y.Size()
+               << ", expected size = " << width);
+
+   constexpr int C = chunk_size;
+   const int n = height;
+   const real_t *d_val = val.HostRead();
+   const real_t *X = x.HostRead();
+   real_t *Y = y.HostReadWrite();
+
+   for (int c = 0; c < NumChunks(); c++)
+   {
+      const int *chunk_col = col.GetData() + chunk_ptr[c];
+      const real_t *chunk_val = d_val + chunk_ptr[c];
+      const int chunk_width = (chunk_ptr[c+1] - chunk_ptr[c])/C;
+      for (int l = 0; l < C && c*C + l < n; l++)
+      {
+         const real_t ax = a*X[row_perm[c*C + l]];
+         for (int k = 0; k < chunk_width; k++)
+         {
+            Y[chunk_col[k*C + l]] += chunk_val[k*C + l]*ax;
+         }
+      }
+   }
+}
+
+
+BlockCSRMatrix::BlockCSRMatrix(const SparseMatrix &A, int bsize_)
+   : Operator(A.Height(), A.Width()), bsize(bsize_)
+{
+   MFEM_VERIFY(A.Finalized(), "the SparseMatrix must be finalized");
+   MFEM_VERIFY(bsize > 0 && height % bsize == 0 && width % bsize == 0,
+               "the matrix dimensions " << height << " x " << width
+               << " are not multiples of the block size " << bsize);
+
+   const int b = bsize, bb = bsize*bsize;
+   const int nbr = height/b, nbc = width/b;
+   const int *Ai = A.HostReadI();
+   const int *Aj = A.HostReadJ();
+   const real_t *Aa = A.HostReadData();
+
+   // Block sparsity pattern: a block is stored if any of its entries is
+   Array<int> block_marker(nbc);
+   block_marker = -1;
+   I.SetSize(nbr + 1);
+   I[0] = 0;
+   for (int bi = 0; bi < nbr; bi++)
+   {
+      int num_blocks = 0;
+      for (int r = bi*b; r < (bi+1)*b; r++)
+      {
+         for (int j = Ai[r]; j < Ai[r+1]; j++)
+         {
+            const int bj = Aj[j]/b;
+            if (block_marker[bj] != bi)
+            {
+               block_marker[bj] = bi;
+               num_blocks++;
+            }
+         }
+      }
+      I[bi+1] = I[bi] + num_blocks;
+   }
+
+   J.SetSize(I[nbr]);
+   blocks.SetSize(I[nbr]*bb);
+   blocks = 0.0;
+   block_marker = -1;
+   for (int bi = 0; bi < nbr; bi++)
+   {
+      int *row_J = J.GetData() + I[bi];
+      int num_blocks = 0;
+      for (int r = bi*b; r < (bi+1)*b; r++)
+      {
+         for (int j = Ai[r]; j < Ai[r+1]; j++)
+         {
+            const int bj = Aj[j]/b;
+            if (block_marker[bj] < I[bi])
+            {
+               row_J[num_blocks++] = bj;
+               block_marker[bj] = I[bi]; // temporary marker
+            }
+         }
+      }
+      std::sort(row_J, row_J + num_blocks);
+      for (int k = 0; k < num_blocks; k++)
+      {
+         block_marker[row_J[k]] = I[bi] + k;
+      }
+      for (int r = bi*b; r < (bi+1)*b; r++)
+      {
+         for (int j = Ai[r]; j < Ai[r+1]; j++)
+         {
+            const int blk = block_marker[Aj[j]/b];
+            blocks[blk*bb + (r % b)*b + Aj[j] % b] += Aa[j];
+         }
+      }
+   }
+}
+
+namespace internal
+{
+
+// y += a * A * x for a BSR matrix with blocks of size B (or b when B = 0)
+template <int B>
+static void BSRAddMult(const int nbr, const int b_, const int *I, const int *J,
+                       const real_t *blocks, const real_t *X, real_t *Y,
+                       const real_t a)
+{
+   const int b = B ? B : b_;
+   const int bb = b*b;
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int bi = 0; bi < nbr; bi++)
+   {
+      constexpr int MB = B ? B : 8;
+      real_t sum[MB];
+      real_t *dyn_sum = (B || b <= MB) ? sum : new real_t[b];
+      for (int r = 0; r < b; r++) { dyn_sum[r] = 0.0; }
+      for (int k = I[bi]; k < I[bi+1]; k++)
+      {
+         const real_t *blk = blocks + k*bb;
+         const real_t *xb = X + J[k]*b;
+         for (int r = 0; r < b; r++)
+         {
+            for (int c = 0; c < b; c++)
+            {
+               dyn_sum[r] += blk[r*b + c]*xb[c];
+            }
+         }
+      }
+      for (int r = 0; r < b; r++) { Y[bi*b + r] += a*dyn_sum[r]; }
+      if (dyn_sum != sum) { delete [] dyn_sum; }
+   }
+}
+
+} // namespace internal
+
+void BlockCSRMatrix::Mult(const Vector &x, Vector &y) const
+{
+   y = 0.0;
+   AddMult(x, y);
+}
+
+void BlockCSRMatrix::AddMult(const Vector &x, Vector &y, const real_t a) const
+{
+   MFEM_ASSERT(x.Size() == width, "invalid x.Size() = " << x.Size()
+               << ", expected size = " << width);
+   MFEM_ASSERT(y.Size() == height, "invalid y.Size() = " << y.Size()
+               << ", expected size = " << height);
+
+   const int nbr = height/bsize;
+   const real_t *d_blocks = blocks.HostRead();
+   const real_t *X = x.HostRead();
+   real_t *Y = y.HostReadWrite();
+   switch (bsize)
+   {
+      case 1:
+         return internal::BSRAddMult<1>(nbr, bsize, I, J, d_blocks, X, Y, a);
+      case 2:
+         return internal::BSRAddMult<2>(nbr, bsize, I, J, d_blocks, X, Y, a);
+      case 3:
+         return internal::BSRAddMult<3>(nbr, bsize, I, J, d_blocks, X, Y, a);
+      default:
+         return internal::BSRAddMult<0>(nbr, bsize, I, J, d_blocks, X, Y, a);
+   }
+}
+
+void BlockCSRMatrix::MultTranspose(const Vector &x, Vector &y) const
+{
+   y = 0.0;
+   AddMultTranspose(x, y);
+}
+
+void BlockCSRMatrix::AddMultTranspose(const Vector &x, Vector &y,
+                                      const real_t a) const
+{
+   MFEM_ASSERT(x.Size() == height, "invalid x.Size() = " << x.Size()
+               << ", expected size = " << height);
+   MFEM_ASSERT(y.Size() == width, "invalid y.Size() = " << y.Size()
+               << ", expected size = " << width);
+
+   const int b = bsize, bb = bsize*bsize;
+   const int nbr = height/b;
+   const real_t *d_blocks = blocks.HostRead();
+   const real_t *X = x.HostRead();
+   real_t *Y = y.HostReadWrite();
+   for (int bi = 0; bi < nbr; bi++)
+   {
+      const real_t *xb = X + bi*b;
+      for (int k = I[bi]; k < I[bi+1]; k++)
+      {
+         const real_t *blk = d_blocks + k*bb;
+         real_t *yb = Y + J[k]*b;
+         for (int r = 0; r < b; r++)
+         {
+            const real_t axr = a*xb[r];
+            for (int c = 0; c < b; c++)
+            {
+               yb[c] += blk[r*b + c]*axr;
+            }
+         }
+      }
+   }
+}
+
+} // namespace mfem
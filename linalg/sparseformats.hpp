@@ -0,0 +1,131 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#ifndef MFEM_SPARSEFORMATS_HPP
+#define MFEM_SPARSEFORMATS_HPP
+
+#include "../config/config.hpp"
+#include "sparsemat.hpp"
+
+namespace mfem
+{
+
+/** @brief Sliced ELLPACK (SELL-C-sigma) storage of a sparse matrix, optimized
+    for vectorized matrix-vector products on the host. */
+/** The rows of the matrix are grouped in chunks of #chunk_size consecutive
+    rows. Each chunk is stored in column-major order, padded with zeros to the
+    length of its longest row, so that one SIMD lane processes one row of the
+    chunk. To reduce the padding, the rows are first sorted by decreasing length
+    within windows of @a sigma rows; the resulting permutation is stored and
+    applied transparently in Mult() and MultTranspose().
+
+    The matrix is a read-only copy of a finalized SparseMatrix: changes in the
+    original SparseMatrix are not reflected in this object. */
+class SlicedEllpackMatrix : public Operator
+{
+public:
+   /// Number of rows in a chunk, i.e. the SIMD width used by the kernels.
+   static constexpr int chunk_size = 8;
+
+protected:
+   int sigma;
+   /// Original index of each (sorted) row, size height.
+   Array<int> row_perm;
+   /// Offsets of the chunks in #col and #val, size num_chunks+1.
+   Array<int> chunk_ptr;
+   /// Column indices, padded entries point to column 0.
+   Array<int> col;
+   /// Matrix entries, padded entries are zero.
+   Vector val;
+
+public:
+   /** @brief Create a SELL-C-sigma copy of the finalized SparseMatrix @a A,
+       sorting the rows by length within windows of @a sigma rows. */
+   /** With @a sigma = 1 the row order of @a A is preserved. */
+   SlicedEllpackMatrix(const SparseMatrix &A, int sigma = 256);
+
+   /// Return the number of chunks of #chunk_size rows.
+   int NumChunks() const { return chunk_ptr.Size() - 1; }
+
+   /// Return the number of stored entries, including the padding.
+   int NumStoredEntries() const { return col.Size(); }
+
+   /// Return the sorting window used in the constructor.
+   int GetSigma() const { return sigma; }
+
+   /// y = A * x
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// y += a * A * x
+   void AddMult(const Vector &x, Vector &y,
+                const real_t a = 1.0) const override;
+
+   /// y = A^t * x
+   void MultTranspose(const Vector &x, Vector &y) const override;
+
+   /// y += a * A^t * x
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t a = 1.0) const override;
+};
+
+
+/** @brief Block compressed sparse row (BSR) storage of a sparse matrix with
+    dense square blocks of a fixed size. */
+/** This format is suited for matrices assembled on vector FE spaces with
+    Ordering::byVDIM, where all @a bsize components of a node are coupled to all
+    the components of the neighboring nodes: the column indices are stored once
+    per block and the products with the blocks are unrolled for the common block
+    sizes 2 and 3.
+
+    The matrix is a read-only copy of a finalized SparseMatrix: changes in the
+    original SparseMatrix are not reflected in this object. */
+class BlockCSRMatrix : public Operator
+{
+protected:
+   int bsize;
+   /// Block row offsets, size (height/bsize)+1.
+   Array<int> I;
+   /// Block column indices.
+   Array<int> J;
+   /// Dense blocks stored in row-major order, bsize*bsize entries per block.
+   Vector blocks;
+
+public:
+   /** @brief Create a BSR copy of the finalized SparseMatrix @a A, using blocks
+       of size @a bsize x @a bsize. */
+   /** The dimensions of @a A must be multiples of @a bsize. Entries that are
+       not present in @a A are stored as explicit zeros inside their blocks. */
+   BlockCSRMatrix(const SparseMatrix &A, int bsize);
+
+   /// Return the size of the blocks.
+   int GetBlockSize() const { return bsize; }
+
+   /// Return the number of stored blocks.
+   int NumBlocks() const { return J.Size(); }
+
+   /// y = A * x
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// y += a * A * x
+   void AddMult(const Vector &x, Vector &y,
+                const real_t a = 1.0) const override;
+
+   /// y = A^t * x
+   void MultTranspose(const Vector &x, Vector &y) const override;
+
+   /// y += a * A^t * x
+   void AddMultTranspose(const Vector &x, Vector &y,
+                         const real_t a = 1.0) const override;
+};
+
+} // namespace mfem
+
+#endif // MFEM_SPARSEFORMATS_HPP
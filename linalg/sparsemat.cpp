@@ -396,6 +396,37 @@ int SparseMatrix::MaxRowSize() const
    return max_row_size;
 }
 
+int SparseMatrix::Bandwidth() const
+{
+   MFEM_VERIFY(Finalized(), "the matrix must be finalized");
+   HostReadI();
+   HostReadJ();
+   int bandwidth = 0;
+   for (int i = 0; i < height; i++)
+   {
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         bandwidth = std::max(bandwidth, std::abs(i - J[k]));
+      }
+   }
+   return bandwidth;
+}
+
+long long SparseMatrix::Profile() const
+{
+   MFEM_VERIFY(Finalized(), "the matrix must be finalized");
+   HostReadI();
+   HostReadJ();
+   long long profile = 0;
+   for (int i = 0; i < height; i++)
+   {
+      int jmin = i;
+      for (int k = I[i]; k < I[i+1]; k++) { jmin = std::min(jmin, J[k]); }
+      profile += i - jmin;
+   }
+   return profile;
+}
+
 int *SparseMatrix::GetRowColumns(const int row)
 {
    MFEM_VERIFY(Finalized(), "Matrix must be finalized.");
@@ -2602,25 +2633,36 @@ void SparseMatrix::Jacobi(const Vector &b, const Vector &x0, Vector &x1,
 {
    MFEM_VERIFY(Finalized(), "Matrix must be finalized.");
 
+   const int nnz = J.Capacity();
+   const int *Ip = HostRead(I, height+1);
+   const int *Jp = HostRead(J, nnz);
+   const real_t *Ap = HostRead(A, nnz);
+   const real_t *bp = b.HostRead();
+   const real_t *x0p = x0.HostRead();
+   real_t *x1p = x1.HostWrite();
+
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
    for (int i = 0; i < height; i++)
    {
       int d = -1;
-      real_t sum = b(i);
-      for (int j = I[i]; j < I[i+1]; j++)
+      real_t sum = bp[i];
+      for (int j = Ip[i]; j < Ip[i+1]; j++)
       {
-         if (J[j] == i)
+         if (Jp[j] == i)
          {
             d = j;
          }
          else
          {
-            sum -= A[j] * x0(J[j]);
+            sum -= Ap[j] * x0p[Jp[j]];
          }
       }
-      if (d >= 0 && A[d] != 0.0)
+      if (d >= 0 && Ap[d] != 0.0)
       {
-         const real_t diag = (use_abs_diag) ? fabs(A[d]) : A[d];
-         x1(i) = sc * (sum / diag) + (1.0 - sc) * x0(i);
+         const real_t diag = (use_abs_diag) ? fabs(Ap[d]) : Ap[d];
+         x1p[i] = sc * (sum / diag) + (1.0 - sc) * x0p[i];
       }
       else
       {
@@ -2684,7 +2726,7 @@ static void JacobiDispatch(const Vector &b, const Vector &x0, Vector &x1,
    const auto Jp = Read(J, J.Capacity(), useDevice);
    const auto Ap = Read(A, J.Capacity(), useDevice);
 
-   mfem::forall_switch(useDevice, height, [=] MFEM_HOST_DEVICE (int i)
+   auto kernel = [=] MFEM_HOST_DEVICE (int i)
    {
       real_t resi = bp[i], norm = 0.0;
       for (int j = Ip[i]; j < Ip[i+1]; j++)
@@ -2714,7 +2756,16 @@ static void JacobiDispatch(const Vector &b, const Vector &x0, Vector &x1,
             MFEM_ABORT_KERNEL("sum of row is zero.");
          }
       }
-   });
+   };
+   if (useDevice)
+   {
+      mfem::forall(height, kernel);
+      return;
+   }
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int i = 0; i < height; i++) { kernel(i); }
 }
 
 void SparseMatrix::Jacobi2(const Vector &b, const Vector &x0, Vector &x1,
@@ -2777,6 +2828,47 @@ void SparseMatrix::AddSubMatrix(const Array<int> &rows, const Array<int> &cols,
    }
 }
 
+void SparseMatrix::AddSubMatrixSorted(const Array<int> &rows,
+                                      const Array<int> &cols,
+                                      const DenseMatrix &subm, int skip_zeros)
+{
+   MFEM_ASSERT(Finalized() && isSorted,
+               "the matrix must be finalized and with sorted columns");
+
+   const int *Ip = I, *Jp = J;
+   real_t *Ap = A;
+   for (int i = 0; i < rows.Size(); i++)
+   {
+      int gi = rows[i], s = 1;
+      if (gi < 0) { gi = -1-gi, s = -1; }
+      MFEM_ASSERT(gi < height,
+                  "Trying to insert a row " << gi << " outside the matrix height "
+                  << height);
+      const int *row_begin = Jp + Ip[gi], *row_end = Jp + Ip[gi+1];
+      real_t *row_data = Ap + Ip[gi];
+      for (int j = 0; j < cols.Size(); j++)
+      {
+         int gj = cols[j], t = s;
+         if (gj < 0) { gj = -1-gj, t = -s; }
+         real_t a = subm(i, j);
+         if (skip_zeros && a == 0.0)
+         {
+            // Same rules as in AddSubMatrix()
+            if (skip_zeros == 2 || &rows != &cols || subm(j, i) == 0.0)
+            {
+               continue;
+            }
+         }
+         const int *col_p = std::lower_bound(row_begin, row_end, gj);
+         MFEM_VERIFY(col_p != row_end && *col_p == gj,
+                     "Entry for row " << gi << ", column " << gj
+                     << " is not allocated.");
+         if (t < 0) { a = -a; }
+         row_data[col_p - row_begin] += a;
+      }
+   }
+}
+
 void SparseMatrix::Set(const int i, const int j, const real_t val)
 {
    real_t a = val;
@@ -295,6 +295,15 @@ public:
    /// Returns the maximum number of elements among all rows.
    int MaxRowSize() const;
 
+   /** @brief Returns the bandwidth of the matrix, i.e. the largest |i - j|
+       over all stored entries (i,j). The matrix must be finalized. */
+   int Bandwidth() const;
+
+   /** @brief Returns the profile (envelope size) of the matrix, i.e. the sum
+       over all rows i of i - j, where j is the smallest column index in row i
+       that is not larger than i. The matrix must be finalized. */
+   long long Profile() const;
+
    /// Return a pointer to the column indices in a row.
    int *GetRowColumns(const int row);
    /// Return a pointer to the column indices in a row, const version.
@@ -622,6 +631,16 @@ public:
    void AddSubMatrix(const Array<int> &rows, const Array<int> &cols,
                      const DenseMatrix &subm, int skip_zeros = 1);
 
+   /** @brief Same as AddSubMatrix(), but for a finalized matrix with sorted
+       column indices, see ColumnsAreSorted(). The entries are located by a
+       binary search in each row and must be present in the sparsity pattern. */
+   /** Unlike AddSubMatrix(), this method does not use the "current row" set by
+       SetColPtr(), so it can be called concurrently by several threads as long
+       as they add to disjoint sets of rows. The host arrays #I, #J, and #A must
+       be valid before such concurrent calls, see e.g. HostReadWriteData(). */
+   void AddSubMatrixSorted(const Array<int> &rows, const Array<int> &cols,
+                           const DenseMatrix &subm, int skip_zeros = 1);
+
    bool RowIsEmpty(const int row) const;
 
    /// Extract all column indices and values from a given row.
@@ -89,6 +89,154 @@ void GSSmoother::MultTranspose(const Vector &x, Vector &y) const
    }
 }
 
+void MulticolorGSSmoother::SetOperator(const Operator &a)
+{
+   SparseSmoother::SetOperator(a);
+   MFEM_VERIFY(oper->Finalized(), "the SparseMatrix must be finalized");
+   MFEM_VERIFY(height == width, "the SparseMatrix must be square");
+   BuildColoring();
+}
+
+void MulticolorGSSmoother::BuildColoring()
+{
+   const int n = height;
+   const int *I = oper->HostReadI();
+   const int *J = oper->HostReadJ();
+
+   // Transposed sparsity pattern, so that both the rows coupled to a row and
+   // the rows it is coupled to get different colors
+   Array<int> It(n+1), Jt(I[n]);
+   It = 0;
+   for (int k = 0; k < I[n]; k++) { It[J[k]+1]++; }
+   It.PartialSum();
+   Array<int> pos(n);
+   for (int i = 0; i < n; i++) { pos[i] = It[i]; }
+   for (int i = 0; i < n; i++)
+   {
+      for (int k = I[i]; k < I[i+1]; k++) { Jt[pos[J[k]]++] = i; }
+   }
+
+   // Greedy coloring: assign to each row the smallest color not used by any
+   // of the previously colored rows it is coupled to.
+   Array<int> row_color(n), color_marker;
+   row_color = -1;
+   int num_colors = 0;
+   for (int i = 0; i < n; i++)
+   {
+      for (int k = I[i]; k < I[i+1]; k++)
+      {
+         const int c = row_color[J[k]];
+         if (c >= 0) { color_marker[c] = i; }
+      }
+      for (int k = It[i]; k < It[i+1]; k++)
+      {
+         const int c = row_color[Jt[k]];
+         if (c >= 0) { color_marker[c] = i; }
+      }
+      int c = 0;
+      while (c < num_colors && color_marker[c] == i) { c++; }
+      if (c == num_colors)
+      {
+         color_marker.Append(-1);
+         num_colors++;
+      }
+      row_color[i] = c;
+   }
+   Transpose(row_color, colors, num_colors);
+}
+
+void MulticolorGSSmoother::Sweep(const SparseMatrix &A, const Vector &x,
+                                 Vector &y, bool forward) const
+{
+   const int *Ip = A.HostReadI();
+   const int *Jp = A.HostReadJ();
+   const real_t *Ap = A.HostReadData();
+   const real_t *xp = x.HostRead();
+   real_t *yp = y.HostReadWrite();
+
+   const int num_colors = colors.Size();
+   for (int k = 0; k < num_colors; k++)
+   {
+      const int color = forward ? k : num_colors - 1 - k;
+      const int *rows = colors.GetRow(color);
+      const int num_rows = colors.RowSize(color);
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp parallel for
+#endif
+      for (int r = 0; r < num_rows; r++)
+      {
+         const int i = rows[r];
+         real_t sum = 0.0;
+         int d = -1;
+         for (int j = Ip[i]; j < Ip[i+1]; j++)
+         {
+            const int c = Jp[j];
+            if (c == i)
+            {
+               d = j;
+            }
+            else
+            {
+               sum += Ap[j] * yp[c];
+            }
+         }
+         if (d >= 0 && Ap[d] != 0.0)
+         {
+            yp[i] = (xp[i] - sum) / Ap[d];
+         }
+         else if (xp[i] == sum)
+         {
+            yp[i] = sum;
+         }
+         else
+         {
+            mfem_error("MulticolorGSSmoother::Sweep()");
+         }
+      }
+   }
+}
+
+void MulticolorGSSmoother::Mult(const Vector &x, Vector &y) const
+{
+   if (!iterative_mode)
+   {
+      y = 0.0;
+   }
+   for (int i = 0; i < iterations; i++)
+   {
+      if (type != BACKWARD)
+      {
+         Sweep(*oper, x, y, true);
+      }
+      if (type != FORWARD)
+      {
+         Sweep(*oper, x, y, false);
+      }
+   }
+}
+
+void MulticolorGSSmoother::MultTranspose(const Vector &x, Vector &y) const
+{
+   EnsureTranspose();
+
+   if (!iterative_mode)
+   {
+      y = 0.0;
+   }
+   // The coloring of the symmetrized graph is also valid for the transpose
+   for (int i = 0; i < iterations; i++)
+   {
+      if (type != FORWARD)
+      {
+         Sweep(*oper_T, x, y, true);
+      }
+      if (type != BACKWARD)
+      {
+         Sweep(*oper_T, x, y, false);
+      }
+   }
+}
+
 void DSmoother::Mult_(const SparseMatrix &A, const Vector &x, Vector &y) const
 {
    if (!iterative_mode && type == 0 && iterations == 1)
@@ -94,7 +94,71 @@ public:
    void MultTranspose(const Vector &x, Vector &y) const override;
 };
 
+/** @brief Multicolor Gauss-Seidel smoother of a sparse matrix, which can be
+    applied by multiple threads. */
+/** The rows of the matrix are colored greedily such that rows of the same
+    color are not coupled in the (symmetrized) matrix graph. The Gauss-Seidel
+    sweeps then update the rows color by color, and the rows of a color are
+    independent, so they are processed in parallel when MFEM is built with
+    legacy OpenMP. The coloring is computed in SetOperator() and reused by all
+    subsequent applications.
+
+    Since the rows are visited in a different order, the result differs from
+    the one of GSSmoother, but the smoothing properties are comparable. The
+    SYMMETRIC type sweeps the colors forward and then backward, giving a
+    symmetric smoother for symmetric matrices. */
+class MulticolorGSSmoother : public GSSmoother
+{
+protected:
+   Table colors; ///< The rows of each color.
+
+   /// Color the rows of the matrix, see GetColoring().
+   void BuildColoring();
+
+   /// Apply a forward or backward multicolor Gauss-Seidel sweep with @a A.
+   void Sweep(const SparseMatrix &A, const Vector &x, Vector &y,
+              bool forward) const;
+
+public:
+   /// @brief Create a multicolor Gauss-Seidel smoother. SetOperator() will
+   /// need to be called with a SparseMatrix before first use.
+   ///
+   /// @param[in]  t        Type of GS smoother (see GSSmoother::GSType)
+   /// @param[in]  it       Number of stationary iterations to perform
+   MulticolorGSSmoother(GSType t = SYMMETRIC, int it = 1) : GSSmoother(t, it) { }
+
+   /// @brief Create a multicolor Gauss-Seidel smoother using the SparseMatrix
+   /// @a a.
+   ///
+   /// @param[in]  a        The underlying SparseMatrix, must be finalized
+   /// @param[in]  t        Type of GS smoother (see GSSmoother::GSType)
+   /// @param[in]  it       Number of stationary iterations to perform
+   MulticolorGSSmoother(const SparseMatrix &a, GSType t = SYMMETRIC, int it = 1)
+      : GSSmoother(t, it) { SetOperator(a); }
+
+   /// Sets the underlying matrix and computes its coloring.
+   void SetOperator(const Operator &a) override;
+
+   /// Return the number of colors.
+   int GetNumColors() const { return colors.Size(); }
+
+   /** @brief Return a Table that stores, for each color, the list of matrix
+       rows with that color. */
+   const Table &GetColoring() const { return colors; }
+
+   /// @brief Application of the multicolor Gauss-Seidel smoother.
+   ///
+   /// If Solver::iterative_mode is true, then @a y is used as the initial
+   /// guess.
+   void Mult(const Vector &x, Vector &y) const override;
+
+   /// Application of the transpose of the multicolor Gauss-Seidel smoother.
+   void MultTranspose(const Vector &x, Vector &y) const override;
+};
+
 /// Jacobi-type diagonal smoother of a sparse matrix.
+/** On the host, the Jacobi iterations are processed in parallel when MFEM is
+    built with legacy OpenMP. */
 class DSmoother : public SparseSmoother
 {
 public:
@@ -636,6 +636,79 @@ void subtract(const real_t a, const Vector &x, const Vector &y, Vector &z)
    }
 }
 
+void AddTwo(Vector &x, const real_t a, const Vector &p,
+            Vector &y, const real_t b, const Vector &q)
+{
+   MFEM_ASSERT(x.size == p.size && y.size == q.size && x.size == y.size,
+               "incompatible Vectors!");
+
+#if !defined(MFEM_USE_LEGACY_OPENMP)
+   const bool use_dev = x.UseDevice() || p.UseDevice() ||
+                        y.UseDevice() || q.UseDevice();
+   const int N = x.size;
+   const auto pd = p.Read(use_dev);
+   const auto qd = q.Read(use_dev);
+   auto xd = x.ReadWrite(use_dev);
+   auto yd = y.ReadWrite(use_dev);
+   mfem::forall_switch(use_dev, N, [=] MFEM_HOST_DEVICE (int i)
+   {
+      xd[i] += a * pd[i];
+      yd[i] += b * qd[i];
+   });
+#else
+   const real_t *pp = p.data, *qp = q.data;
+   real_t *xp = x.data, *yp = y.data;
+   const int s = x.size;
+   #pragma omp parallel for
+   for (int i = 0; i < s; i++)
+   {
+      xp[i] += a * pp[i];
+      yp[i] += b * qp[i];
+   }
+#endif
+}
+
+real_t AddTwoAndDot(Vector &x, const real_t a, const Vector &p,
+                    Vector &y, const real_t b, const Vector &q,
+                    const Vector &w)
+{
+   MFEM_ASSERT(x.size == p.size && y.size == q.size && x.size == y.size &&
+               y.size == w.size, "incompatible Vectors!");
+
+   real_t res = 0.0;
+#if !defined(MFEM_USE_LEGACY_OPENMP)
+   const bool w_is_y = (&w == &y);
+   const bool use_dev = x.UseDevice() || p.UseDevice() ||
+                        y.UseDevice() || q.UseDevice() || w.UseDevice();
+   const int N = x.size;
+   const auto pd = p.Read(use_dev);
+   const auto qd = q.Read(use_dev);
+   const auto wd = w_is_y ? nullptr : w.Read(use_dev);
+   auto xd = x.ReadWrite(use_dev);
+   auto yd = y.ReadWrite(use_dev);
+   reduce(N, res, [=] MFEM_HOST_DEVICE (int i, real_t &r)
+   {
+      xd[i] += a * pd[i];
+      const real_t yi = yd[i] + b * qd[i];
+      yd[i] = yi;
+      r += yi * (w_is_y ? yi : wd[i]);
+   },
+   SumReducer<real_t> {}, use_dev, vector_workspace());
+#else
+   const real_t *pp = p.data, *qp = q.data, *wp = w.data;
+   real_t *xp = x.data, *yp = y.data;
+   const int s = x.size;
+   #pragma omp parallel for reduction(+:res)
+   for (int i = 0; i < s; i++)
+   {
+      xp[i] += a * pp[i];
+      yp[i] += b * qp[i];
+      res += yp[i] * wp[i];
+   }
+#endif
+   return res;
+}
+
 void Vector::cross3D(const Vector &vin, Vector &vout) const
 {
    HostRead();
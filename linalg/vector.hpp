@@ -398,6 +398,19 @@ public:
    friend void subtract(const real_t a, const Vector &x,
                         const Vector &y, Vector &z);
 
+   /// Set x = x + a * p and y = y + b * q in a single pass over the data.
+   friend void AddTwo(Vector &x, const real_t a, const Vector &p,
+                      Vector &y, const real_t b, const Vector &q);
+
+   /** @brief Set x = x + a * p and y = y + b * q in a single pass over the
+       data, and return the local inner product (y, w) of the updated @a y. */
+   /** The Vector @a w may be the same as @a y, in which case the squared
+       l2 norm of the updated @a y is returned. No global reduction is
+       performed for distributed vectors. */
+   friend real_t AddTwoAndDot(Vector &x, const real_t a, const Vector &p,
+                              Vector &y, const real_t b, const Vector &q,
+                              const Vector &w);
+
    /// Computes cross product of this vector with another 3D vector.
    /// vout = this x vin.
    void cross3D(const Vector &vin, Vector &vout) const;
@@ -33,6 +33,8 @@
 #include <ctime>
 #include <functional>
 #include <set>
+#include <array>
+#include <algorithm>
 #include <numeric>
 #include <unordered_map>
 #include <unordered_set>
@@ -63,6 +65,9 @@ using namespace std;
 namespace mfem
 {
 
+bool Mesh::sorted_topology = false;
+int Mesh::locality_ordering = 0;
+
 void Mesh::GetElementJacobian(int i, DenseMatrix &J, const IntegrationPoint *ip)
 {
    Geometry::Type geom = GetElementBaseGeometry(i);
@@ -1032,6 +1037,7 @@ void Mesh::DeleteGeometricFactors()
       delete face_geom_factors[i];
    }
    face_geom_factors.SetSize(0);
+   DeleteElementCenterTree();
 
    ++nodes_sequence;
 }
@@ -1861,6 +1867,8 @@ void Mesh::DestroyPointers()
 
    delete NURBSext;
 
+   DeleteElementCenterTree();
+
    for (int i = 0; i < NumOfElements; i++)
    {
       FreeElement(elements[i]);
@@ -2926,6 +2934,8 @@ void Mesh::ReorderElements(const Array<int> &ordering, bool reorder_vertices)
 
    // Destroy tables that need to be rebuild
    DeleteTables();
+   // The cached geometric factors and element center tree are per element
+   DeleteGeometricFactors();
 
    if (Dim > 1)
    {
@@ -2961,6 +2971,22 @@ void Mesh::ReorderElements(const Array<int> &ordering, bool reorder_vertices)
    }
 }
 
+void Mesh::ReorderElementsForLocality(int method)
+{
+   MFEM_VERIFY(method == 1 || method == 2, "invalid method: " << method);
+   if (NURBSext || ncmesh) { return; }
+
+   Array<int> ordering;
+   if (method == 1)
+   {
+      GetHilbertElementOrdering(ordering);
+   }
+   else
+   {
+      GetGeckoElementOrdering(ordering);
+   }
+   ReorderElements(ordering);
+}
 
 void Mesh::MarkForRefinement()
 {
@@ -4985,6 +5011,10 @@ void Mesh::Loader(std::istream &input, int generate_edges,
       }
       ReadMFEMMesh(input, mfem_version, curved);
    }
+   else if (mesh_type == "MFEM binary mesh v1.0")
+   {
+      ReadMFEMBinaryMesh(input, curved, read_gf, finalize_topo);
+   }
    else if (mfem_nc_version)
    {
       MFEM_ASSERT(ncmesh == NULL, "internal error");
@@ -8327,6 +8357,8 @@ void Mesh::GetVertexToVertexTable(DSTable &v_to_v) const
 
 int Mesh::GetElementToEdgeTable(Table &e_to_f)
 {
+   if (sorted_topology) { return GetElementToEdgeTableSorted(e_to_f); }
+
    int i, NumberOfEdges;
 
    DSTable v_to_v(NumOfVertices);
@@ -8364,6 +8396,291 @@ int Mesh::GetElementToEdgeTable(Table &e_to_f)
    return NumberOfEdges;
 }
 
+// Table of keys with N vertex indices, i.e. edges (N = 2) or faces (N = 3),
+// that assigns to every key the same number as DSTable/STable3D would: the
+// unique keys are numbered in the order of their first occurrence. Instead of
+// the linked lists of DSTable/STable3D, the keys are bucketed by their first
+// (smallest) vertex with a counting sort and each bucket is sorted. Used in
+// GetElementToEdgeTable() and GetElementToFaceTable() when
+// Mesh::sorted_topology is true.
+template <int N>
+class SortedKeyTable
+{
+public:
+   typedef std::array<int,N> Key;
+
+private:
+   int num_entries;
+   Array<int> numbers; // number of each input key
+   Array<int> row_offsets, unumbers; // unique keys, grouped by first vertex
+   std::vector<Key> ukeys;
+
+public:
+   /// The entries of each key must be sorted in increasing order.
+   SortedKeyTable(int nrows, const std::vector<Key> &keys)
+   {
+      const int nkeys = (int) keys.size();
+
+      // Counting sort of the key positions by the first vertex
+      Array<int> offsets(nrows + 1), pos(nkeys);
+      offsets = 0;
+      for (int t = 0; t < nkeys; t++) { offsets[keys[t][0] + 1]++; }
+      offsets.PartialSum();
+      Array<int> next;
+      offsets.Copy(next);
+      for (int t = 0; t < nkeys; t++) { pos[next[keys[t][0]]++] = t; }
+
+      // Sort each bucket by (key, position) and mark the first occurrence of
+      // every key as the representative of its group
+      Array<int> rep(nkeys);
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp parallel for
+#endif
+      for (int r = 0; r < nrows; r++)
+      {
+         int *b = pos.GetData() + offsets[r], *e = pos.GetData() + offsets[r+1];
+         std::sort(b, e, [&keys](int a, int c)
+         { return keys[a] < keys[c] || (keys[a] == keys[c] && a < c); });
+         for (int *p = b; p != e; p++)
+         {
+            rep[*p] = (p != b && keys[*p] == keys[p[-1]]) ? rep[p[-1]] : *p;
+         }
+      }
+
+      // Number the representatives in increasing order of position
+      numbers.SetSize(nkeys);
+      num_entries = 0;
+      for (int t = 0; t < nkeys; t++)
+      {
+         numbers[t] = (rep[t] == t) ? num_entries++ : numbers[rep[t]];
+      }
+
+      // Store the unique keys, sorted within each row, for Index()
+      ukeys.reserve(num_entries);
+      unumbers.Reserve(num_entries);
+      row_offsets.SetSize(nrows + 1);
+      for (int r = 0; r < nrows; r++)
+      {
+         row_offsets[r] = (int) ukeys.size();
+         for (int k = offsets[r]; k < offsets[r+1]; k++)
+         {
+            const int t = pos[k];
+            if (rep[t] == t)
+            {
+               ukeys.push_back(keys[t]);
+               unumbers.Append(numbers[t]);
+            }
+         }
+      }
+      row_offsets[nrows] = (int) ukeys.size();
+   }
+
+   int NumberOfEntries() const { return num_entries; }
+
+   /// Numbers of the keys, in the order they were given in the constructor.
+   const Array<int> &Numbers() const { return numbers; }
+
+   /// Number of the given (sorted) key or -1 if it is not in the table.
+   int Index(const Key &key) const
+   {
+      const auto b = ukeys.begin() + row_offsets[key[0]];
+      const auto e = ukeys.begin() + row_offsets[key[0] + 1];
+      const auto it = std::lower_bound(b, e, key);
+      return (it != e && *it == key) ? unumbers[int(it - ukeys.begin())] : -1;
+   }
+};
+
+static inline std::array<int,2> SortedEdgeKey(int a, int b)
+{
+   return (a < b) ? std::array<int,2> {{a, b}} : std::array<int,2> {{b, a}};
+}
+
+// The key of a triangle or a quadrilateral face, as in STable3D::Push() and
+// STable3D::Push4(): the three smallest vertices, sorted.
+static inline std::array<int,3> SortedFaceKey(const int *v, int nv)
+{
+   const int v3 = (nv == 4) ? v[3] : std::numeric_limits<int>::max();
+   std::array<int,4> s {{v[0], v[1], v[2], v3}};
+   std::sort(s.begin(), s.end());
+   return std::array<int,3> {{s[0], s[1], s[2]}};
+}
+
+int Mesh::GetElementToEdgeTableSorted(Table &e_to_f)
+{
+   // The keys of the edges, in the order used by GetVertexToVertexTable()
+   std::vector<SortedKeyTable<2>::Key> keys;
+   if (edge_vertex)
+   {
+      keys.resize(edge_vertex->Size());
+      for (int i = 0; i < edge_vertex->Size(); i++)
+      {
+         const int *v = edge_vertex->GetRow(i);
+         keys[i] = SortedEdgeKey(v[0], v[1]);
+      }
+   }
+   Array<int> el_offsets(NumOfElements + 1);
+   el_offsets[0] = 0;
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      el_offsets[i+1] = el_offsets[i] + elements[i]->GetNEdges();
+   }
+   if (!edge_vertex)
+   {
+      keys.resize(el_offsets[NumOfElements]);
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp parallel for
+#endif
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         const int *v = elements[i]->GetVertices();
+         const int ne = elements[i]->GetNEdges();
+         for (int j = 0; j < ne; j++)
+         {
+            const int *e = elements[i]->GetEdgeVertices(j);
+            keys[el_offsets[i] + j] = SortedEdgeKey(v[e[0]], v[e[1]]);
+         }
+      }
+   }
+
+   const SortedKeyTable<2> v_to_v(NumOfVertices, keys);
+   const int NumberOfEdges = v_to_v.NumberOfEntries();
+
+   // Fill the element to edge table
+   e_to_f.SetDims(NumOfElements, el_offsets[NumOfElements]);
+   el_offsets.CopyTo(e_to_f.GetI());
+   int *J = e_to_f.GetJ();
+   if (!edge_vertex)
+   {
+      const Array<int> &numbers = v_to_v.Numbers();
+      std::copy(numbers.begin(), numbers.end(), J);
+   }
+   else
+   {
+#ifdef MFEM_USE_LEGACY_OPENMP
+      #pragma omp parallel for
+#endif
+      for (int i = 0; i < NumOfElements; i++)
+      {
+         const int *v = elements[i]->GetVertices();
+         const int ne = elements[i]->GetNEdges();
+         for (int j = 0; j < ne; j++)
+         {
+            const int *e = elements[i]->GetEdgeVertices(j);
+            J[el_offsets[i] + j] =
+               v_to_v.Index(SortedEdgeKey(v[e[0]], v[e[1]]));
+         }
+      }
+   }
+
+   if (Dim == 2)
+   {
+      // Initialize the indices for the boundary elements.
+      be_to_face.SetSize(NumOfBdrElements);
+      for (int i = 0; i < NumOfBdrElements; i++)
+      {
+         const int *v = boundary[i]->GetVertices();
+         be_to_face[i] = v_to_v.Index(SortedEdgeKey(v[0], v[1]));
+      }
+   }
+   else if (Dim == 3)
+   {
+      if (bel_to_edge == NULL)
+      {
+         bel_to_edge = new Table;
+      }
+      Table &be_to_e = *bel_to_edge;
+      be_to_e.MakeI(NumOfBdrElements);
+      for (int i = 0; i < NumOfBdrElements; i++)
+      {
+         be_to_e.AddColumnsInRow(i, boundary[i]->GetNEdges());
+      }
+      be_to_e.MakeJ();
+      for (int i = 0; i < NumOfBdrElements; i++)
+      {
+         const int *v = boundary[i]->GetVertices();
+         const int ne = boundary[i]->GetNEdges();
+         for (int j = 0; j < ne; j++)
+         {
+            const int *e = boundary[i]->GetEdgeVertices(j);
+            be_to_e.AddConnection(
+               i, v_to_v.Index(SortedEdgeKey(v[e[0]], v[e[1]])));
+         }
+      }
+      be_to_e.ShiftUpI();
+   }
+   else
+   {
+      mfem_error("1D GetElementToEdgeTable is not yet implemented.");
+   }
+
+   // Return the number of edges
+   return NumberOfEdges;
+}
+
+void Mesh::GetElementToFaceTableSorted()
+{
+   Array<int> el_offsets(NumOfElements + 1);
+   el_offsets[0] = 0;
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      switch (GetElementType(i))
+      {
+         case Element::TETRAHEDRON:
+         case Element::WEDGE:
+         case Element::PYRAMID:
+         case Element::HEXAHEDRON:
+            break;
+         default:
+            MFEM_ABORT("Unexpected type of Element.");
+      }
+      el_offsets[i+1] = el_offsets[i] + elements[i]->GetNFaces();
+   }
+
+   std::vector<SortedKeyTable<3>::Key> keys(el_offsets[NumOfElements]);
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      const Element *el = elements[i];
+      const int *v = el->GetVertices();
+      for (int j = 0; j < el->GetNFaces(); j++)
+      {
+         const int *fv = el->GetFaceVertices(j);
+         const int nfv = el->GetNFaceVertices(j);
+         int fverts[4];
+         for (int k = 0; k < nfv; k++) { fverts[k] = v[fv[k]]; }
+         keys[el_offsets[i] + j] = SortedFaceKey(fverts, nfv);
+      }
+   }
+
+   const SortedKeyTable<3> faces_tbl(NumOfVertices, keys);
+
+   if (el_to_face != NULL)
+   {
+      delete el_to_face;
+   }
+   el_to_face = new Table;
+   el_to_face->SetDims(NumOfElements, el_offsets[NumOfElements]);
+   el_offsets.CopyTo(el_to_face->GetI());
+   const Array<int> &numbers = faces_tbl.Numbers();
+   std::copy(numbers.begin(), numbers.end(), el_to_face->GetJ());
+
+   NumOfFaces = faces_tbl.NumberOfEntries();
+   be_to_face.SetSize(NumOfBdrElements);
+   for (int i = 0; i < NumOfBdrElements; i++)
+   {
+      const Element::Type type = GetBdrElementType(i);
+      MFEM_VERIFY(type == Element::TRIANGLE || type == Element::QUADRILATERAL,
+                  "Unexpected type of boundary Element.");
+      const int *v = boundary[i]->GetVertices();
+      const int nv = boundary[i]->GetNVertices();
+      const int f = faces_tbl.Index(SortedFaceKey(v, nv));
+      MFEM_VERIFY(f >= 0, "boundary element " << i << " is not a face");
+      be_to_face[i] = f;
+   }
+}
+
 const Table & Mesh::ElementToElementTable()
 {
    if (el_to_el)
@@ -8772,6 +9089,12 @@ STable3D *Mesh::GetFacesTable()
 
 STable3D *Mesh::GetElementToFaceTable(int ret_ftbl)
 {
+   if (sorted_topology && !ret_ftbl)
+   {
+      GetElementToFaceTableSorted();
+      return NULL;
+   }
+
    Array<int> v;
    STable3D *faces_tbl;
 
@@ -9006,8 +9329,102 @@ void FindPartitioningComponents(Table &elem_elem,
                                 Array<int> &component,
                                 Array<int> &num_comp);
 
+// Greedy boundary refinement of a partitioning, in the spirit of the
+// Fiduccia-Mattheyses algorithm: elements on the partition boundaries are moved
+// to the neighboring part with the largest positive reduction of the edge cut,
+// as long as the target part does not exceed max_size elements. Moves without
+// gain are accepted only if they improve the balance. Returns the number of
+// moved elements.
+static int RefinePartitionBoundaries(const Table &elem_elem, int nparts,
+                                     int max_size, int max_passes,
+                                     int *partitioning)
+{
+   const int ne = elem_elem.Size();
+   const int *I = elem_elem.GetI(), *J = elem_elem.GetJ();
+
+   Array<int> psize(nparts), conn(nparts), neighbor_parts;
+   psize = 0;
+   conn = 0;
+   for (int e = 0; e < ne; e++) { psize[partitioning[e]]++; }
+
+   int total_moves = 0;
+   for (int pass = 0; pass < max_passes; pass++)
+   {
+      int moves = 0;
+      for (int e = 0; e < ne; e++)
+      {
+         const int p = partitioning[e];
+         neighbor_parts.SetSize(0);
+         for (int k = I[e]; k < I[e+1]; k++)
+         {
+            const int q = partitioning[J[k]];
+            if (conn[q]++ == 0) { neighbor_parts.Append(q); }
+         }
+         const int internal = conn[p];
+         int best = p, best_gain = 0;
+         for (int q : neighbor_parts)
+         {
+            if (q == p || psize[q] >= max_size) { continue; }
+            const int gain = conn[q] - internal;
+            const bool better = (gain > best_gain) ||
+                                (gain == best_gain && psize[q] + 1 < psize[p] &&
+                                 (best == p || psize[q] < psize[best]));
+            if (better)
+            {
+               best = q;
+               best_gain = gain;
+            }
+         }
+         for (int q : neighbor_parts) { conn[q] = 0; }
+         if (best != p && psize[p] > 1)
+         {
+            partitioning[e] = best;
+            psize[p]--;
+            psize[best]++;
+            moves++;
+         }
+      }
+      total_moves += moves;
+      if (moves == 0) { break; }
+   }
+   return total_moves;
+}
+
+// Built-in partitioner: split the elements ordered along the Hilbert curve into
+// nparts contiguous chunks of equal size, then refine the partition boundaries
+// to reduce the edge cut, allowing a 3% imbalance.
+static void GenerateHilbertPartitioning(Mesh &mesh, int nparts,
+                                        int *partitioning)
+{
+   const int ne = mesh.GetNE();
+   if (nparts == 1 || ne <= nparts)
+   {
+      for (int i = 0; i < ne; i++) { partitioning[i] = (nparts == 1) ? 0 : i; }
+      return;
+   }
+
+   Array<int> ordering;
+   mesh.GetHilbertElementOrdering(ordering);
+   for (int i = 0; i < ne; i++)
+   {
+      partitioning[i] = int((long long)ordering[i]*nparts/ne);
+   }
+
+   const int avg_size = (ne + nparts - 1)/nparts;
+   const int max_size = std::max(avg_size, int(std::ceil(1.03*ne/nparts)));
+   RefinePartitionBoundaries(mesh.ElementToElementTable(), nparts, max_size,
+                             10, partitioning);
+}
+
 int *Mesh::GeneratePartitioning(int nparts, int part_method)
 {
+   if (part_method == 6)
+   {
+      int *partitioning = new int[NumOfElements];
+      GenerateHilbertPartitioning(*this, nparts, partitioning);
+      return partitioning;
+   }
+
 #ifdef MFEM_USE_METIS
 
    int print_messages = 1;
@@ -9326,10 +9743,8 @@ int *Mesh::GeneratePartitioning(int nparts, int part_method)
 
 #else
 
-   mfem_error("Mesh::GeneratePartitioning(...): "
-              "MFEM was compiled without Metis.");
-
-   return NULL;
+   // Without METIS, fall back to the built-in partitioner
+   return GeneratePartitioning(nparts, 6);
 
 #endif
 }
@@ -9808,6 +10223,7 @@ void Mesh::MoveVertices(const Vector &displacements)
       {
          vertices[i](j) += displacements(j*nv+i);
       }
+   DeleteElementCenterTree();
 }
 
 void Mesh::GetVertices(Vector &vert_coord) const
@@ -9830,6 +10246,7 @@ void Mesh::SetVertices(const Vector &vert_coord)
       {
          vertices[i](j) = vert_coord(j*nv+i);
       }
+   DeleteElementCenterTree();
 }
 
 void Mesh::GetNode(int i, real_t *coord) const
@@ -9869,6 +10286,7 @@ void Mesh::SetNode(int i, const real_t *coord)
       }
 
    }
+   DeleteElementCenterTree();
 }
 
 void Mesh::MoveNodes(const Vector &displacements)
@@ -10278,14 +10696,65 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
    new_elements.SetSize(8 * NumOfElements + 2 * pyr_counter);
    CoarseFineTr.embeddings.SetSize(new_elements.Size());
 
+   // Offsets of the children of each element in new_elements, indices of the
+   // hexes, and the element computing each new edge and face vertex: the last
+   // element containing the entity, as in a sequential loop. With these, the
+   // elements below are refined independently and the result does not depend
+   // on the number of threads.
+   Array<int> el_offset(NumOfElements + 1), tet_offset(NumOfElements + 1);
+   Array<int> hex_index(NumOfElements);
+   Array<int> edge_owner(NumOfEdges), qface_owner(NumOfQuadFaces);
+   el_offset[0] = tet_offset[0] = 0;
    hex_counter = 0;
-   for (int i = 0, j = 0; i < NumOfElements; i++)
+   for (int i = 0; i < NumOfElements; i++)
+   {
+      const Element::Type el_type = elements[i]->GetType();
+      const bool is_pyr = (el_type == Element::PYRAMID);
+      const bool is_tet = (el_type == Element::TETRAHEDRON);
+      el_offset[i+1] = el_offset[i] + (is_pyr ? 10 : 8);
+      tet_offset[i+1] = tet_offset[i] + (is_tet ? 8 : (is_pyr ? 4 : 0));
+      hex_index[i] =
+         (el_type == Element::HEXAHEDRON) ? hex_counter++ : -1;
+
+      const int *e = el_to_edge->GetRow(i);
+      for (int k = 0; k < el_to_edge->RowSize(i); k++)
+      {
+         edge_owner[e2v.Size() ? e2v[e[k]] : e[k]] = i;
+      }
+      if (NumOfQuadFaces == 0) { continue; }
+      const int *f = el_to_face->GetRow(i);
+      for (int k = 0; k < el_to_face->RowSize(i); k++)
+      {
+         if (faces[f[k]]->GetType() == Element::QUADRILATERAL)
+         {
+            qface_owner[f2qf.Size() ? f2qf[f[k]] : f[k]] = i;
+         }
+      }
+   }
+
+#ifdef MFEM_USE_MEMALLOC
+   // TetMemory is not thread-safe, allocate all new tetrahedra beforehand
+   Array<Tetrahedron*> new_tets(tet_offset[NumOfElements]);
+   for (int k = 0; k < new_tets.Size(); k++)
+   {
+      new_tets[k] = TetMemory.Alloc();
+   }
+#endif
+
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int i = 0; i < NumOfElements; i++)
    {
       const Element::Type el_type = elements[i]->GetType();
       const int attr = elements[i]->GetAttribute();
       int *v = elements[i]->GetVertices();
       const int *e = el_to_edge->GetRow(i);
       int vv[4], ev[12];
+      int j = el_offset[i];
+#ifdef MFEM_USE_MEMALLOC
+      int t = tet_offset[i];
+#endif
 
       if (e2v.Size())
       {
@@ -10300,6 +10769,7 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
          {
             for (int ei = 0; ei < 6; ei++)
             {
+               if (edge_owner[e[ei]] != i) { continue; }
                for (int k = 0; k < 2; k++)
                {
                   vv[k] = v[tet_t::Edges[ei][k]];
@@ -10315,9 +10785,10 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
             // 0: (v0,v1)-(v2,v3), 1: (v0,v2)-(v1,v3), 2: (v0,v3)-(v1,v2)
             // 0:      e0-e5,      1:      e1-e4,      2:      e2-e3
             int rt;
-            ElementTransformation *T = GetElementTransformation(i);
-            T->SetIntPoint(&Geometries.GetCenter(Geometry::TETRAHEDRON));
-            const DenseMatrix &J = T->Jacobian();
+            IsoparametricTransformation T;
+            GetElementTransformation(i, &T);
+            T.SetIntPoint(&Geometries.GetCenter(Geometry::TETRAHEDRON));
+            const DenseMatrix &J = T.Jacobian();
             if (rt_algo == 0)
             {
                // smallest octahedron diagonal
@@ -10447,21 +10918,21 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
             }
 #else
             Tetrahedron *tet;
-            new_elements[j+0] = tet = TetMemory.Alloc();
+            new_elements[j+0] = tet = new_tets[t++];
             tet->Init(v[0], oedge+e[0], oedge+e[1], oedge+e[2], attr);
 
-            new_elements[j+1] = tet = TetMemory.Alloc();
+            new_elements[j+1] = tet = new_tets[t++];
             tet->Init(oedge+e[0], v[1], oedge+e[3], oedge+e[4], attr);
 
-            new_elements[j+2] = tet = TetMemory.Alloc();
+            new_elements[j+2] = tet = new_tets[t++];
             tet->Init(oedge+e[1], oedge+e[3], v[2], oedge+e[5], attr);
 
-            new_elements[j+3] = tet = TetMemory.Alloc();
+            new_elements[j+3] = tet = new_tets[t++];
             tet->Init(oedge+e[2], oedge+e[4], oedge+e[5], v[3], attr);
 
             for (int k = 0; k < 4; k++)
             {
-               new_elements[j+4+k] = tet = TetMemory.Alloc();
+               new_elements[j+4+k] = tet = new_tets[t++];
                tet->Init(oedge+e[mv[k][0]], oedge+e[mv[k][1]],
                          oedge+e[mv[k][2]], oedge+e[mv[k][3]], attr);
             }
@@ -10476,8 +10947,6 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
                CoarseFineTr.embeddings[j+4+k].parent = i;
                CoarseFineTr.embeddings[j+4+k].matrix = 4*(rt+1)+k;
             }
-
-            j += 8;
          }
          break;
 
@@ -10487,6 +10956,7 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
 
             for (int fi = 2; fi < 5; fi++)
             {
+               if (qface_owner[f2qf[f[fi]]] != i) { continue; }
                for (int k = 0; k < 4; k++)
                {
                   vv[k] = v[pri_t::FaceVert[fi][k]];
@@ -10496,6 +10966,7 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
 
             for (int ei = 0; ei < 9; ei++)
             {
+               if (edge_owner[e[ei]] != i) { continue; }
                for (int k = 0; k < 2; k++)
                {
                   vv[k] = v[pri_t::Edges[ei][k]];
@@ -10548,6 +11019,7 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
 
             for (int fi = 0; fi < 1; fi++)
             {
+               if (qface_owner[f2qf[f[fi]]] != i) { continue; }
                for (int k = 0; k < 4; k++)
                {
                   vv[k] = v[pyr_t::FaceVert[fi][k]];
@@ -10557,6 +11029,7 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
 
             for (int ei = 0; ei < 8; ei++)
             {
+               if (edge_owner[e[ei]] != i) { continue; }
                for (int k = 0; k < 2; k++)
                {
                   vv[k] = v[pyr_t::Edges[ei][k]];
@@ -10608,34 +11081,29 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
                                oface+qf0, attr);
 #else
             Tetrahedron *tet;
-            new_elements[j++] = tet = TetMemory.Alloc();
+            new_elements[j++] = tet = new_tets[t++];
             tet->Init(oedge+e[0], oedge+e[4], oedge+e[5],
                       oface+qf0, attr);
 
-            new_elements[j++] = tet = TetMemory.Alloc();
+            new_elements[j++] = tet = new_tets[t++];
             tet->Init(oedge+e[1], oedge+e[5], oedge+e[6],
                       oface+qf0, attr);
 
-            new_elements[j++] = tet = TetMemory.Alloc();
+            new_elements[j++] = tet = new_tets[t++];
             tet->Init(oedge+e[2], oedge+e[6], oedge+e[7],
                       oface+qf0, attr);
 
-            new_elements[j++] = tet = TetMemory.Alloc();
+            new_elements[j++] = tet = new_tets[t++];
             tet->Init(oedge+e[3], oedge+e[7], oedge+e[4],
                       oface+qf0, attr);
 #endif
-            // Tetrahedral elements may be new to this mesh so ensure that
-            // the relevant flags are switched on
-            mesh_geoms |= (1 << Geometry::TETRAHEDRON);
-            meshgen |= 1;
          }
          break;
 
          case Element::HEXAHEDRON:
          {
             const int *f = el_to_face->GetRow(i);
-            const int he = hex_counter;
-            hex_counter++;
+            const int he = hex_index[i];
 
             const int *qf;
             int qf_data[6];
@@ -10653,6 +11121,7 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
 
             for (int fi = 0; fi < 6; fi++)
             {
+               if (qface_owner[qf[fi]] != i) { continue; }
                for (int k = 0; k < 4; k++)
                {
                   vv[k] = v[hex_t::FaceVert[fi][k]];
@@ -10662,6 +11131,7 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
 
             for (int ei = 0; ei < 12; ei++)
             {
+               if (edge_owner[e[ei]] != i) { continue; }
                for (int k = 0; k < 2; k++)
                {
                   vv[k] = v[hex_t::Edges[ei][k]];
@@ -10708,8 +11178,18 @@ void Mesh::UniformRefinement3D_base(Array<int> *f2qf_ptr, DSTable *v_to_v_p,
             MFEM_ABORT("Unknown 3D element type \"" << el_type << "\"");
             break;
       }
+   }
+   for (int i = 0; i < NumOfElements; i++)
+   {
       FreeElement(elements[i]);
    }
+   if (pyr_counter > 0)
+   {
+      // Tetrahedral elements may be new to this mesh so ensure that the
+      // relevant flags are switched on
+      mesh_geoms |= (1 << Geometry::TETRAHEDRON);
+      meshgen |= 1;
+   }
    mfem::Swap(elements, new_elements);
 
    // refine boundary elements
@@ -11332,6 +11812,8 @@ void Mesh::Swap(Mesh& other, bool non_geometry)
 
    mfem::Swap(geom_factors, other.geom_factors);
    mfem::Swap(face_geom_factors, other.face_geom_factors);
+   mfem::Swap(elem_center_tree, other.elem_center_tree);
+   mfem::Swap(elem_center_tree_sequence, other.elem_center_tree_sequence);
 
 #ifdef MFEM_USE_MEMALLOC
    TetMemory.Swap(other.TetMemory);
@@ -12476,6 +12958,89 @@ void Mesh::Save(const std::string &fname, int precision) const
    Print(ofs);
 }
 
+// Write the geometries, the attributes and the vertex indices of the elements
+// in 'elems' as three contiguous blocks, see Mesh::PrintBinary().
+static void PrintBinaryElements(std::ostream &os, const Array<Element*> &elems)
+{
+   const int n = elems.Size();
+   Array<int> geom(n), attr(n), offsets(n + 1);
+   offsets[0] = 0;
+   for (int i = 0; i < n; i++)
+   {
+      geom[i] = elems[i]->GetGeometryType();
+      attr[i] = elems[i]->GetAttribute();
+      offsets[i+1] = offsets[i] + elems[i]->GetNVertices();
+   }
+   Array<int> v(offsets[n]);
+   for (int i = 0; i < n; i++)
+   {
+      const int *ev = elems[i]->GetVertices();
+      std::copy(ev, ev + elems[i]->GetNVertices(), v.GetData() + offsets[i]);
+   }
+   os.write((const char*) geom.GetData(), n*sizeof(int));
+   os.write((const char*) attr.GetData(), n*sizeof(int));
+   os.write((const char*) v.GetData(), v.Size()*sizeof(int));
+}
+
+void Mesh::PrintBinary(std::ostream &os) const
+{
+   MFEM_VERIFY(!NURBSext && !Nonconforming(),
+               "the binary format supports only conforming, non-NURBS meshes");
+   MFEM_VERIFY(!Nodes || !Nodes->FESpace()->IsVariableOrder(),
+               "variable order mesh nodes are not supported");
+
+   os << "MFEM binary mesh v1.0\n";
+
+   // The byte order and the size of real_t are checked when reading
+   bin_io::write<uint32_t>(os, 0x01020304);
+   bin_io::write<int32_t>(os, sizeof(real_t));
+
+   const bool set_names = attribute_sets.SetsExist() ||
+                          bdr_attribute_sets.SetsExist();
+   const int header[7] = { Dim, spaceDim, NumOfElements, NumOfBdrElements,
+                           NumOfVertices, Nodes != NULL, set_names
+                         };
+   os.write((const char*) header, sizeof(header));
+
+   PrintBinaryElements(os, elements);
+   PrintBinaryElements(os, boundary);
+
+   if (set_names)
+   {
+      // The attribute sets are small, keep them in the text format
+      std::ostringstream sets;
+      attribute_sets.Print(sets);
+      bdr_attribute_sets.Print(sets);
+      const std::string str = sets.str();
+      bin_io::write<int64_t>(os, str.size());
+      os.write(str.data(), str.size());
+   }
+
+   // All three components of every vertex are written, so that they can be
+   // read directly into the storage of 'vertices'
+   os.write((const char*) vertices.GetData(), NumOfVertices*sizeof(Vertex));
+
+   if (Nodes)
+   {
+      const FiniteElementSpace *fes = Nodes->FESpace();
+      const std::string fec_name = fes->FEColl()->Name();
+      bin_io::write<int32_t>(os, fec_name.size());
+      os.write(fec_name.data(), fec_name.size());
+      bin_io::write<int32_t>(os, fes->GetVDim());
+      bin_io::write<int32_t>(os, fes->GetOrdering());
+      bin_io::write<int64_t>(os, Nodes->Size());
+      os.write((const char*) Nodes->HostRead(), Nodes->Size()*sizeof(real_t));
+   }
+   os.flush();
+}
+
+void Mesh::SaveBinary(const std::string &fname) const
+{
+   ofstream ofs(fname, std::ios::out | std::ios::binary);
+   MFEM_VERIFY(ofs.good(), "cannot open file " << fname);
+   PrintBinary(ofs);
+}
+
 #ifdef MFEM_USE_ADIOS2
 void Mesh::Print(adios2stream &os) const
 {
@@ -14091,6 +14656,39 @@ std::ostream &operator<<(std::ostream &os, const Mesh &mesh)
    return os;
 }
 
+void Mesh::DeleteElementCenterTree()
+{
+   delete elem_center_tree;
+   elem_center_tree = nullptr;
+}
+
+const KDTreeBase<int,real_t> &Mesh::GetElementCenterTree()
+{
+   if (elem_center_tree && elem_center_tree_sequence == sequence)
+   {
+      return *elem_center_tree;
+   }
+
+   DeleteElementCenterTree();
+   switch (spaceDim)
+   {
+      case 1: elem_center_tree = new KDTree1D; break;
+      case 2: elem_center_tree = new KDTree2D; break;
+      case 3: elem_center_tree = new KDTree3D; break;
+      default: MFEM_ABORT("invalid space dimension: " << spaceDim);
+   }
+   Vector pt(spaceDim);
+   for (int i = 0; i < GetNE(); i++)
+   {
+      GetElementTransformation(i)->Transform(
+         Geometries.GetCenter(GetElementBaseGeometry(i)), pt);
+      elem_center_tree->AddPoint(pt.GetData(), i);
+   }
+   elem_center_tree->Sort();
+   elem_center_tree_sequence = sequence;
+   return *elem_center_tree;
+}
+
 int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
                      Array<IntegrationPoint>& ips, bool warn,
                      InverseElementTransformation *inv_trans)
@@ -14108,30 +14706,19 @@ int Mesh::FindPoints(DenseMatrix &point_mat, Array<int>& elem_ids,
    inv_tr = inv_tr ? inv_tr : new InverseElementTransformation;
 
    // For each point in 'point_mat', find the element whose center is closest.
-   Vector min_dist(npts);
+   const KDTreeBase<int,real_t> &center_tree = GetElementCenterTree();
    Array<int> e_idx(npts);
-   min_dist = std::numeric_limits<real_t>::max();
-   e_idx = -1;
-
-   Vector pt(spaceDim);
-   for (int i = 0; i < GetNE(); i++)
+#ifdef MFEM_USE_LEGACY_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int k = 0; k < npts; k++)
    {
-      GetElementTransformation(i)->Transform(
-         Geometries.GetCenter(GetElementBaseGeometry(i)), pt);
-      for (int k = 0; k < npts; k++)
-      {
-         real_t dist = pt.DistanceTo(data+k*spaceDim);
-         if (dist < min_dist(k))
-         {
-            min_dist(k) = dist;
-            e_idx[k] = i;
-         }
-      }
+      e_idx[k] = center_tree.FindClosestPoint(data+k*spaceDim);
    }
 
    // Checks if the points lie in the closest element
    int pts_found = 0;
-   pt.NewDataAndSize(NULL, spaceDim);
+   Vector pt(NULL, spaceDim);
    for (int k = 0; k < npts; k++)
    {
       pt.SetData(data+k*spaceDim);
@@ -44,6 +44,7 @@ class NURBSExtension;
 class FiniteElementSpace;
 class GridFunction;
 struct Refinement;
+template <typename Tindex, typename Tfloat> class KDTreeBase;
 
 /** An enum type to specify if interior or boundary faces are desired. */
 enum class FaceType : bool {Interior, Boundary};
@@ -315,11 +316,35 @@ public:
    Array<FaceGeometricFactors*> face_geom_factors; /**< Optional face geometric
                                                         factors. */
 
+private:
+   /// Optional k-d tree of the element centers, see GetElementCenterTree().
+   KDTreeBase<int,real_t> *elem_center_tree = nullptr;
+   /// Value of #sequence when #elem_center_tree was built.
+   long elem_center_tree_sequence = -1;
+
+   /// Delete the cached #elem_center_tree, e.g. after the vertices are moved.
+   void DeleteElementCenterTree();
+
+public:
    // Global parameter that can be used to control the removal of unused
    // vertices performed when reading a mesh in MFEM format. The default value
    // (true) is set in mesh_readers.cpp.
    static bool remove_unused_vertices;
 
+   // Global parameter that selects the algorithm used to number the edges and
+   // the faces of the mesh in GetElementToEdgeTable() and
+   // GetElementToFaceTable(). When true, the edge and face keys are bucketed
+   // and sorted instead of inserted in DSTable/STable3D; the resulting
+   // numbering is identical. The default value (false) is set in mesh.cpp.
+   static bool sorted_topology;
+
+   // Global parameter that enables the reordering of the elements of the meshes
+   // loaded with Mesh::Load(), including the Mesh file and stream constructors,
+   // for memory locality, see ReorderElementsForLocality(). The value is the
+   // method: 0 = disabled, 1 = Hilbert curve, 2 = Gecko. The default value (0)
+   // is set in mesh.cpp.
+   static int locality_ordering;
+
    /// Map from boundary or interior face indices to mesh face indices.
    const Array<int>& GetFaceIndices(FaceType ftype) const;
    /// Inverse of the map FaceIndices(ftype)
@@ -346,6 +371,8 @@ protected:
    // Readers for different mesh formats, used in the Load() method.
    // The implementations of these methods are in mesh_readers.cpp.
    void ReadMFEMMesh(std::istream &input, int version, int &curved);
+   void ReadMFEMBinaryMesh(std::istream &input, int &curved, int &read_gf,
+                           bool &finalize_topo);
    void ReadLineMesh(std::istream &input);
    void ReadNetgen2DMesh(std::istream &input, int &curved);
    void ReadNetgen3DMesh(std::istream &input);
@@ -415,6 +442,8 @@ protected:
 
    STable3D *GetFacesTable();
    STable3D *GetElementToFaceTable(int ret_ftbl = 0);
+   /// Sort-based version of GetElementToFaceTable() with @a ret_ftbl = 0.
+   void GetElementToFaceTableSorted();
 
    /** Red refinement. Element with index i is refined. The default
        red refinement for now is Uniform. */
@@ -596,6 +625,8 @@ protected:
        T(i, 0) gives the index of edge in element i that connects vertex 0
        to vertex 1, etc. Returns the number of the edges. */
    int GetElementToEdgeTable(Table &);
+   /// Sort-based version of GetElementToEdgeTable().
+   int GetElementToEdgeTableSorted(Table &);
 
    /// Used in GenerateFaces()
    void AddPointFaceElement(int lf, int gf, int el);
@@ -820,6 +851,7 @@ public:
    {
       Loader(input, generate_edges);
       Finalize(refine, fix_orientation);
+      if (locality_ordering) { ReorderElementsForLocality(locality_ordering); }
    }
 
    /// Swaps internal data with another mesh. By default, non-geometry members
@@ -1258,6 +1290,17 @@ public:
        reorders vertices, edges and faces along with the elements. */
    void ReorderElements(const Array<int> &ordering, bool reorder_vertices = true);
 
+   /** @brief Reorder the elements for memory locality, using the ordering of
+       GetHilbertElementOrdering() (@a method = 1) or GetGeckoElementOrdering()
+       (@a method = 2).
+
+       The vertices, edges and faces are renumbered in the order in which they
+       are first visited by the reordered elements, see ReorderElements(). As a
+       result, the DOFs of a FiniteElementSpace constructed afterwards are also
+       numbered in element traversal order within each type of mesh entity.
+       Nonconforming and NURBS meshes are left unchanged. */
+   void ReorderElementsForLocality(int method = 1);
+
    /// @}
 
    /// @anchor mfem_Mesh_deprecated_ctors @name Deprecated mesh constructors
@@ -2257,7 +2300,22 @@ public:
 
    /// @note The returned array should be deleted by the caller.
    int *CartesianPartitioning(int nxyz[]);
-   /// @note The returned array should be deleted by the caller.
+   /** @brief Partition the mesh elements into @a nparts parts and return the
+       part of each element. */
+   /** The available values of @a part_method are:
+       - 0, 3: METIS_PartGraphRecursive, for a small number of parts
+       - 1, 4: METIS_PartGraphKway, for a large number of parts
+       - 2, 5: METIS_PartGraphVKway, minimizing the communication volume
+       - 6: built-in partitioner which does not require METIS: the elements
+         ordered by GetHilbertElementOrdering() are split into contiguous parts
+         of equal size, whose boundaries are then refined to reduce the number
+         of cut faces, allowing a 3% load imbalance.
+
+       With methods 0-2 the neighbor lists are sorted before calling METIS.
+       When MFEM is built without METIS, all methods use the built-in
+       partitioner.
+
+       @note The returned array should be deleted by the caller. */
    int *GeneratePartitioning(int nparts, int part_method = 1);
    /// @todo This method needs a proper description
    void CheckPartitioning(int *partitioning_);
@@ -2578,6 +2636,19 @@ public:
    /// used for ASCII output.
    virtual void Save(const std::string &fname, int precision=16) const;
 
+   /** @brief Print the mesh to the given stream using the binary MFEM mesh
+       format, "MFEM binary mesh v1.0".
+
+       The elements, boundary elements, vertices and mesh nodes are written as
+       contiguous blocks that are read back with bulk copies by the Mesh
+       constructors and Mesh::LoadFromFile(). The stream should be opened in
+       binary mode. The file is not portable across byte orders or sizes of
+       real_t. Only conforming, non-NURBS meshes are supported. */
+   void PrintBinary(std::ostream &os) const;
+
+   /// Save the mesh to a file using Mesh::PrintBinary.
+   void SaveBinary(const std::string &fname) const;
+
    /// Print the mesh to the given stream using the adios2 bp format
 #ifdef MFEM_USE_ADIOS2
    virtual void Print(adios2stream &os) const;
@@ -2686,6 +2757,13 @@ public:
    std::vector<int> CreatePeriodicVertexMapping(
       const std::vector<Vector> &translations, real_t tol = 1e-8) const;
 
+   /** @brief Return a k-d tree of the images of the element centers, whose
+       point indices are the element indices. */
+   /** The tree is built on first use and cached until the mesh is refined or
+       its nodes are updated, see NodesUpdated(). It is used by FindPoints() to
+       locate the element closest to each point in logarithmic time. */
+   const KDTreeBase<int,real_t> &GetElementCenterTree();
+
    /** @brief Find the ids of the elements that contain the given points, and
        their corresponding reference coordinates.
 
@@ -2699,6 +2777,9 @@ public:
        completely overwritten by deriving custom classes that override the
        Transform() method.
 
+       The candidate element for each point is the one whose center is closest
+       to it, see GetElementCenterTree(), followed by its neighbors.
+
        If no element is found for the i-th point, elem_ids[i] is set to -1.
 
        In the ParMesh implementation, the @a point_mat is expected to be the
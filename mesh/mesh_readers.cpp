@@ -20,8 +20,12 @@
 #include <iostream>
 #include <cstdio>
 #include <vector>
+#include <sstream>
 #include <algorithm>
 #include <map>
+#include <unordered_map>
+#include <cstring>
+#include <cstdlib>
 
 #ifdef MFEM_USE_NETCDF
 #include "netcdf.h"
@@ -131,6 +135,95 @@ void Mesh::ReadMFEMMesh(std::istream &input, int version, int &curved)
    if (remove_unused_vertices) { RemoveUnusedVertices(); }
 }
 
+void Mesh::ReadMFEMBinaryMesh(std::istream &input, int &curved, int &read_gf,
+                              bool &finalize_topo)
+{
+   // Read MFEM binary mesh v1.0 format, see Mesh::PrintBinary()
+   MFEM_VERIFY(bin_io::read<uint32_t>(input) == 0x01020304,
+               "binary mesh file has a different byte order");
+   MFEM_VERIFY(bin_io::read<int32_t>(input) == sizeof(real_t),
+               "binary mesh file has a different size of real_t");
+
+   int header[7];
+   input.read((char*) header, sizeof(header));
+   MFEM_VERIFY(input.good(), "invalid binary mesh file");
+   Dim = header[0];
+   spaceDim = header[1];
+   NumOfElements = header[2];
+   NumOfBdrElements = header[3];
+   NumOfVertices = header[4];
+   const bool has_nodes = header[5], set_names = header[6];
+
+   auto read_elements = [&](Array<Element*> &elems, int n)
+   {
+      Array<int> geom(n), attr(n);
+      input.read((char*) geom.GetData(), n*sizeof(int));
+      input.read((char*) attr.GetData(), n*sizeof(int));
+      int nv = 0;
+      for (int i = 0; i < n; i++)
+      {
+         MFEM_VERIFY(geom[i] >= 0 && geom[i] < Geometry::NumGeom,
+                     "invalid binary mesh file");
+         nv += Geometry::NumVerts[geom[i]];
+      }
+      Array<int> v(nv);
+      input.read((char*) v.GetData(), nv*sizeof(int));
+      MFEM_VERIFY(input.good(), "invalid binary mesh file");
+      elems.SetSize(n);
+      for (int i = 0, k = 0; i < n; i++)
+      {
+         elems[i] = NewElement(geom[i]);
+         elems[i]->SetVertices(v.GetData() + k);
+         elems[i]->SetAttribute(attr[i]);
+         k += Geometry::NumVerts[geom[i]];
+      }
+   };
+   read_elements(elements, NumOfElements);
+   read_elements(boundary, NumOfBdrElements);
+
+   if (set_names)
+   {
+      std::string sets(bin_io::read<int64_t>(input), '\0');
+      input.read(&sets[0], sets.size());
+      std::istringstream sets_input(sets);
+      attribute_sets.attr_sets.Load(sets_input);
+      attribute_sets.attr_sets.SortAll();
+      attribute_sets.attr_sets.UniqueAll();
+      bdr_attribute_sets.attr_sets.Load(sets_input);
+      bdr_attribute_sets.attr_sets.SortAll();
+      bdr_attribute_sets.attr_sets.UniqueAll();
+   }
+
+   vertices.SetSize(NumOfVertices);
+   input.read((char*) vertices.GetData(), NumOfVertices*sizeof(Vertex));
+   MFEM_VERIFY(input.good(), "invalid binary mesh file");
+
+   if (remove_unused_vertices) { RemoveUnusedVertices(); }
+   if (!has_nodes) { return; }
+
+   // The nodes are read directly into the GridFunction, which requires the
+   // topology of the mesh
+   curved = 1;
+   read_gf = 0;
+   finalize_topo = false;
+   FinalizeTopology(false);
+
+   std::string fec_name(bin_io::read<int32_t>(input), '\0');
+   input.read(&fec_name[0], fec_name.size());
+   const int vdim = bin_io::read<int32_t>(input);
+   const int ordering = bin_io::read<int32_t>(input);
+   const int64_t size = bin_io::read<int64_t>(input);
+   FiniteElementCollection *fec = FiniteElementCollection::New(fec_name.c_str());
+   FiniteElementSpace *fes = new FiniteElementSpace(
+      this, fec, vdim, static_cast<Ordering::Type>(ordering));
+   Nodes = new GridFunction(fes);
+   Nodes->MakeOwner(fec);
+   own_nodes = 1;
+   MFEM_VERIFY(size == Nodes->Size(), "invalid binary mesh file");
+   input.read((char*) Nodes->HostWrite(), size*sizeof(real_t));
+   MFEM_VERIFY(input.good(), "invalid binary mesh file");
+}
+
 void Mesh::ReadLineMesh(std::istream &input)
 {
    int j,p1,p2,a;
@@ -1513,6 +1606,44 @@ void Mesh::ReadInlineMesh(std::istream &input, bool generate_edges)
    }
 }
 
+// Read the rest of the current section of a Gmsh file, i.e. everything up to
+// the '$' of its end tag, into 'text' and return the offsets of the first
+// 'nlines' non-empty lines in 'line_begin'. The lines can then be parsed in
+// parallel. The '$' is consumed, so the next token in 'input' is the name of
+// the end tag without it, which is skipped by ReadGmshMesh().
+static void ReadGmshSectionLines(std::istream &input, int nlines,
+                                 std::string &text,
+                                 std::vector<size_t> &line_begin)
+{
+   getline(input, text, '$');
+   line_begin.resize(nlines);
+   size_t pos = 0;
+   for (int i = 0; i < nlines; i++)
+   {
+      pos = text.find_first_not_of(" \t\r\n", pos);
+      MFEM_VERIFY(pos != string::npos, "Gmsh file : unexpected end of section");
+      line_begin[i] = pos;
+      pos = text.find('\n', pos);
+      if (pos == string::npos) { pos = text.size(); }
+   }
+}
+
+// Return the number of whitespace separated tokens in the line starting at p.
+static int CountGmshLineTokens(const char *p)
+{
+   int n = 0;
+   while (true)
+   {
+      while (*p == ' ' || *p == '\t' || *p == '\r') { p++; }
+      if (*p == '\n' || *p == '\0') { return n; }
+      n++;
+      while (*p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' && *p != '\0')
+      {
+         p++;
+      }
+   }
+}
+
 void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
 {
    string buff;
@@ -1542,7 +1673,7 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
    // A map between a serial number of the vertex and its number in the file
    // (there may be gaps in the numbering, and also Gmsh enumerates vertices
    // starting from 1, not 0)
-   map<int, int> vertices_map;
+   std::unordered_map<int, int> vertices_map;
 
    // A map containing names of physical curves, surfaces, and volumes.
    // The first index is the dimension of the physical manifold, the second
@@ -1582,26 +1713,56 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
          input >> NumOfVertices;
          getline(input, buff);
          vertices.SetSize(NumOfVertices);
-         int serial_number;
          const int gmsh_dim = 3; // Gmsh always outputs 3 coordinates
          real_t coord[gmsh_dim];
-         for (int ver = 0; ver < NumOfVertices; ++ver)
+
+         // Read the whole section at once and decode the nodes in parallel
+         Array<int> node_ids(NumOfVertices);
+         Array<double> node_coords(gmsh_dim*NumOfVertices);
+         if (binary)
          {
-            if (binary)
+            const size_t rec_size = sizeof(int) + gmsh_dim*sizeof(double);
+            std::vector<char> data(NumOfVertices*rec_size);
+            input.read(data.data(), data.size());
+#ifdef MFEM_USE_LEGACY_OPENMP
+            #pragma omp parallel for
+#endif
+            for (int ver = 0; ver < NumOfVertices; ++ver)
             {
-               input.read(reinterpret_cast<char*>(&serial_number), sizeof(int));
-               input.read(reinterpret_cast<char*>(coord), gmsh_dim*sizeof(double));
+               const char *rec = data.data() + ver*rec_size;
+               std::memcpy(&node_ids[ver], rec, sizeof(int));
+               std::memcpy(&node_coords[gmsh_dim*ver], rec + sizeof(int),
+                           gmsh_dim*sizeof(double));
             }
-            else // ASCII
+         }
+         else // ASCII
+         {
+            std::string text;
+            std::vector<size_t> line_begin;
+            ReadGmshSectionLines(input, NumOfVertices, text, line_begin);
+#ifdef MFEM_USE_LEGACY_OPENMP
+            #pragma omp parallel for
+#endif
+            for (int ver = 0; ver < NumOfVertices; ++ver)
             {
-               input >> serial_number;
+               char *p = &text[line_begin[ver]];
+               node_ids[ver] = (int) std::strtol(p, &p, 10);
                for (int ci = 0; ci < gmsh_dim; ++ci)
                {
-                  input >> coord[ci];
+                  node_coords[gmsh_dim*ver + ci] = std::strtod(p, &p);
                }
             }
+         }
+
+         vertices_map.reserve(NumOfVertices);
+         for (int ver = 0; ver < NumOfVertices; ++ver)
+         {
+            for (int ci = 0; ci < gmsh_dim; ++ci)
+            {
+               coord[ci] = node_coords[gmsh_dim*ver + ci];
+            }
             vertices[ver] = Vertex(coord, gmsh_dim);
-            vertices_map[serial_number] = ver;
+            vertices_map[node_ids[ver]] = ver;
 
             for (int ci = 0; ci < gmsh_dim; ++ci)
             {
@@ -1978,8 +2139,7 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
                   vector<int> vert_indices(n_elem_nodes);
                   for (int vi = 0; vi < n_elem_nodes; ++vi)
                   {
-                     map<int, int>::const_iterator it =
-                        vertices_map.find(data[1+n_tags+vi]);
+                     auto it = vertices_map.find(data[1+n_tags+vi]);
                      if (it == vertices_map.end())
                      {
                         MFEM_ABORT("Gmsh file : vertex index doesn't exist");
@@ -2183,11 +2343,56 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
          } // if binary
          else // ASCII
          {
+            // Read the whole section at once and split it into integer
+            // tokens in parallel, converting the node numbers of each element
+            // to vertex indices (-1 if not found)
+            std::string text;
+            std::vector<size_t> line_begin;
+            ReadGmshSectionLines(input, num_of_all_elements, text, line_begin);
+            std::vector<size_t> tok_offsets(num_of_all_elements + 1);
+            tok_offsets[0] = 0;
+#ifdef MFEM_USE_LEGACY_OPENMP
+            #pragma omp parallel for
+#endif
+            for (int el = 0; el < num_of_all_elements; ++el)
+            {
+               tok_offsets[el+1] = CountGmshLineTokens(&text[line_begin[el]]);
+            }
+            for (int el = 0; el < num_of_all_elements; ++el)
+            {
+               tok_offsets[el+1] += tok_offsets[el];
+            }
+            std::vector<int> tokens(tok_offsets[num_of_all_elements]);
+#ifdef MFEM_USE_LEGACY_OPENMP
+            #pragma omp parallel for
+#endif
+            for (int el = 0; el < num_of_all_elements; ++el)
+            {
+               char *p = &text[line_begin[el]];
+               int *tok = tokens.data() + tok_offsets[el];
+               const int n_tok = int(tok_offsets[el+1] - tok_offsets[el]);
+               for (int i = 0; i < n_tok; i++)
+               {
+                  tok[i] = (int) std::strtol(p, &p, 10);
+               }
+               // skip the serial number, the type and the tags
+               const int first_node = (n_tok > 2) ? 3 + tok[2] : n_tok;
+               for (int i = first_node; i < n_tok; i++)
+               {
+                  const auto it = vertices_map.find(tok[i]);
+                  tok[i] = (it != vertices_map.end()) ? it->second : -1;
+               }
+            }
+
             for (int el = 0; el < num_of_all_elements; ++el)
             {
-               input >> serial_number >> type_of_element >> n_tags;
-               vector<int> data(n_tags);
-               for (int i = 0; i < n_tags; ++i) { input >> data[i]; }
+               const int *tok = tokens.data() + tok_offsets[el];
+               const int n_tok = int(tok_offsets[el+1] - tok_offsets[el]);
+               MFEM_VERIFY(n_tok >= 3, "Gmsh file : invalid element");
+               serial_number = tok[0];
+               type_of_element = tok[1];
+               n_tags = tok[2];
+               vector<int> data(tok + 3, tok + 3 + n_tags);
                // physical domain - the most important value (to distinguish
                // materials with different properties)
                phys_domain = (n_tags > 0) ? data[0] : 1;
@@ -2200,17 +2405,15 @@ void Mesh::ReadGmshMesh(std::istream &input, int &curved, int &read_gf)
                // we currently just skip the partitions if they exist, and go
                // directly to vertices describing the mesh element
                const int n_elem_nodes = nodes_of_gmsh_element[type_of_element-1];
-               vector<int> vert_indices(n_elem_nodes);
-               int index;
+               MFEM_VERIFY(n_tok == 3 + n_tags + n_elem_nodes,
+                           "Gmsh file : invalid element");
+               vector<int> vert_indices(tok + 3 + n_tags, tok + n_tok);
                for (int vi = 0; vi < n_elem_nodes; ++vi)
                {
-                  input >> index;
-                  map<int, int>::const_iterator it = vertices_map.find(index);
-                  if (it == vertices_map.end())
+                  if (vert_indices[vi] < 0)
                   {
                      MFEM_ABORT("Gmsh file : vertex index doesn't exist");
                   }
-                  vert_indices[vi] = it->second;
                }
 
                // Non-positive attributes are not allowed in MFEM. However,
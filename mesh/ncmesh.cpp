@@ -1135,6 +1135,8 @@ void NCMesh::RefineElement(const Refinement & ref)
 
    if (!ref_type) { return; }
 
+   MarkModifiedRoot(elem);
+
    // handle elements that may have been (force-) refined already
    Element &el = elements[elem];
    if (el.ref_type)
@@ -2040,6 +2042,8 @@ void NCMesh::DerefineElement(int elem)
    Element &el = elements[elem];
    if (!el.ref_type) { return; }
 
+   MarkModifiedRoot(elem);
+
    int child[MaxElemChildren];
    std::memcpy(child, el.child, sizeof(child));
 
@@ -2451,14 +2455,48 @@ void NCMesh::CollectLeafElements(int elem, int state, Array<int> &ghosts,
 void NCMesh::UpdateLeafElements()
 {
    Array<int> ghosts;
+   const int nroots = root_state.Size();
+
+   // The leaves of a root are contiguous in 'leaf_elements'. If the ranges of
+   // the roots are known from the previous update, the leaves of the roots
+   // that were not refined or derefined since then are copied from the old
+   // list instead of traversing their trees again.
+   Array<int> old_leaves, old_offset;
+   const bool incremental = (root_leaf_offset.Size() == nroots + 1 &&
+                             changed_roots.Size() == nroots);
+   if (incremental)
+   {
+      old_leaves.Swap(leaf_elements);
+      old_offset.Swap(root_leaf_offset);
+   }
 
    // collect leaf elements in leaf_elements and ghosts elements in ghosts from
    // all roots
    leaf_elements.SetSize(0);
-   for (int i = 0, counter = 0; i < root_state.Size(); i++)
+   root_leaf_offset.SetSize(nroots + 1);
+   for (int i = 0, counter = 0; i < nroots; i++)
    {
-      CollectLeafElements(i, root_state[i], ghosts, counter);
+      root_leaf_offset[i] = leaf_elements.Size();
+      if (incremental && !changed_roots[i])
+      {
+         for (int j = old_offset[i]; j < old_offset[i+1]; j++)
+         {
+            leaf_elements.Append(old_leaves[j]);
+            elements[old_leaves[j]].index = counter++;
+         }
+      }
+      else
+      {
+         CollectLeafElements(i, root_state[i], ghosts, counter);
+      }
    }
+   root_leaf_offset[nroots] = leaf_elements.Size();
+   changed_roots.SetSize(nroots);
+   changed_roots = 0;
+
+   // ghost elements are not contiguous by root and the ghost layer can change
+   // without refinement, so the next update will be a full one
+   if (ghosts.Size()) { root_leaf_offset.DeleteAll(); }
 
    NElements = leaf_elements.Size();
    NGhostElements = ghosts.Size();
@@ -2655,6 +2693,7 @@ void NCMesh::InitRootState(int root_count)
 {
    root_state.SetSize(root_count);
    root_state = 0;
+   root_leaf_offset.DeleteAll();
 
    if (elements.Size() == 0) { return; }
 
@@ -6057,44 +6096,138 @@ void NCMesh::CountSplits(int elem, int splits[3]) const
    }
 }
 
+char NCMesh::GetLimitRefType(int elem, int max_level) const
+{
+   int splits[3];
+   CountSplits(elem, splits);
+
+   char ref_type = 0;
+   for (int k = 0; k < Dim; k++)
+   {
+      if (splits[k] > max_level)
+      {
+         ref_type |= (1 << k);
+      }
+   }
+
+   if (ref_type && Iso)
+   {
+      // iso meshes should only be modified by iso refinements
+      ref_type = 7;
+   }
+   return ref_type;
+}
+
 void NCMesh::GetLimitRefinements(Array<Refinement> &refinements, int max_level)
 {
    for (int i = 0; i < leaf_elements.Size(); i++)
    {
       if (IsGhost(elements[leaf_elements[i]])) { break; } // TODO: NElements
 
-      int splits[3];
-      CountSplits(leaf_elements[i], splits);
+      const char ref_type = GetLimitRefType(leaf_elements[i], max_level);
+      if (ref_type)
+      {
+         refinements.Append(Refinement(i, ref_type));
+      }
+   }
+}
 
-      char ref_type = 0;
-      for (int k = 0; k < Dim; k++)
+void NCMesh::GetLimitRefinements(Array<Refinement> &refinements, int max_level,
+                                 const Array<char> &roots)
+{
+   // The splits of a leaf can only be changed by the refinement of elements
+   // touching it. These are in the same root element or in a root sharing a
+   // vertex with it, since the root elements form a conforming mesh.
+   const int nroots = root_state.Size();
+   Array<char> vmark(nodes.NumIds());
+   vmark = 0;
+   for (int r = 0; r < nroots; r++)
+   {
+      if (!roots[r]) { continue; }
+      for (int k = 0; k < GI[elements[r].Geom()].nv; k++)
+      {
+         vmark[RetrieveNode(elements[r], k)] = 1;
+      }
+   }
+
+   // collect the leaves of the roots to check
+   Array<int> leaves, stack;
+   for (int r = 0; r < nroots; r++)
+   {
+      bool check = roots[r];
+      for (int k = 0; !check && k < GI[elements[r].Geom()].nv; k++)
+      {
+         check = vmark[RetrieveNode(elements[r], k)];
+      }
+      if (!check) { continue; }
+
+      stack.Append(r);
+      while (stack.Size())
       {
-         if (splits[k] > max_level)
+         const Element &el = elements[stack.Last()];
+         stack.DeleteLast();
+         if (!el.ref_type)
+         {
+            if (el.index >= 0 && !IsGhost(el)) { leaves.Append(el.index); }
+            continue;
+         }
+         for (int i = 0; i < MaxElemChildren && el.child[i] >= 0; i++)
          {
-            ref_type |= (1 << k);
+            stack.Append(el.child[i]);
          }
       }
+   }
 
+   // check them in the order of GetLimitRefinements(refinements, max_level)
+   leaves.Sort();
+   for (int i : leaves)
+   {
+      const char ref_type = GetLimitRefType(leaf_elements[i], max_level);
       if (ref_type)
       {
-         if (Iso)
-         {
-            // iso meshes should only be modified by iso refinements
-            ref_type = 7;
-         }
          refinements.Append(Refinement(i, ref_type));
       }
    }
 }
 
+void NCMesh::MarkModifiedRoot(int elem)
+{
+   while (elements[elem].parent >= 0) { elem = elements[elem].parent; }
+   if (elem < changed_roots.Size()) { changed_roots[elem] = 1; }
+   if (limit_level > 0) { modified_roots[elem] = 1; }
+}
+
 void NCMesh::LimitNCLevel(int max_nc_level)
 {
    MFEM_VERIFY(max_nc_level >= 1, "'max_nc_level' must be 1 or greater.");
 
+   // If the limit (or a stricter one) was enforced by the previous call, only
+   // the neighborhood of the roots modified since then needs to be checked.
+   // Otherwise, check all leaves and start tracking the modified roots.
+   const bool incremental =
+      (!Legacy && limit_level > 0 && limit_level <= max_nc_level);
+   if (!incremental)
+   {
+      modified_roots.SetSize(root_state.Size());
+      modified_roots = 1;
+   }
+   limit_level = max_nc_level;
+
+   bool check_all = !incremental;
    while (1)
    {
       Array<Refinement> refinements;
-      GetLimitRefinements(refinements, max_nc_level);
+      if (check_all)
+      {
+         GetLimitRefinements(refinements, max_nc_level);
+      }
+      else
+      {
+         GetLimitRefinements(refinements, max_nc_level, modified_roots);
+      }
+      modified_roots = 0;
+      check_all = false;
+
       if (!refinements.Size()) { break; }
       Refine(refinements);
    }
@@ -797,7 +797,22 @@ protected:
 
    Table element_vertex; ///< leaf-element to vertex table, see FindSetNeighbors
 
-   /// Update the leaf elements indices in leaf_elements
+   /** If positive, all leaf elements satisfy the NC level limit 'limit_level',
+       except possibly around the roots marked in 'modified_roots'. Set by
+       LimitNCLevel(), so that its next call only checks those regions. */
+   int limit_level = 0;
+   /// Root elements whose tree was refined or derefined, see 'limit_level'.
+   Array<char> modified_roots;
+
+   /** Offsets of the leaves of each root element in 'leaf_elements', or empty
+       if the next UpdateLeafElements() must collect all leaves. */
+   Array<int> root_leaf_offset;
+   /// Root elements refined or derefined since the last UpdateLeafElements().
+   Array<char> changed_roots;
+
+   /** Update the leaf elements indices in leaf_elements. Only the trees of the
+       roots marked in 'changed_roots' are traversed, if 'root_leaf_offset' is
+       set. */
    void UpdateLeafElements();
 
    /** @brief This method assigns indices to vertices (Node::vert_index) that
@@ -1342,6 +1357,18 @@ protected:
    void CountSplits(int elem, int splits[3]) const;
    void GetLimitRefinements(Array<Refinement> &refinements, int max_level);
 
+   /** Like GetLimitRefinements(), but only check the leaves of the roots that
+       share a vertex with one of the roots marked in @a roots. */
+   void GetLimitRefinements(Array<Refinement> &refinements, int max_level,
+                            const Array<char> &roots);
+
+   /// Return the refinement type needed by @a elem to satisfy @a max_level.
+   char GetLimitRefType(int elem, int max_level) const;
+
+   /** Mark the root of @a elem in 'changed_roots' and, if 'limit_level' is
+       set, in 'modified_roots'. */
+   void MarkModifiedRoot(int elem);
+
    // Checker helpers
 
    static void CheckSupportedGeom(Geometry::Type geom)
@@ -22,6 +22,8 @@
 
 #include <iostream>
 #include <fstream>
+#include <sstream>
+#include <limits>
 
 using namespace std;
 
@@ -1525,6 +1527,75 @@ ParMesh ParMesh::MakeSimplicial(ParMesh &orig_mesh)
    return mesh;
 }
 
+ParMesh ParMesh::LoadFromRoot(MPI_Comm comm, const char *filename,
+                              int part_method, int root, int generate_edges,
+                              bool refine, bool fix_orientation)
+{
+   int myrank;
+   MPI_Comm_rank(comm, &myrank);
+   std::unique_ptr<Mesh> mesh;
+   if (myrank == root)
+   {
+      mesh.reset(new Mesh(filename, generate_edges, refine, fix_orientation));
+   }
+   return ScatterFromRoot(comm, mesh.get(), nullptr, part_method, root,
+                          generate_edges, refine, fix_orientation);
+}
+
+ParMesh ParMesh::ScatterFromRoot(MPI_Comm comm, Mesh *mesh,
+                                 const int *partitioning, int part_method,
+                                 int root, int generate_edges, bool refine,
+                                 bool fix_orientation)
+{
+   int nranks, myrank;
+   MPI_Comm_size(comm, &nranks);
+   MPI_Comm_rank(comm, &myrank);
+   MFEM_VERIFY(0 <= root && root < nranks, "invalid root = " << root);
+
+   constexpr int tag = 374;
+   std::string my_part;
+   if (myrank == root)
+   {
+      MFEM_VERIFY(mesh, "the mesh must be given on the root rank");
+      MFEM_VERIFY(mesh->Conforming(), "nonconforming meshes are not supported");
+      MFEM_VERIFY(mesh->GetNE() >= nranks, "the mesh has fewer elements ("
+                  << mesh->GetNE() << ") than the number of ranks ("
+                  << nranks << ")");
+
+      // Only one MeshPart is kept in memory at a time.
+      MeshPartitioner partitioner(*mesh, nranks, partitioning, part_method);
+      MeshPart mesh_part;
+      for (int p = 0; p < nranks; p++)
+      {
+         partitioner.ExtractPart(p, mesh_part);
+         std::ostringstream oss;
+         oss.precision(std::numeric_limits<real_t>::max_digits10);
+         mesh_part.Print(oss);
+         if (p == root) { my_part = oss.str(); continue; }
+         const std::string buf = oss.str();
+         MFEM_VERIFY(buf.size() <= (size_t)std::numeric_limits<int>::max(),
+                     "part " << p << " is too large to send");
+         MPI_Send(buf.data(), (int)buf.size(), MPI_CHAR, p, tag, comm);
+      }
+   }
+   else
+   {
+      MPI_Status status;
+      int count;
+      MPI_Probe(root, tag, comm, &status);
+      MPI_Get_count(&status, MPI_CHAR, &count);
+      my_part.resize(count);
+      MPI_Recv(&my_part[0], count, MPI_CHAR, root, tag, comm,
+               MPI_STATUS_IGNORE);
+   }
+
+   std::istringstream iss(my_part);
+   my_part.clear();
+   my_part.shrink_to_fit();
+   ParMesh pmesh(comm, iss, refine, generate_edges, fix_orientation);
+   return pmesh;
+}
+
 void ParMesh::Finalize(bool refine, bool fix_orientation)
 {
    const int meshgen_save = meshgen; // Mesh::Finalize() may call SetMeshGen()
@@ -386,6 +386,44 @@ public:
        See @a Mesh::MakeSimplicial for more details. */
    static ParMesh MakeSimplicial(ParMesh &orig_mesh);
 
+   /** @brief Load a serial mesh file on rank @a root only, partition it there
+       and send every rank just its own part. */
+   /** Unlike the ParMesh(MPI_Comm, Mesh &, ...) constructor, which requires the
+       full serial Mesh on every rank, only rank @a root reads @a filename and
+       holds the global mesh. The partitioning (see Mesh::GeneratePartitioning
+       for the meaning of @a part_method) and the extraction of the parts are
+       done by a MeshPartitioner on @a root, one part at a time, and each part
+       is sent to its rank in the parallel mesh format of MeshPart::Print. The
+       memory required on the other ranks is therefore proportional to the
+       size of their local part.
+
+       The file is not read or partitioned in parallel: rank @a root still
+       needs the memory and the time of the global mesh, so the size of the
+       meshes that can be loaded is limited by the memory of one node.
+
+       The @a generate_edges, @a refine and @a fix_orientation parameters have
+       the same meaning as in ParMesh(MPI_Comm, std::istream &, ...).
+
+       @note Nonconforming meshes are not supported. */
+   static ParMesh LoadFromRoot(MPI_Comm comm, const char *filename,
+                               int part_method = 1, int root = 0,
+                               int generate_edges = 1, bool refine = true,
+                               bool fix_orientation = true);
+
+   /** @brief Distribute the serial @a mesh, given on rank @a root only, by
+       sending every rank just its own part. */
+   /** This is the second half of LoadFromRoot(): @a mesh is ignored on the
+       other ranks, where it can be NULL. If @a partitioning is NULL, it is
+       generated on @a root with Mesh::GeneratePartitioning() using
+       @a part_method; otherwise, it gives the rank of every element of
+       @a mesh. The local elements are in the same relative order as in
+       @a mesh. */
+   static ParMesh ScatterFromRoot(MPI_Comm comm, Mesh *mesh,
+                                  const int *partitioning = nullptr,
+                                  int part_method = 1, int root = 0,
+                                  int generate_edges = 1, bool refine = true,
+                                  bool fix_orientation = true);
+
    void Finalize(bool refine = false, bool fix_orientation = false) override;
 
    void SetAttributes(bool elem_attrs_changed = true,
@@ -97,6 +97,8 @@ ParNCMesh::~ParNCMesh()
 
 void ParNCMesh::Update()
 {
+   // the leaves also change with the ghost layer and the element ranks
+   root_leaf_offset.DeleteAll();
    NCMesh::Update();
 
    groups.clear();
@@ -0,0 +1,76 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+//
+//    ---------------------------------------------------------------------
+//    Convert Mesh Miniapp:  Convert a mesh to/from the binary MFEM format
+//    ---------------------------------------------------------------------
+//
+// This miniapp reads a mesh in any format supported by MFEM and saves it in
+// the binary MFEM mesh format (see Mesh::PrintBinary), which is loaded with
+// bulk copies instead of being parsed. With -no-b, the mesh is saved in the
+// ASCII MFEM mesh format instead, e.g. to convert a binary mesh back. The time
+// to load the input mesh and the converted mesh is reported.
+//
+// Compile with: make convert-mesh
+//
+// Sample runs:
+//   > convert-mesh -m ../../data/fichera-q3.mesh -o mesh.bin
+//   > convert-mesh -m mesh.bin -o mesh.txt -no-b
+//   > convert-mesh -m ../../data/escher.mesh -r 2
+
+#include "mfem.hpp"
+
+using namespace std;
+using namespace mfem;
+
+int main(int argc, char *argv[])
+{
+   // Parse command-line options.
+   const char *mesh_file = "../../data/star.mesh";
+   const char *out_file = "mesh.bin";
+   int ref_levels = 0;
+   bool binary = true;
+
+   OptionsParser args(argc, argv);
+   args.AddOption(&mesh_file, "-m", "--mesh", "Input mesh file.");
+   args.AddOption(&out_file, "-o", "--output", "Output mesh file.");
+   args.AddOption(&ref_levels, "-r", "--refine",
+                  "Number of uniform refinements of the input mesh.");
+   args.AddOption(&binary, "-b", "--binary", "-no-b", "--no-binary",
+                  "Save the mesh in the binary or the ASCII MFEM format.");
+   args.Parse();
+   if (!args.Good())
+   {
+      args.PrintUsage(mfem::out);
+      return 1;
+   }
+   args.PrintOptions(mfem::out);
+
+   StopWatch sw;
+   sw.Start();
+   Mesh mesh(mesh_file);
+   sw.Stop();
+   mfem::out << "Loaded " << mesh_file << " in " << sw.RealTime() << " s\n";
+
+   for (int l = 0; l < ref_levels; l++) { mesh.UniformRefinement(); }
+   mfem::out << "Number of elements: " << mesh.GetNE() << '\n';
+
+   if (binary) { mesh.SaveBinary(out_file); }
+   else { mesh.Save(out_file); }
+
+   sw.Clear();
+   sw.Start();
+   Mesh out_mesh(out_file);
+   sw.Stop();
+   mfem::out << "Loaded " << out_file << " in " << sw.RealTime() << " s\n";
+
+   return 0;
+}
@@ -21,7 +21,11 @@
 
   See: ceed.exascaleproject.org/bps and github.com/CEED/benchmarks
 
-   * --benchmark_filter=[SetupBP/BP/BK][1-6][PARTIAL/ELEMENT/FULL]/[1-max_order]
+  The BK[1,3,4,5]MIXED kernels use partial assembly with single precision
+  quadrature data, see BilinearForm::EnableMixedPrecisionPA(). Their "RelErr"
+  counter is the relative l2 difference with the action of BK[i]PARTIAL.
+
+   * --benchmark_filter=[SetupBP/BP/BK][1-6][PARTIAL/ELEMENT/FULL/MIXED]/[1-max_order]
    * --benchmark_context=device=[cpu/cuda/hip]
 */
 
@@ -215,6 +219,16 @@ BakeOff_Problem(PARTIAL,5,Diffusion,1,true)
 /// BP6: vector PCG with stiffness matrix, q=p+1
 BakeOff_Problem(PARTIAL,6,VectorDiffusion,3,true)
 
+// NONE:
+/// BP1: scalar PCG with mass matrix, q=p+2
+BakeOff_Problem(NONE,1,Mass,1,false)
+
+/// BP3: scalar PCG with stiffness matrix, q=p+2
+BakeOff_Problem(NONE,3,Diffusion,1,false)
+
+/// BP5: scalar PCG with stiffness matrix, q=p+1
+BakeOff_Problem(NONE,5,Diffusion,1,true)
+
 // ELEMENT:
 /// BP1: scalar PCG with mass matrix, q=p+2
 BakeOff_Problem(ELEMENT,1,Mass,1,false)
@@ -258,21 +272,39 @@ template <typename BFI, int VDIM = 1, bool GLL = false>
 struct Kernel: public BakeOff
 {
    GridFunction y;
+   double rel_err = 0.0;
 
-   Kernel(AssemblyLevel assembly, int order, int N)
+   Kernel(AssemblyLevel assembly, int order, int N, bool mixed = false)
       : BakeOff(assembly,order,N,VDIM,GLL), y(&fes)
    {
       if (is_runnable())
       {
          x.Randomize(1);
          a.SetAssemblyLevel(assembly);
+         a.EnableMixedPrecisionPA(mixed);
          a.AddDomainIntegrator(new BFI(one, GLL?irGLL:ir));
          a.Assemble();
          a.Mult(x, y);
+         if (mixed) { rel_err = mixed_precision_error(); }
          MFEM_DEVICE_SYNC;
       }
    }
 
+   /// Relative l2 difference between y and the action of the form assembled
+   /// with real_t quadrature data
+   double mixed_precision_error()
+   {
+      BilinearForm a_ref(&fes);
+      a_ref.SetAssemblyLevel(assembly);
+      a_ref.AddDomainIntegrator(new BFI(one, GLL?irGLL:ir));
+      a_ref.Assemble();
+      Vector y_ref(y.Size());
+      a_ref.Mult(x, y_ref);
+      const double norm = y_ref.Norml2();
+      y_ref -= y;
+      return y_ref.Norml2() / norm;
+   }
+
    void setup() override
    {
       a.Assemble();
@@ -325,6 +357,50 @@ BakeOff_Kernel(PARTIAL,5,Diffusion,1,true)
 /// BK6PARTIAL: vector E-vector-to-E-vector evaluation of stiffness matrix, q=p+1
 BakeOff_Kernel(PARTIAL,6,VectorDiffusion,3,true)
 
+/// BKi inspired benchmark for the action with mixed precision PA
+#define BakeOff_Kernel_Mixed(i,KER,VDIM,GLL)\
+static void BK##i##MIXED(bm::State &state){\
+   const int dim = 3;\
+   const int p = state.range(1);\
+   const int target_dofs = state.range(0);\
+   const int elem_dofs = pow(p+1, dim);\
+   const int N = pow(target_dofs / elem_dofs, 1.0/dim) + 1;\
+   Kernel<KER##Integrator,VDIM,GLL> ker(AssemblyLevel::PARTIAL, p, N, true);\
+   if ( !ker.is_runnable() ) { state.SkipWithError("MAX_MEM"); }\
+   while (state.KeepRunning()) { ker.benchmark_action(); }\
+   state.counters["MDof/s"] = bm::Counter(ker.SumMdofs(), bm::Counter::kIsRate);\
+   state.counters["Dofs"] = bm::Counter(ker.dofs, bm::Counter::kDefaults);\
+   state.counters["Order"] = bm::Counter(ker.p);\
+   state.counters["RelErr"] = bm::Counter(ker.rel_err);\
+   state.counters["Assembly"] = (int)AssemblyLevel::PARTIAL;}\
+BENCHMARK(BK##i##MIXED)->ArgsProduct({\
+      benchmark::CreateRange(1024, max_dofs, /*step=*/2),\
+      benchmark::CreateDenseRange(1, max_order, /*step=*/1)\
+    })->Unit(bm::kMillisecond);\
+
+// MIXED:
+/// BK1MIXED: scalar E-vector-to-E-vector evaluation of mass matrix, q=p+2
+BakeOff_Kernel_Mixed(1,Mass,1,false)
+
+/// BK3MIXED: scalar E-vector-to-E-vector evaluation of stiffness matrix, q=p+2
+BakeOff_Kernel_Mixed(3,Diffusion,1,false)
+
+/// BK4MIXED: vector E-vector-to-E-vector evaluation of stiffness matrix, q=p+2
+BakeOff_Kernel_Mixed(4,VectorDiffusion,3,false)
+
+/// BK5MIXED: scalar E-vector-to-E-vector evaluation of stiffness matrix, q=p+1
+BakeOff_Kernel_Mixed(5,Diffusion,1,true)
+
+// NONE
+/// BK1NONE: scalar E-vector-to-E-vector evaluation of mass matrix, q=p+2
+BakeOff_Kernel(NONE,1,Mass,1,false)
+
+/// BK3NONE: scalar E-vector-to-E-vector evaluation of stiffness matrix, q=p+2
+BakeOff_Kernel(NONE,3,Diffusion,1,false)
+
+/// BK5NONE: scalar E-vector-to-E-vector evaluation of stiffness matrix, q=p+1
+BakeOff_Kernel(NONE,5,Diffusion,1,true)
+
 // ELEMENT
 /// BK1ELEMENT: scalar E-vector-to-E-vector evaluation of mass matrix, q=p+2
 BakeOff_Kernel(ELEMENT,1,Mass,1,false)
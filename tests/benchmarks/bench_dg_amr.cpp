@@ -160,6 +160,48 @@ BENCHMARK(BK_DG)->ArgsProduct(
    {-1, 0, 1, 10, 30}
 })->Unit(bm::kMillisecond);
 
+/// Cost of one AMR cycle on a nonconforming mesh: the refinement of a few
+/// elements (with Mesh::GeneralRefinement() and nc_limit = 1), followed by the
+/// update of a DG space and of a GridFunction on it. The mesh is restored from
+/// a copy, outside of the timed region, before each cycle.
+///   * --benchmark_filter=AMR_Cycle/[N]/[number of refined elements]
+static void AMR_Cycle(bm::State &state)
+{
+   const int N = state.range(0);
+   const int nref = state.range(1);
+   const int p = 1;
+
+   KernelMesh ker(N, 0.1);
+   DG_FECollection fec(p, 3);
+   const int ne = ker.mesh.GetNE();
+
+   srand(0);
+   Array<int> elems(nref);
+   for (auto _ : state)
+   {
+      state.PauseTiming();
+      Mesh mesh(ker.mesh);
+      FiniteElementSpace fes(&mesh, &fec);
+      GridFunction x(&fes);
+      x = 1.0;
+      for (int i = 0; i < nref; i++) { elems[i] = rand() % ne; }
+      state.ResumeTiming();
+
+      mesh.GeneralRefinement(elems, 1, 1);
+      fes.Update();
+      x.Update();
+   }
+   state.counters["NE"] = bm::Counter(ne, bm::Counter::kDefaults);
+   state.counters["Cycles/s"] =
+      bm::Counter(state.iterations(), bm::Counter::kIsRate);
+}
+
+BENCHMARK(AMR_Cycle)->ArgsProduct(
+{
+   {8, 16, 32},
+   {1, 16, 256}
+})->Unit(bm::kMillisecond);
+
 int main(int argc, char *argv[])
 {
    bm::ConsoleReporter CR;
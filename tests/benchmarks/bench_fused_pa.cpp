@@ -0,0 +1,125 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+// Action of M + dt K on the E-vectors of a Cartesian mesh, with the separate
+// MassIntegrator and DiffusionIntegrator PA kernels, or with the fused kernel
+// of FusedMassDiffusionPA. The results are used to choose where the fusion is
+// enabled, see FusedMassDiffusionPA::IsFaster().
+
+struct FusedPAProblem
+{
+   Mesh mesh;
+   H1_FECollection fec;
+   FiniteElementSpace fes;
+   ConstantCoefficient one, dt;
+   BilinearForm a;
+   MassIntegrator *mass;
+   DiffusionIntegrator *diff;
+   FusedMassDiffusionPA fused;
+   Vector x, y;
+
+   FusedPAProblem(int dim, int order, int n):
+      mesh(dim == 2 ? Mesh::MakeCartesian2D(n, n, Element::QUADRILATERAL) :
+           Mesh::MakeCartesian3D(n, n, n, Element::HEXAHEDRON)),
+      fec(order, dim), fes(&mesh, &fec), one(1.0), dt(0.1), a(&fes),
+      mass(new MassIntegrator(one)), diff(new DiffusionIntegrator(dt))
+   {
+      a.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      a.AddDomainIntegrator(mass);
+      a.AddDomainIntegrator(diff);
+      a.Assemble();
+      MFEM_VERIFY(fused.Setup(*mass, *diff), "the integrators cannot be fused");
+      const int esize = fes.GetNE()*fes.GetTypicalFE()->GetDof();
+      x.SetSize(esize);
+      y.SetSize(esize);
+      x.UseDevice(true);
+      y.UseDevice(true);
+      x.Randomize(1);
+      y = 0.0;
+   }
+
+   void Separate()
+   {
+      mass->AddMultPA(x, y);
+      diff->AddMultPA(x, y);
+   }
+
+   // The fused kernel is timed even where IsFaster() is false
+   void Fused() { fused.AddMult(x, y); }
+};
+
+// The meshes have about 1M (2D) and 250K (3D) quadrature points.
+static int MeshSize(int dim, int order)
+{
+   return (dim == 2) ? 1000/(order + 2) : 63/(order + 3);
+}
+
+static void MassDiffusion(bm::State &state, int dim, bool fused)
+{
+   const int order = state.range(0);
+   FusedPAProblem prob(dim, order, MeshSize(dim, order));
+
+   for (auto _ : state)
+   {
+      if (fused) { prob.Fused(); }
+      else { prob.Separate(); }
+      MFEM_DEVICE_SYNC;
+   }
+
+   const int ndofs = prob.fes.GetVSize();
+   state.counters["Dofs"] = ndofs;
+   state.counters["MDof/s"] =
+      bm::Counter(1e-6*ndofs, bm::Counter::kIsIterationInvariantRate);
+}
+
+#define MFEM_FUSED_BENCHMARK(name, dim, fused)                             \
+static void name(bm::State &state) { MassDiffusion(state, dim, fused); }  \
+BENCHMARK(name)->DenseRange(1, 6)->Unit(bm::kMillisecond);
+
+MFEM_FUSED_BENCHMARK(Separate2D, 2, false)
+MFEM_FUSED_BENCHMARK(Fused2D, 2, true)
+MFEM_FUSED_BENCHMARK(Separate3D, 3, false)
+MFEM_FUSED_BENCHMARK(Fused3D, 3, true)
+
+/**
+ * --benchmark_filter=3D
+ * --benchmark_context=device=cpu
+ */
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+
+   // Device setup, cpu by default
+   std::string device_config = "cpu";
+   auto global_context = bmi::GetGlobalContext();
+   if (global_context != nullptr)
+   {
+      const auto device = global_context->find("device");
+      if (device != global_context->end())
+      {
+         mfem::out << device->first << " : " << device->second << std::endl;
+         device_config = device->second;
+      }
+   }
+   Device device(device_config.c_str());
+   device.Print();
+
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
@@ -0,0 +1,122 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+#include <sstream>
+
+// Throughput of the Gmsh reader, Mesh::ReadGmshMesh(), in elements per second.
+// The input is a Gmsh v2.2 file, in ASCII or binary format, of a Cartesian
+// mesh of n x n x n hexahedra, generated in memory. With legacy OpenMP
+// enabled, the nodes and the elements of the file are decoded in parallel.
+
+// Write 'mesh' in the Gmsh v2.2 format. Linear hexahedra and quadrilaterals
+// have the same vertex ordering in Gmsh and MFEM.
+static std::string PrintGmsh(Mesh &mesh, bool binary)
+{
+   std::ostringstream os;
+   os.precision(16);
+   os << "$MeshFormat\n2.2 " << binary << " " << sizeof(double) << "\n";
+   if (binary) { bin_io::write<int>(os, 1); os << "\n"; }
+   os << "$EndMeshFormat\n";
+
+   os << "$Nodes\n" << mesh.GetNV() << "\n";
+   for (int i = 0; i < mesh.GetNV(); i++)
+   {
+      const real_t *v = mesh.GetVertex(i);
+      if (binary)
+      {
+         bin_io::write<int>(os, i + 1);
+         for (int d = 0; d < 3; d++) { bin_io::write<double>(os, v[d]); }
+      }
+      else { os << i + 1 << " " << v[0] << " " << v[1] << " " << v[2] << "\n"; }
+   }
+   if (binary) { os << "\n"; }
+   os << "$EndNodes\n";
+
+   const int nbe = mesh.GetNBE(), ne = mesh.GetNE();
+   os << "$Elements\n" << nbe + ne << "\n";
+   Array<int> v;
+   auto print = [&](int type, int n, int first, bool bdr)
+   {
+      if (binary)
+      {
+         bin_io::write<int>(os, type);
+         bin_io::write<int>(os, n);
+         bin_io::write<int>(os, 2);
+      }
+      for (int i = 0; i < n; i++)
+      {
+         const int attr = bdr ? mesh.GetBdrAttribute(i) : mesh.GetAttribute(i);
+         if (bdr) { mesh.GetBdrElementVertices(i, v); }
+         else { mesh.GetElementVertices(i, v); }
+         if (binary)
+         {
+            bin_io::write<int>(os, first + i + 1);
+            bin_io::write<int>(os, attr);
+            bin_io::write<int>(os, attr);
+            for (int j : v) { bin_io::write<int>(os, j + 1); }
+         }
+         else
+         {
+            os << first + i + 1 << " " << type << " 2 " << attr << " " << attr;
+            for (int j : v) { os << " " << j + 1; }
+            os << "\n";
+         }
+      }
+   };
+   print(3, nbe, 0, true);
+   print(5, ne, nbe, false);
+   if (binary) { os << "\n"; }
+   os << "$EndElements\n";
+   return os.str();
+}
+
+static void Gmsh(bm::State &state, bool binary)
+{
+   const int n = state.range(0);
+   Mesh cart = Mesh::MakeCartesian3D(n, n, n, Element::HEXAHEDRON);
+   const std::string gmsh = PrintGmsh(cart, binary);
+
+   for (auto _ : state)
+   {
+      std::istringstream is(gmsh);
+      Mesh mesh(is);
+      MFEM_VERIFY(mesh.GetNE() == cart.GetNE(), "invalid mesh");
+   }
+
+   state.counters["NE"] = cart.GetNE();
+   state.counters["MB"] = gmsh.size()/1e6;
+   state.counters["Elem/s"] =
+      bm::Counter(cart.GetNE(), bm::Counter::kIsIterationInvariantRate);
+}
+
+static void Gmsh_ASCII(bm::State &state) { Gmsh(state, false); }
+BENCHMARK(Gmsh_ASCII)->RangeMultiplier(2)->Range(8, 64)
+->Unit(bm::kMillisecond);
+
+static void Gmsh_Binary(bm::State &state) { Gmsh(state, true); }
+BENCHMARK(Gmsh_Binary)->RangeMultiplier(2)->Range(8, 64)
+->Unit(bm::kMillisecond);
+
+// --benchmark_filter=Gmsh_ASCII
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
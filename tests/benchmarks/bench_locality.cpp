@@ -0,0 +1,100 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+#include <random>
+
+// Effect of the element ordering on the throughput of the sparse matrix-vector
+// product and of the partially assembled operator of the H1 diffusion form.
+// The elements of a Cartesian mesh of n x n x n hexahedra are first shuffled,
+// emulating a mesh generator without locality, and then optionally reordered
+// with Mesh::ReorderElementsForLocality(). The bandwidth and the profile of the
+// assembled matrix are reported as counters.
+
+enum class ElemOrdering { Shuffled, Hilbert, Gecko };
+
+struct LocalityProblem
+{
+   Mesh mesh;
+   H1_FECollection fec;
+   FiniteElementSpace fes;
+   BilinearForm a;
+   Vector x, y;
+
+   LocalityProblem(int n, int order, ElemOrdering ordering, bool pa):
+      mesh(MakeMesh(n, ordering)), fec(order, 3), fes(&mesh, &fec), a(&fes),
+      x(fes.GetVSize()), y(fes.GetVSize())
+   {
+      if (pa) { a.SetAssemblyLevel(AssemblyLevel::PARTIAL); }
+      a.AddDomainIntegrator(new DiffusionIntegrator);
+      a.Assemble();
+      if (!pa) { a.Finalize(); }
+      x.Randomize(1);
+   }
+
+   static Mesh MakeMesh(int n, ElemOrdering ordering)
+   {
+      Mesh mesh = Mesh::MakeCartesian3D(n, n, n, Element::HEXAHEDRON);
+      Array<int> perm(mesh.GetNE());
+      for (int i = 0; i < perm.Size(); i++) { perm[i] = i; }
+      std::mt19937 gen(1);
+      std::shuffle(perm.begin(), perm.end(), gen);
+      mesh.ReorderElements(perm);
+      if (ordering == ElemOrdering::Hilbert) { mesh.ReorderElementsForLocality(1); }
+      if (ordering == ElemOrdering::Gecko) { mesh.ReorderElementsForLocality(2); }
+      return mesh;
+   }
+};
+
+static void Locality(bm::State &state, ElemOrdering ordering, bool pa)
+{
+   const int order = state.range(0);
+   const int n = state.range(1);
+   LocalityProblem prob(n, order, ordering, pa);
+
+   for (auto _ : state) { prob.a.Mult(prob.x, prob.y); }
+
+   const int ndofs = prob.fes.GetVSize();
+   state.counters["Dofs"] = ndofs;
+   if (!pa)
+   {
+      state.counters["bandwidth"] = prob.a.SpMat().Bandwidth();
+      state.counters["profile"] = prob.a.SpMat().Profile();
+   }
+   state.counters["MDof/s"] =
+      bm::Counter(1e-6*ndofs, bm::Counter::kIsIterationInvariantRate);
+}
+
+#define MFEM_LOCALITY_BENCHMARK(name, ordering, pa)                      \
+static void name(bm::State &state) { Locality(state, ordering, pa); }   \
+BENCHMARK(name)->ArgsProduct({{1, 2, 3}, {16, 24}})->Unit(bm::kMillisecond);
+
+MFEM_LOCALITY_BENCHMARK(SpMV_Shuffled, ElemOrdering::Shuffled, false)
+MFEM_LOCALITY_BENCHMARK(SpMV_Hilbert, ElemOrdering::Hilbert, false)
+MFEM_LOCALITY_BENCHMARK(SpMV_Gecko, ElemOrdering::Gecko, false)
+MFEM_LOCALITY_BENCHMARK(PA_Shuffled, ElemOrdering::Shuffled, true)
+MFEM_LOCALITY_BENCHMARK(PA_Hilbert, ElemOrdering::Hilbert, true)
+MFEM_LOCALITY_BENCHMARK(PA_Gecko, ElemOrdering::Gecko, true)
+
+// --benchmark_filter=SpMV
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
@@ -0,0 +1,106 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+// Overhead per call of the Read()/Write() accessors of Vector, i.e. of the
+// MemoryManager bookkeeping, for unregistered (MemoryType::HOST), registered
+// (MemoryType::HOST_64) and alias memory. The vectors are small, so that the
+// time is dominated by the pointer lookups. Each thread uses its own vectors:
+// the multithreaded runs measure the contention in the MemoryManager registry.
+
+constexpr int N = 16;
+
+#define MFEM_MEM_BENCHMARK(x) \
+   BENCHMARK(x)->Threads(1)->Threads(2)->Threads(4)->UseRealTime();
+
+static void Read_Host(bm::State &state)
+{
+   Vector x(N, MemoryType::HOST);
+   x.UseDevice(true);
+   for (auto _ : state) { bm::DoNotOptimize(x.Read()); }
+}
+MFEM_MEM_BENCHMARK(Read_Host);
+
+static void Read_Registered(bm::State &state)
+{
+   Vector x(N, MemoryType::HOST_64);
+   x.UseDevice(true);
+   for (auto _ : state) { bm::DoNotOptimize(x.Read()); }
+}
+MFEM_MEM_BENCHMARK(Read_Registered);
+
+static void Write_Registered(bm::State &state)
+{
+   Vector x(N, MemoryType::HOST_64);
+   x.UseDevice(true);
+   for (auto _ : state) { bm::DoNotOptimize(x.Write()); }
+}
+MFEM_MEM_BENCHMARK(Write_Registered);
+
+static void ReadWrite_Registered(bm::State &state)
+{
+   Vector x(N, MemoryType::HOST_64);
+   x.UseDevice(true);
+   for (auto _ : state) { bm::DoNotOptimize(x.ReadWrite()); }
+}
+MFEM_MEM_BENCHMARK(ReadWrite_Registered);
+
+static void Read_Alias(bm::State &state)
+{
+   Vector x(2*N, MemoryType::HOST_64), y;
+   x.UseDevice(true);
+   y.MakeRef(x, N, N);
+   y.UseDevice(true);
+   for (auto _ : state) { bm::DoNotOptimize(y.Read()); }
+}
+MFEM_MEM_BENCHMARK(Read_Alias);
+
+// Registration and removal of a pointer in the registry
+static void New_Delete_Registered(bm::State &state)
+{
+   for (auto _ : state)
+   {
+      Vector x(N, MemoryType::HOST_64);
+      bm::DoNotOptimize(x.GetData());
+   }
+}
+MFEM_MEM_BENCHMARK(New_Delete_Registered);
+
+// --benchmark_filter=Read
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+
+   // Device setup, cpu by default
+   std::string device_config = "cpu";
+   auto global_context = bmi::GetGlobalContext();
+   if (global_context != nullptr)
+   {
+      const auto device = global_context->find("device");
+      if (device != global_context->end())
+      {
+         mfem::out << device->first << " : " << device->second << std::endl;
+         device_config = device->second;
+      }
+   }
+   Device device(device_config.c_str());
+   device.Print();
+
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
@@ -0,0 +1,102 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+// Quality and cost of the partitionings of Mesh::GeneratePartitioning(): the
+// built-in Hilbert curve partitioner (part_method = 6) and, when available,
+// METIS (part_method = 1). The edge cut (number of faces between parts) and the
+// imbalance (largest part size over the average) are reported as counters.
+//
+// The meshes are read from the directory given by the context variable 'data',
+// e.g. --benchmark_context=data=../../data (the default), and are refined
+// uniformly to at least 'min_ne' elements (default 10000).
+
+static const char *mesh_files[] =
+{
+   "star.mesh", "square-disc.mesh", "inline-quad.mesh", "fichera.mesh",
+   "beam-hex.mesh", "escher.mesh", "inline-tet.mesh"
+};
+
+static void Partition(bm::State &state, const std::string &mesh_file,
+                      int min_ne, int part_method)
+{
+   const int nparts = state.range(0);
+   Mesh mesh = Mesh::LoadFromFile(mesh_file.c_str());
+   while (mesh.GetNE() < min_ne) { mesh.UniformRefinement(); }
+   const int ne = mesh.GetNE();
+
+   int *partitioning = nullptr;
+   for (auto _ : state)
+   {
+      delete [] partitioning;
+      partitioning = mesh.GeneratePartitioning(nparts, part_method);
+   }
+
+   const Table &el_el = mesh.ElementToElementTable();
+   Array<int> psize(nparts);
+   psize = 0;
+   int edgecut = 0;
+   for (int i = 0; i < ne; i++)
+   {
+      psize[partitioning[i]]++;
+      for (int k = el_el.GetI()[i]; k < el_el.GetI()[i+1]; k++)
+      {
+         if (partitioning[i] != partitioning[el_el.GetJ()[k]]) { edgecut++; }
+      }
+   }
+   delete [] partitioning;
+
+   state.counters["NE"] = ne;
+   state.counters["edgecut"] = edgecut/2;
+   state.counters["imbalance"] = psize.Max()*real_t(nparts)/ne;
+}
+
+// --benchmark_filter=Partition/hilbert
+// --benchmark_context=data=../../data,min_ne=100000
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+
+   std::string data_dir = "../../data";
+   int min_ne = 10000;
+   auto global_context = bmi::GetGlobalContext();
+   if (global_context != nullptr)
+   {
+      const auto data = global_context->find("data");
+      if (data != global_context->end()) { data_dir = data->second; }
+      const auto ne = global_context->find("min_ne");
+      if (ne != global_context->end()) { min_ne = std::stoi(ne->second); }
+   }
+
+   for (const char *mesh_file : mesh_files)
+   {
+      const std::string file = data_dir + "/" + mesh_file;
+      const std::string name = std::string("Partition/") + mesh_file;
+      bm::RegisterBenchmark((name + "/hilbert").c_str(), Partition,
+                            file, min_ne, 6)
+      ->Arg(4)->Arg(16)->Arg(64)->Unit(bm::kMillisecond);
+#ifdef MFEM_USE_METIS
+      bm::RegisterBenchmark((name + "/metis").c_str(), Partition,
+                            file, min_ne, 1)
+      ->Arg(4)->Arg(16)->Arg(64)->Unit(bm::kMillisecond);
+#endif
+   }
+
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
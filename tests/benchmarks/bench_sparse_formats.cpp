@@ -0,0 +1,106 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+// Throughput of the sparse matrix-vector product with the CSR SparseMatrix,
+// the SELL-C-sigma SlicedEllpackMatrix and the BlockCSRMatrix. The matrices
+// are assembled on a Cartesian mesh of n x n x n hexahedra: a scalar H1
+// diffusion matrix for the sliced ELLPACK format, and an H1 elasticity matrix
+// with Ordering::byVDIM (3x3 blocks) for the block format. The number of
+// stored entries, including the padding, is reported as a counter.
+
+enum class SpFormat { CSR, SELL, BCSR };
+
+struct SparseFormatProblem
+{
+   Mesh mesh;
+   H1_FECollection fec;
+   FiniteElementSpace fes;
+   ConstantCoefficient one;
+   BilinearForm a;
+   std::unique_ptr<Operator> op;
+   Vector x, y;
+   int stored;
+
+   SparseFormatProblem(int n, int order, SpFormat format, bool vector):
+      mesh(Mesh::MakeCartesian3D(n, n, n, Element::HEXAHEDRON)),
+      fec(order, 3), fes(&mesh, &fec, vector ? 3 : 1, Ordering::byVDIM),
+      one(1.0), a(&fes), x(fes.GetVSize()), y(fes.GetVSize())
+   {
+      if (vector)
+      {
+         a.AddDomainIntegrator(new ElasticityIntegrator(one, one));
+      }
+      else
+      {
+         a.AddDomainIntegrator(new DiffusionIntegrator);
+      }
+      a.Assemble();
+      a.Finalize();
+      SparseMatrix &A = a.SpMat();
+      stored = A.NumNonZeroElems();
+      if (format == SpFormat::SELL)
+      {
+         auto sell = new SlicedEllpackMatrix(A);
+         stored = sell->NumStoredEntries();
+         op.reset(sell);
+      }
+      else if (format == SpFormat::BCSR)
+      {
+         auto bcsr = new BlockCSRMatrix(A, 3);
+         stored = 9*bcsr->NumBlocks();
+         op.reset(bcsr);
+      }
+      x.Randomize(1);
+   }
+
+   void Mult() { (op ? *op : a.SpMat()).Mult(x, y); }
+};
+
+static void SpMV(bm::State &state, SpFormat format, bool vector)
+{
+   const int order = state.range(0);
+   const int n = state.range(1);
+   SparseFormatProblem prob(n, order, format, vector);
+
+   for (auto _ : state) { prob.Mult(); }
+
+   const int ndofs = prob.fes.GetVSize();
+   state.counters["Dofs"] = ndofs;
+   state.counters["Stored"] = prob.stored;
+   state.counters["MDof/s"] =
+      bm::Counter(1e-6*ndofs, bm::Counter::kIsIterationInvariantRate);
+}
+
+#define MFEM_SPMV_BENCHMARK(name, format, vector)                      \
+static void name(bm::State &state) { SpMV(state, format, vector); }   \
+BENCHMARK(name)->ArgsProduct({{1, 2, 3}, {12, 20}})->Unit(bm::kMillisecond);
+
+MFEM_SPMV_BENCHMARK(Scalar_CSR, SpFormat::CSR, false)
+MFEM_SPMV_BENCHMARK(Scalar_SELL, SpFormat::SELL, false)
+MFEM_SPMV_BENCHMARK(Vector_CSR, SpFormat::CSR, true)
+MFEM_SPMV_BENCHMARK(Vector_SELL, SpFormat::SELL, true)
+MFEM_SPMV_BENCHMARK(Vector_BCSR, SpFormat::BCSR, true)
+
+// --benchmark_filter=Vector
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
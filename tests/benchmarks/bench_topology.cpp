@@ -0,0 +1,56 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "bench.hpp"
+
+#ifdef MFEM_USE_BENCHMARK
+
+// Cost of Mesh::FinalizeTopology(), i.e. of the generation of the edges and the
+// faces of the mesh, with the default DSTable/STable3D algorithm and with the
+// sort-based one selected by Mesh::sorted_topology. The meshes are Cartesian
+// meshes of n x n x n hexahedra or 6 n x n x n tetrahedra.
+
+static void Topology(bm::State &state, Element::Type type, bool sorted)
+{
+   const int n = state.range(0);
+   Mesh mesh = Mesh::MakeCartesian3D(n, n, n, type);
+
+   const bool sorted_topology = Mesh::sorted_topology;
+   Mesh::sorted_topology = sorted;
+   for (auto _ : state) { mesh.FinalizeTopology(); }
+   Mesh::sorted_topology = sorted_topology;
+
+   state.counters["NE"] = mesh.GetNE();
+   state.counters["NF"] = mesh.GetNumFaces();
+   state.counters["Elem/s"] =
+      bm::Counter(mesh.GetNE(), bm::Counter::kIsIterationInvariantRate);
+}
+
+#define MFEM_TOPOLOGY_BENCHMARK(name, type, sorted)                       \
+static void name(bm::State &state) { Topology(state, type, sorted); }    \
+BENCHMARK(name)->RangeMultiplier(2)->Range(8, 64)->Unit(bm::kMillisecond);
+
+MFEM_TOPOLOGY_BENCHMARK(Hex_Tables, Element::HEXAHEDRON, false)
+MFEM_TOPOLOGY_BENCHMARK(Hex_Sorted, Element::HEXAHEDRON, true)
+MFEM_TOPOLOGY_BENCHMARK(Tet_Tables, Element::TETRAHEDRON, false)
+MFEM_TOPOLOGY_BENCHMARK(Tet_Sorted, Element::TETRAHEDRON, true)
+
+// --benchmark_filter=Tet
+int main(int argc, char *argv[])
+{
+   bm::ConsoleReporter CR;
+   bm::Initialize(&argc, argv);
+   if (bm::ReportUnrecognizedArguments(argc, argv)) { return 1; }
+   bm::RunSpecifiedBenchmarks(&CR);
+   return 0;
+}
+
+#endif // MFEM_USE_BENCHMARK
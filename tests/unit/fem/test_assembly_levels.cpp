@@ -446,6 +446,112 @@ TEST_CASE("L2 Assembly Levels", "[AssemblyLevel], [PartialAssembly], [GPU]")
    }
 } // L2 Assembly Levels test case
 
+// Compare the matrix-free action and diagonal of the mass and diffusion
+// integrators without libCEED with the partially assembled ones. The meshes are
+// refined so that the elements are processed in several blocks.
+void test_matrix_free(const char *meshname, int ref_levels, int order, bool dg,
+                      const Problem pb)
+{
+   INFO("mesh=" << meshname << ", order=" << order << ", DG=" << dg
+        << ", pb=" << getString(pb));
+   Mesh mesh(meshname, 1, 1);
+   for (int l = 0; l < ref_levels; l++) { mesh.UniformRefinement(); }
+   const int dim = mesh.Dimension();
+
+   std::unique_ptr<FiniteElementCollection> fec;
+   if (dg)
+   {
+      fec.reset(new L2_FECollection(order, dim, BasisType::GaussLobatto));
+   }
+   else
+   {
+      fec.reset(new H1_FECollection(order, dim));
+   }
+   FiniteElementSpace fespace(&mesh, fec.get());
+
+   FunctionCoefficient coeff([](const Vector &x) { return 2.0 + x(0)*x(1); });
+   DenseMatrix mat(dim);
+   mat = 0.1;
+   for (int d = 0; d < dim; d++) { mat(d,d) = 1.0 + d; }
+   MatrixConstantCoefficient mat_coeff(mat);
+   // non-constant coefficients are evaluated for each block of elements
+   VectorFunctionCoefficient vec_coeff(dim, [](const Vector &x, Vector &v)
+   {
+      for (int d = 0; d < x.Size(); d++) { v(d) = 1.0 + x(d); }
+   });
+   MatrixFunctionCoefficient mat_fn_coeff(dim, [](const Vector &x,
+                                                  DenseMatrix &m)
+   {
+      m = 0.1*x(0);
+      for (int d = 0; d < x.Size(); d++) { m(d,d) = 1.0 + x(d); }
+      m(0,1) = 0.2;
+   });
+   SymmetricMatrixFunctionCoefficient sym_coeff(dim, [](const Vector &x,
+                                                        DenseSymmetricMatrix &m)
+   {
+      m = 0.1*x(0);
+      for (int d = 0; d < x.Size(); d++) { m(d,d) = 1.0 + x(d); }
+   });
+
+   BilinearForm k_mf(&fespace), k_pa(&fespace);
+   for (BilinearForm *k : {&k_mf, &k_pa})
+   {
+      if (pb == Problem::Mass)
+      {
+         k->AddDomainIntegrator(new MassIntegrator(coeff));
+      }
+      else
+      {
+         k->AddDomainIntegrator(new DiffusionIntegrator(coeff));
+         k->AddDomainIntegrator(new DiffusionIntegrator(mat_coeff));
+         k->AddDomainIntegrator(new DiffusionIntegrator(vec_coeff));
+         k->AddDomainIntegrator(new DiffusionIntegrator(mat_fn_coeff));
+         k->AddDomainIntegrator(new DiffusionIntegrator(sym_coeff));
+      }
+   }
+   k_mf.SetAssemblyLevel(AssemblyLevel::NONE);
+   k_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   k_mf.Assemble();
+   k_pa.Assemble();
+
+   GridFunction x(&fespace), y_mf(&fespace), y_pa(&fespace);
+   x.Randomize(1);
+
+   k_mf.Mult(x, y_mf);
+   k_pa.Mult(x, y_pa);
+   y_mf -= y_pa;
+   REQUIRE(y_mf.Normlinf() == MFEM_Approx(0.0, 1e-12));
+
+   k_mf.AssembleDiagonal(y_mf);
+   k_pa.AssembleDiagonal(y_pa);
+   y_mf -= y_pa;
+   REQUIRE(y_mf.Normlinf() == MFEM_Approx(0.0, 1e-12));
+}
+
+TEST_CASE("Native Matrix-Free Assembly", "[AssemblyLevel], [GPU]")
+{
+   // libCEED provides its own matrix-free integrators
+   if (DeviceCanUseCeed()) { return; }
+
+   auto pb = GENERATE(Problem::Mass, Problem::Diffusion);
+   auto dg = GENERATE(false, true);
+
+   SECTION("2D")
+   {
+      auto order = GENERATE(1, 3);
+      test_matrix_free("../../data/star-q3.mesh", 2, order, dg, pb);
+      test_matrix_free("../../data/periodic-square.mesh", 2, order, dg, pb);
+      test_matrix_free("../../data/amr-quad.mesh", 1, order, dg, pb);
+   }
+
+   SECTION("3D")
+   {
+      auto order = GENERATE(1, 2);
+      test_matrix_free("../../data/fichera-q3.mesh", 1, order, dg, pb);
+      test_matrix_free("../../data/periodic-cube.mesh", 0, order, dg, pb);
+   }
+} // Native Matrix-Free Assembly test case
+
 #ifndef MFEM_USE_MPI
 #define HYPRE_BigInt int
 #endif // MFEM_USE_MPI
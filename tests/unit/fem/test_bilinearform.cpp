@@ -13,6 +13,9 @@
 #include "unit_tests.hpp"
 
 #include <iostream>
+#ifdef MFEM_USE_LEGACY_OPENMP
+#include <omp.h>
+#endif
 
 using namespace mfem;
 
@@ -184,3 +187,232 @@ TEST_CASE("BilinearForm print", "[SparseMatrix][BilinearForm]")
    a.Print(ss);
    REQUIRE(ss.str().length() > 0);
 }
+
+TEST_CASE("BilinearForm precomputed sparsity", "[SparseMatrix][BilinearForm]")
+{
+   Mesh mesh = Mesh::MakeCartesian2D(3, 2, Element::QUADRILATERAL);
+   const int dim = mesh.Dimension();
+
+   auto check = [](FiniteElementSpace &fes, auto add_integrators)
+   {
+      BilinearForm a_lil(&fes);
+      add_integrators(a_lil);
+      a_lil.Assemble(0);
+      a_lil.Finalize(0);
+
+      BilinearForm a_csr(&fes);
+      a_csr.UsePrecomputedSparsity();
+      add_integrators(a_csr);
+      for (int cycle = 0; cycle < 2; cycle++)
+      {
+         // The second cycle re-uses the cached sparsity pattern
+         a_csr.Update();
+         a_csr.Assemble(0);
+         a_csr.Finalize(0);
+
+         const SparseMatrix &A_lil = a_lil.SpMat();
+         const SparseMatrix &A_csr = a_csr.SpMat();
+         REQUIRE(A_csr.NumNonZeroElems() ==
+                 fes.GetVDofToVDofTable(a_csr.GetFBFI()->Size() > 0)
+                 .Size_of_connections());
+         SparseMatrix *D = Add(1.0, A_lil, -1.0, A_csr);
+         REQUIRE(D->MaxNorm() == MFEM_Approx(0.0));
+         delete D;
+      }
+   };
+
+   SECTION("H1 vector")
+   {
+      H1_FECollection fec(2, dim);
+      FiniteElementSpace fes(&mesh, &fec, dim, Ordering::byVDIM);
+      ConstantCoefficient one(1.0);
+      check(fes, [&one](BilinearForm &a)
+      {
+         a.AddDomainIntegrator(new ElasticityIntegrator(one, one));
+         a.AddBoundaryIntegrator(new VectorMassIntegrator);
+      });
+   }
+
+   SECTION("ND")
+   {
+      ND_FECollection fec(2, dim);
+      FiniteElementSpace fes(&mesh, &fec);
+      check(fes, [](BilinearForm &a)
+      {
+         a.AddDomainIntegrator(new CurlCurlIntegrator);
+         a.AddDomainIntegrator(new VectorFEMassIntegrator);
+      });
+   }
+
+   SECTION("DG")
+   {
+      DG_FECollection fec(1, dim);
+      FiniteElementSpace fes(&mesh, &fec);
+      check(fes, [](BilinearForm &a)
+      {
+         a.AddDomainIntegrator(new DiffusionIntegrator);
+         a.AddInteriorFaceIntegrator(new DGDiffusionIntegrator(-1.0, 2.0));
+         a.AddBdrFaceIntegrator(new DGDiffusionIntegrator(-1.0, 2.0));
+      });
+   }
+}
+
+// Expose the colored assembly of BilinearForm and NonlinearForm, which is only
+// used by Assemble() and GetGradient() with MFEM_USE_LEGACY_OPENMP
+class ColoredBilinearForm : public BilinearForm
+{
+public:
+   using BilinearForm::BilinearForm;
+   using BilinearForm::AddElementMatricesColored;
+};
+
+class ColoredNonlinearForm : public NonlinearForm
+{
+public:
+   using NonlinearForm::NonlinearForm;
+
+   /// Re-assemble the gradient at @a x, computed before, with the colored path
+   SparseMatrix &AssembleGradColored(const Vector &x)
+   {
+      Array<int> attr_marker(fes->GetMesh()->attributes.Max());
+      attr_marker = 1;
+      *Grad = 0.0;
+      AddDomainGradColored(x, attr_marker, 0);
+      return *Grad;
+   }
+};
+
+TEST_CASE("BilinearForm colored assembly", "[SparseMatrix][BilinearForm]")
+{
+   Mesh mesh = Mesh::MakeCartesian3D(3, 2, 2, Element::HEXAHEDRON);
+   const int dim = mesh.Dimension();
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim);
+
+   // Elements with the same color must not share any dofs
+   const Table &colors = fes.GetElementColoring();
+   Array<int> dof_marker(fes.GetNDofs()), dofs;
+   Array<int> elem_marker(mesh.GetNE());
+   elem_marker = 0;
+   for (int c = 0; c < colors.Size(); c++)
+   {
+      dof_marker = 0;
+      for (int k = 0; k < colors.RowSize(c); k++)
+      {
+         const int e = colors.GetRow(c)[k];
+         elem_marker[e]++;
+         fes.GetElementDofs(e, dofs);
+         for (int dof : dofs)
+         {
+            REQUIRE(dof_marker[dof] == 0);
+            dof_marker[dof] = 1;
+         }
+      }
+   }
+   for (int e = 0; e < mesh.GetNE(); e++) { REQUIRE(elem_marker[e] == 1); }
+
+   // Re-adding the element matrices into the finalized matrix color by color
+   // reproduces the standard assembly
+   ConstantCoefficient one(1.0);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new ElasticityIntegrator(one, one));
+   a.Assemble(0);
+   a.Finalize(0);
+
+   ColoredBilinearForm a_colored(&fes);
+   a_colored.UsePrecomputedSparsity();
+   a_colored.AddDomainIntegrator(new ElasticityIntegrator(one, one));
+   a_colored.ComputeElementMatrices();
+   a_colored.Assemble(0);
+   a_colored.Finalize(0);
+   SparseMatrix &A_colored = a_colored.SpMat();
+   A_colored = 0.0;
+   a_colored.AddElementMatricesColored(0);
+
+   SparseMatrix *D = Add(1.0, a.SpMat(), -1.0, A_colored);
+   REQUIRE(D->MaxNorm() == MFEM_Approx(0.0));
+   delete D;
+}
+
+TEST_CASE("NonlinearForm colored gradient", "[SparseMatrix][NonlinearForm]")
+{
+   Mesh mesh = Mesh::MakeCartesian3D(3, 2, 2, Element::HEXAHEDRON);
+   const int dim = mesh.Dimension();
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim);
+
+   NeoHookeanModel model(1.0, 5.0);
+   ColoredNonlinearForm n(&fes);
+   n.AddDomainIntegrator(new HyperelasticNLFIntegrator(&model));
+
+   GridFunction x(&fes);
+   VectorFunctionCoefficient deform(dim, [](const Vector &p, Vector &y)
+   {
+      y = p;
+      y(0) += 0.1*p(1)*p(2);
+      y(1) += 0.05*p(0)*p(0);
+   });
+   x.ProjectCoefficient(deform);
+
+   // Re-adding the element gradients into the finalized gradient color by
+   // color reproduces the standard assembly
+   SparseMatrix grad(dynamic_cast<SparseMatrix&>(n.GetGradient(x)));
+   SparseMatrix *D = Add(1.0, grad, -1.0, n.AssembleGradColored(x));
+   REQUIRE(D->MaxNorm() == MFEM_Approx(0.0));
+   delete D;
+}
+
+TEST_CASE("NonlinearForm threaded gradient", "[SparseMatrix][NonlinearForm]")
+{
+   Mesh mesh = Mesh::MakeCartesian3D(3, 2, 2, Element::HEXAHEDRON);
+   const int dim = mesh.Dimension();
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim);
+
+   // The models that can be evaluated in parallel, and one that is evaluated
+   // by one thread at a time
+   FunctionCoefficient mu([](const Vector &p) { return 1.0 + p(0); });
+   ConstantCoefficient K(5.0);
+   NeoHookeanModel nh_const(1.0, 5.0), nh_coeff(mu, K);
+   InverseHarmonicModel ih;
+   const int m = GENERATE(0, 1, 2);
+   HyperelasticModel *model = (m == 0) ? (HyperelasticModel*)&nh_const :
+                              (m == 1) ? (HyperelasticModel*)&nh_coeff :
+                              (HyperelasticModel*)&ih;
+   CAPTURE(m);
+
+   NonlinearForm n(&fes), n_colored(&fes);
+   n.AddDomainIntegrator(new HyperelasticNLFIntegrator(model));
+   n_colored.AddDomainIntegrator(new HyperelasticNLFIntegrator(model));
+   n_colored.EnableColoredGradient();
+   REQUIRE(n_colored.ColoredGradientEnabled());
+
+   GridFunction x(&fes);
+   VectorFunctionCoefficient deform(dim, [](const Vector &p, Vector &y)
+   {
+      y = p;
+      y(0) += 0.1*p(1)*p(2);
+      y(1) += 0.05*p(0)*p(0);
+   });
+   x.ProjectCoefficient(deform);
+
+   SparseMatrix grad(dynamic_cast<SparseMatrix&>(n.GetGradient(x)));
+
+   // The first call computes the sparsity pattern, the second one assembles
+   // color by color, on several threads with MFEM_USE_LEGACY_OPENMP
+#ifdef MFEM_USE_LEGACY_OPENMP
+   const int max_threads = omp_get_max_threads();
+   omp_set_num_threads(4);
+#endif
+   n_colored.GetGradient(x);
+   SparseMatrix &grad_colored =
+      dynamic_cast<SparseMatrix&>(n_colored.GetGradient(x));
+#ifdef MFEM_USE_LEGACY_OPENMP
+   omp_set_num_threads(max_threads);
+#endif
+
+   SparseMatrix *D = Add(1.0, grad, -1.0, grad_colored);
+   REQUIRE(grad.MaxNorm() > 0.0);
+   REQUIRE(D->MaxNorm() == MFEM_Approx(0.0));
+   delete D;
+}
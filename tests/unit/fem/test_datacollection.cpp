@@ -382,3 +382,71 @@ TEST_CASE("ParaView VTKHDF restart mode", "[ParaView]")
 }
 
 #endif // MFEM_USE_HDF5
+
+#ifdef MFEM_USE_MPI
+
+TEST_CASE("Checkpoint save and load", "[Parallel], [DataCollection]")
+{
+   // Save on all ranks and load on all ranks (same partitioning) and on half
+   // of them (new partitioning).
+   Mesh smesh = Mesh::MakeCartesian3D(4, 4, 4, Element::HEXAHEDRON);
+   smesh.SetCurvature(2);
+   ParMesh pmesh(MPI_COMM_WORLD, smesh);
+
+   auto u_exact = [](const Vector &x) { return x(0) + x(1)*x(2); };
+   FunctionCoefficient u_coeff(u_exact);
+   VectorFunctionCoefficient v_coeff(3, [](const Vector &x, Vector &v)
+   {
+      v(0) = x(1); v(1) = -x(0); v(2) = 1.0;
+   });
+
+   H1_FECollection h1_fec(2, 3);
+   ParFiniteElementSpace h1_fes(&pmesh, &h1_fec);
+   ParGridFunction u(&h1_fes);
+   u.ProjectCoefficient(u_coeff);
+   ND_FECollection nd_fec(2, 3);
+   ParFiniteElementSpace nd_fes(&pmesh, &nd_fec);
+   ParGridFunction v(&nd_fes);
+   v.ProjectCoefficient(v_coeff);
+
+   {
+      CheckpointDataCollection dc(MPI_COMM_WORLD, "ckpt", &pmesh);
+      dc.RegisterField("u", &u);
+      dc.RegisterField("v", &v);
+      dc.SetCycle(3);
+      dc.SetTime(0.5);
+      dc.Save();
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+   }
+
+   const int size = Mpi::WorldSize(), rank = Mpi::WorldRank();
+   const int load_size = GENERATE_COPY(size, std::max(size/2, 1));
+   MPI_Comm comm;
+   MPI_Comm_split(MPI_COMM_WORLD, rank < load_size, rank, &comm);
+   if (rank < load_size)
+   {
+      CheckpointDataCollection dc(comm, "ckpt");
+      dc.Load(3);
+      REQUIRE(dc.Error() == DataCollection::No_Error);
+      REQUIRE(dc.GetTime() == 0.5);
+
+      ParMesh *loaded = dynamic_cast<ParMesh*>(dc.GetMesh());
+      REQUIRE(loaded != nullptr);
+      REQUIRE(loaded->GetGlobalNE() == smesh.GetNE());
+      REQUIRE(loaded->GetNodes() != nullptr);
+      if (load_size == size) { REQUIRE(loaded->GetNE() == pmesh.GetNE()); }
+
+      ParGridFunction *u_new = dc.GetParField("u");
+      ParGridFunction *v_new = dc.GetParField("v");
+      REQUIRE(u_new != nullptr);
+      REQUIRE(v_new != nullptr);
+      REQUIRE(u_new->ComputeL2Error(u_coeff) == MFEM_Approx(0.0));
+      REQUIRE(v_new->ComputeL2Error(v_coeff) == MFEM_Approx(0.0));
+   }
+   MPI_Comm_free(&comm);
+
+   MPI_Barrier(MPI_COMM_WORLD);
+   if (rank == 0) { REQUIRE(remove("ckpt_000003.mfem_ckpt") == 0); }
+}
+
+#endif // MFEM_USE_MPI
@@ -270,4 +270,48 @@ TEST_CASE("Simplex integration rules", "[SimplexRules]")
          }
       }
    }
+
+   SECTION("collapsed triangle and tet rules for f=x^l y^m z^n, where l+m+n <= p")
+   {
+      for (int order = 0; order <= 16; order++)
+      {
+         const IntegrationRule &irt = IntRules.GetCollapsed(Geometry::TRIANGLE,
+                                                            order);
+         const IntegrationRule &ire = IntRules.GetCollapsed(Geometry::TETRAHEDRON,
+                                                            order);
+         REQUIRE(irt.GetOrder() == order);
+         REQUIRE(ire.GetOrder() == order);
+         REQUIRE(&irt == &IntRules.GetCollapsed(Geometry::TRIANGLE, order));
+
+         for (int p = 0; p <= order; p++)
+         {
+            for (int l = p; l >= 0; l--)
+            {
+               double integral = 0.0;
+               for (int i = 0; i < irt.GetNPoints(); i++)
+               {
+                  const IntegrationPoint &ip = irt.IntPoint(i);
+                  integral += ip.weight*poly2d(ip, l, p - l);
+               }
+               double exact = 1.0/binom[p][l]/(p + 1)/(p + 2);
+               INFO("triangle: p=" << p << ", l=" << l);
+               REQUIRE(fabs(1. - integral/exact) < 1e-11);
+
+               for (int m = p - l; m >= 0; m--)
+               {
+                  const int n = p - l - m;
+                  integral = 0.0;
+                  for (int i = 0; i < ire.GetNPoints(); i++)
+                  {
+                     const IntegrationPoint &ip = ire.IntPoint(i);
+                     integral += ip.weight*poly3d(ip, l, m, n);
+                  }
+                  exact = 1.0/binom[p][l+m]/binom[l+m][l]/(p+1)/(p+2)/(p+3);
+                  INFO("tet: p=" << p << ", l=" << l << ", m=" << m);
+                  REQUIRE(fabs(1. - integral/exact) < 1e-11);
+               }
+            }
+         }
+      }
+   }
 }
@@ -344,6 +344,68 @@ TEST_CASE("Nonlinear Convection", "[PartialAssembly], [NonlinearPA], [GPU]")
    }
 }
 
+TEST_CASE("Nonlinear Hyperelastic", "[PartialAssembly], [NonlinearPA], [GPU]")
+{
+   const int dim = GENERATE(2, 3);
+   const int order = GENERATE(1, 2);
+   const int model_type = GENERATE(0, 1, 2);
+   CAPTURE(dim, order, model_type);
+
+   Mesh mesh = MakeCartesianNonaligned(dim, 2);
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim);
+
+   // Smooth deformation of the mesh coordinates
+   VectorFunctionCoefficient deform(dim, [](const Vector &p, Vector &u)
+   {
+      u = p;
+      for (int d = 0; d < p.Size(); d++)
+      {
+         u(d) += 0.1*sin(M_PI*p(d))*cos(M_PI*p((d + 1) % p.Size()));
+      }
+   });
+   GridFunction x(&fes), v(&fes);
+   x.ProjectCoefficient(deform);
+   v.Randomize(1);
+
+   ConstantCoefficient K(2.0);
+   FunctionCoefficient mu([](const Vector &p) { return 1.0 + p(0)*p(1); });
+   NeoHookeanModel nh_const(0.5, 2.0, 1.1), nh_coeff(mu, K);
+   InverseHarmonicModel ih;
+   HyperelasticModel *model = (model_type == 0) ? (HyperelasticModel*)&nh_const :
+                              (model_type == 1) ? (HyperelasticModel*)&nh_coeff :
+                              (HyperelasticModel*)&ih;
+
+   NonlinearForm nlf_fa(&fes);
+   nlf_fa.AddDomainIntegrator(new HyperelasticNLFIntegrator(model));
+
+   NonlinearForm nlf_pa(&fes);
+   nlf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   nlf_pa.AddDomainIntegrator(new HyperelasticNLFIntegrator(model));
+   nlf_pa.Setup();
+
+   // Residual
+   Vector y_fa(fes.GetVSize()), y_pa(fes.GetVSize());
+   nlf_fa.Mult(x, y_fa);
+   nlf_pa.Mult(x, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-10*y_fa.Normlinf()));
+
+   // Action of the gradient
+   SparseMatrix &grad_fa = dynamic_cast<SparseMatrix&>(nlf_fa.GetGradient(x));
+   Operator &grad_pa = nlf_pa.GetGradient(x);
+   grad_fa.Mult(v, y_fa);
+   grad_pa.Mult(v, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-10*y_fa.Normlinf()));
+
+   // Diagonal of the gradient
+   grad_fa.GetDiag(y_fa);
+   grad_pa.AssembleDiagonal(y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() == MFEM_Approx(0.0, 1e-10*y_fa.Normlinf()));
+}
+
 template <typename INTEGRATOR>
 real_t test_pa_vector_integrator(int dim, int sdim)
 {
@@ -693,6 +755,365 @@ TEST_CASE("PA Diffusion", "[PartialAssembly], [GPU]")
    test_pa_integrator<DiffusionIntegrator>();
 } // PA Diffusion test case
 
+static void simplex_matrix_coeff(const Vector &x, DenseMatrix &K)
+{
+   const int dim = x.Size();
+   K.SetSize(dim);
+   for (int i = 0; i < dim; i++)
+   {
+      for (int j = 0; j < dim; j++)
+      {
+         K(i,j) = (i == j) ? 2.0 + x(i) : 0.1*(i + 1)*x(j) - 0.05*j;
+      }
+   }
+}
+
+TEST_CASE("PA Bernstein Simplex", "[PartialAssembly], [GPU]")
+{
+   const auto dim = GENERATE(2, 3);
+   const auto order = GENERATE(1, 2, 3, 5);
+   // 0: mass, 1: DG mass, 2: diffusion, 3: nonsymmetric matrix diffusion
+   const auto problem = GENERATE(0, 1, 2, 3);
+   // Nodal bases use a change of basis to the Bernstein basis
+   const auto btype = GENERATE(BasisType::Positive, BasisType::GaussLobatto);
+   CAPTURE(dim, order, problem, btype);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(3, 3, Element::TRIANGLE) :
+               Mesh::MakeCartesian3D(2, 2, 2, Element::TETRAHEDRON);
+   // Move the vertices: the elements remain affine, so that the standard and
+   // the collapsed rules of the same order are both exact.
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(1)*x(1);
+      y(1) += 0.2*x(0)*(1.0 - x(0));
+   });
+
+   std::unique_ptr<FiniteElementCollection> fec;
+   if (problem == 1) { fec.reset(new L2_FECollection(order, dim, btype)); }
+   else { fec.reset(new H1_FECollection(order, dim, btype)); }
+   FiniteElementSpace fes(&mesh, fec.get());
+
+   // The integrands are polynomials of degree 2*order + 1. A user-supplied
+   // rule must be a collapsed rule for partial assembly on simplices.
+   const IntegrationRule &ir =
+      IntRules.GetCollapsed(mesh.GetTypicalElementGeometry(), 2*order + 1);
+   FunctionCoefficient q([](const Vector &x) { return 1.0 + x(0) - 0.5*x(1); });
+   MatrixFunctionCoefficient mq(dim, simplex_matrix_coeff);
+
+   BilinearForm blf_fa(&fes), blf_pa(&fes);
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   for (BilinearForm *blf : {&blf_fa, &blf_pa})
+   {
+      BilinearFormIntegrator *integ;
+      if (problem <= 1) { integ = new MassIntegrator(q, &ir); }
+      else if (problem == 2) { integ = new DiffusionIntegrator(q, &ir); }
+      else { integ = new DiffusionIntegrator(mq, &ir); }
+      blf->AddDomainIntegrator(integ);
+      blf->Assemble();
+   }
+   blf_fa.Finalize();
+
+   GridFunction x(&fes), y_fa(&fes), y_pa(&fes);
+   x.Randomize(1);
+   blf_fa.Mult(x, y_fa);
+   blf_pa.Mult(x, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() <= 1e-11*y_fa.Normlinf());
+
+   Vector diag_fa(fes.GetTrueVSize()), diag_pa(fes.GetTrueVSize());
+   blf_fa.SpMat().GetDiag(diag_fa);
+   blf_pa.AssembleDiagonal(diag_pa);
+   diag_pa -= diag_fa;
+   REQUIRE(diag_pa.Normlinf() <= 1e-11*diag_fa.Normlinf());
+} // PA Bernstein Simplex test case
+
+TEST_CASE("PA Mixed Precision", "[PartialAssembly], [GPU]")
+{
+   const auto dim = GENERATE(2, 3);
+   const auto order = GENERATE(1, 2, 4);
+   // 0: mass, 1: diffusion, 2: nonsymmetric matrix diffusion,
+   // 3: vector diffusion
+   const auto problem = GENERATE(0, 1, 2, 3);
+   CAPTURE(dim, order, problem);
+
+   Mesh mesh = (dim == 2) ? Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL)
+               : Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(1)*x(1);
+      y(1) += 0.2*x(0)*(1.0 - x(0));
+   });
+
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec, (problem == 3) ? dim : 1);
+
+   FunctionCoefficient q([](const Vector &x) { return 1.0 + x(0) - 0.5*x(1); });
+   MatrixFunctionCoefficient mq(dim, simplex_matrix_coeff);
+
+   BilinearForm blf_pa(&fes), blf_mp(&fes);
+   blf_mp.EnableMixedPrecisionPA();
+   for (BilinearForm *blf : {&blf_pa, &blf_mp})
+   {
+      BilinearFormIntegrator *integ;
+      if (problem == 0) { integ = new MassIntegrator(q); }
+      else if (problem == 1) { integ = new DiffusionIntegrator(q); }
+      else if (problem == 2) { integ = new DiffusionIntegrator(mq); }
+      else { integ = new VectorDiffusionIntegrator(q); }
+      blf->SetAssemblyLevel(AssemblyLevel::PARTIAL);
+      blf->AddDomainIntegrator(integ);
+      blf->Assemble();
+   }
+   REQUIRE((*blf_mp.GetDBFI())[0]->GetPAMixedPrecision());
+
+   // The quadrature data is rounded to float, while the accumulation is done
+   // in real_t
+   const real_t tol = 1e-6;
+
+   GridFunction x(&fes), y_pa(&fes), y_mp(&fes);
+   x.Randomize(1);
+   blf_pa.Mult(x, y_pa);
+   blf_mp.Mult(x, y_mp);
+   y_mp -= y_pa;
+   REQUIRE(y_mp.Normlinf() <= tol*y_pa.Normlinf());
+   if (std::is_same<real_t, double>::value)
+   {
+      // The single precision data is used: the results differ by more than
+      // the double precision round-off
+      REQUIRE(y_mp.Normlinf() >= 1e-12*y_pa.Normlinf());
+   }
+
+   if (problem <= 1)
+   {
+      blf_pa.MultTranspose(x, y_pa);
+      blf_mp.MultTranspose(x, y_mp);
+      y_mp -= y_pa;
+      REQUIRE(y_mp.Normlinf() <= tol*y_pa.Normlinf());
+   }
+
+   Vector diag_pa(fes.GetTrueVSize()), diag_mp(fes.GetTrueVSize());
+   blf_pa.AssembleDiagonal(diag_pa);
+   blf_mp.AssembleDiagonal(diag_mp);
+   diag_mp -= diag_pa;
+   REQUIRE(diag_mp.Normlinf() <= tol*diag_pa.Normlinf());
+
+   // Disabling the option and reassembling goes back to real_t data
+   blf_mp.EnableMixedPrecisionPA(false);
+   blf_mp.Assemble();
+   REQUIRE(!(*blf_mp.GetDBFI())[0]->GetPAMixedPrecision());
+   blf_pa.Mult(x, y_pa);
+   blf_mp.Mult(x, y_mp);
+   y_mp -= y_pa;
+   REQUIRE(y_mp.Normlinf() <= 1e-14*y_pa.Normlinf());
+
+   // Element and full assembly ignore the setting of the integrators. The EA
+   // kernels only support the symmetric diffusion coefficients.
+   if (problem <= 1)
+   {
+      for (AssemblyLevel level : {AssemblyLevel::ELEMENT, AssemblyLevel::FULL})
+      {
+         BilinearForm blf_ea(&fes);
+         BilinearFormIntegrator *integ;
+         if (problem == 0) { integ = new MassIntegrator(q); }
+         else { integ = new DiffusionIntegrator(q); }
+         integ->SetPAMixedPrecision();
+         blf_ea.SetAssemblyLevel(level);
+         blf_ea.AddDomainIntegrator(integ);
+         blf_ea.Assemble();
+         REQUIRE(integ->GetPAMixedPrecision());
+
+         GridFunction y_ea(&fes);
+         blf_ea.Mult(x, y_ea);
+         y_ea -= y_pa;
+         REQUIRE(y_ea.Normlinf() <= 1e-12*y_pa.Normlinf());
+      }
+   }
+} // PA Mixed Precision test case
+
+TEST_CASE("PA Fused Mass Diffusion", "[PartialAssembly], [GPU]")
+{
+   const auto dim = GENERATE(2, 3);
+   const auto order = GENERATE(1, 2, 3, 5);
+   const auto matrix_coeff = GENERATE(false, true);
+   CAPTURE(dim, order, matrix_coeff);
+
+   Mesh mesh = (dim == 2) ? Mesh::MakeCartesian2D(3, 3, Element::QUADRILATERAL)
+               : Mesh::MakeCartesian3D(2, 2, 2, Element::HEXAHEDRON);
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y(0) += 0.1*x(1)*x(1);
+      y(1) += 0.2*x(0)*(1.0 - x(0));
+   });
+
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   // M + dt K, with variable coefficients in both terms
+   const real_t dt = 0.1;
+   FunctionCoefficient q([](const Vector &x) { return 1.0 + x(0) - 0.5*x(1); });
+   ProductCoefficient dt_q(dt, q);
+   MatrixFunctionCoefficient mq(dim, simplex_matrix_coeff);
+   ScalarMatrixProductCoefficient dt_mq(dt, mq);
+
+   BilinearForm blf_fa(&fes), blf_pa(&fes);
+   for (BilinearForm *blf : {&blf_fa, &blf_pa})
+   {
+      blf->AddDomainIntegrator(new MassIntegrator(q));
+      blf->AddDomainIntegrator(matrix_coeff ? new DiffusionIntegrator(dt_mq)
+                               : new DiffusionIntegrator(dt_q));
+   }
+   blf_pa.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf_fa.Assemble();
+   blf_fa.Finalize();
+   blf_pa.Assemble();
+
+   // The integrators can be fused unless the diffusion is nonsymmetric, and
+   // the form uses the fused kernel where it is faster
+   FusedMassDiffusionPA fused;
+   auto mass = static_cast<MassIntegrator*>((*blf_pa.GetDBFI())[0]);
+   auto diff = static_cast<DiffusionIntegrator*>((*blf_pa.GetDBFI())[1]);
+   REQUIRE(fused.Setup(*mass, *diff) == !matrix_coeff);
+   const bool use_fused = fused.IsSetup() && fused.IsFaster();
+   auto ext = dynamic_cast<PABilinearFormExtension*>(blf_pa.GetExtension());
+   REQUIRE(ext != nullptr);
+   REQUIRE(ext->IsFused(0) == use_fused);
+   REQUIRE(ext->IsFused(1) == use_fused);
+
+   if (fused.IsSetup())
+   {
+      // Compare the fused kernel with the separate ones, whether or not the
+      // form uses it
+      const int esize = fes.GetNE()*fes.GetTypicalFE()->GetDof();
+      Vector xe(esize), ye_sep(esize), ye_fused(esize);
+      xe.Randomize(1);
+      ye_sep = 0.0;
+      ye_fused = 0.0;
+      mass->AddMultPA(xe, ye_sep);
+      diff->AddMultPA(xe, ye_sep);
+      fused.AddMult(xe, ye_fused);
+      ye_fused -= ye_sep;
+      REQUIRE(ye_fused.Normlinf() <= 1e-12*ye_sep.Normlinf());
+   }
+
+   GridFunction x(&fes), y_fa(&fes), y_pa(&fes);
+   x.Randomize(1);
+   blf_fa.Mult(x, y_fa);
+   blf_pa.Mult(x, y_pa);
+   y_pa -= y_fa;
+   REQUIRE(y_pa.Normlinf() <= 1e-12*y_fa.Normlinf());
+
+   if (!matrix_coeff)
+   {
+      blf_fa.MultTranspose(x, y_fa);
+      blf_pa.MultTranspose(x, y_pa);
+      y_pa -= y_fa;
+      REQUIRE(y_pa.Normlinf() <= 1e-12*y_fa.Normlinf());
+   }
+} // PA Fused Mass Diffusion test case
+
+TEST_CASE("PA ArrayMult", "[PartialAssembly], [GPU]")
+{
+   auto fname = GENERATE("../../data/star.mesh", "../../data/star-q3.mesh",
+                         "../../data/fichera.mesh", "../../data/fichera-q3.mesh");
+   auto order = GENERATE(1, 2, 3);
+   CAPTURE(fname, order);
+
+   Mesh mesh(fname);
+   const int dim = mesh.Dimension();
+   H1_FECollection fec(order, dim);
+   FiniteElementSpace fes(&mesh, &fec);
+
+   FunctionCoefficient coeff(f1);
+   BilinearForm blf(&fes);
+   blf.SetAssemblyLevel(AssemblyLevel::PARTIAL);
+   blf.AddDomainIntegrator(new MassIntegrator(coeff));
+   blf.AddDomainIntegrator(new DiffusionIntegrator(coeff));
+   blf.Assemble();
+
+   Array<int> ess_bdr(mesh.bdr_attributes.Max()), ess_tdof_list;
+   ess_bdr = 1;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+   OperatorHandle A;
+   blf.FormSystemMatrix(ess_tdof_list, A);
+
+   const int nvec = 3, n = fes.GetTrueVSize();
+   std::vector<Vector> x(nvec), y(nvec);
+   Array<const Vector *> X(nvec);
+   Array<Vector *> Y(nvec);
+   for (int v = 0; v < nvec; v++)
+   {
+      x[v].SetSize(n);
+      x[v].Randomize(v + 1);
+      y[v].SetSize(n);
+      X[v] = &x[v];
+      Y[v] = &y[v];
+   }
+
+   Vector y_ref(n);
+   blf.ArrayMult(X, Y);
+   for (int v = 0; v < nvec; v++)
+   {
+      blf.Mult(x[v], y_ref);
+      y_ref -= y[v];
+      REQUIRE(y_ref.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   A->ArrayMult(X, Y);
+   for (int v = 0; v < nvec; v++)
+   {
+      A->Mult(x[v], y_ref);
+      y_ref -= y[v];
+      REQUIRE(y_ref.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   // Keeping the diagonal entries of the constrained rows
+   ConstrainedOperator A_keep(&blf, ess_tdof_list, false, Operator::DIAG_KEEP);
+   Vector diag(n);
+   blf.AssembleDiagonal(diag);
+   diag.HostRead();
+   A_keep.ArrayMult(X, Y);
+   for (int v = 0; v < nvec; v++)
+   {
+      A_keep.Mult(x[v], y_ref);
+      y_ref.HostRead();
+      x[v].HostRead();
+      for (int id : ess_tdof_list)
+      {
+         REQUIRE(y_ref(id) == MFEM_Approx(diag(id)*x[v](id)));
+      }
+      y_ref -= y[v];
+      REQUIRE(y_ref.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   // ElementRestriction with several components
+   FiniteElementSpace vfes(&mesh, &fec, 2, Ordering::byVDIM);
+   const Operator *R = vfes.GetElementRestriction(
+                          ElementDofOrdering::LEXICOGRAPHIC);
+   auto *ER = dynamic_cast<const ElementRestriction*>(R);
+   REQUIRE(ER != nullptr);
+   const int ln = R->Width(), en = R->Height();
+   Vector l(nvec*ln), e(nvec*en), l_multi(nvec*ln);
+   l.Randomize(1);
+   ER->MultiMult(nvec, l, e);
+   ER->MultiMultTranspose(nvec, e, l_multi);
+   Vector lv, ev, e_ref(en), l_ref(ln);
+   for (int v = 0; v < nvec; v++)
+   {
+      lv.MakeRef(l, v*ln, ln);
+      ev.MakeRef(e, v*en, en);
+      R->Mult(lv, e_ref);
+      e_ref -= ev;
+      REQUIRE(e_ref.Normlinf() == MFEM_Approx(0.0));
+      R->MultTranspose(ev, l_ref);
+      lv.MakeRef(l_multi, v*ln, ln);
+      l_ref -= lv;
+      REQUIRE(l_ref.Normlinf() == MFEM_Approx(0.0));
+   }
+}
+
 TEST_CASE("PA Markers", "[PartialAssembly], [GPU]")
 {
    const bool all_tests = launch_all_non_regression_tests;
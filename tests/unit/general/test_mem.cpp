@@ -12,6 +12,11 @@
 #include "mfem.hpp"
 #include "unit_tests.hpp"
 
+#include <atomic>
+#ifdef MFEM_USE_OPENMP
+#include <omp.h>
+#endif
+
 using namespace mfem;
 
 TEST_CASE("MemoryManager/Scopes",
@@ -67,3 +72,142 @@ TEST_CASE("MemoryManager/Scopes",
       REQUIRE((x_data == x.HostRead()));
    }
 }
+
+TEST_CASE("MemoryManager/HostPool", "[MemoryManager]")
+{
+   MemoryManager::ReleaseHostPool();
+   MemoryManager::ResetHostPoolStats();
+   const size_t in_use = MemoryManager::GetHostPoolStats().bytes_in_use;
+
+   SECTION("Reuse")
+   {
+      const real_t *data;
+      {
+         Vector x(100, MemoryType::HOST_POOL);
+         REQUIRE(x.GetMemory().GetMemoryType() == MemoryType::HOST_POOL);
+         for (int i = 0; i < x.Size(); i++) { x(i) = i; }
+         data = x.GetData();
+         REQUIRE(x.Sum() == MFEM_Approx(4950.0));
+      }
+      // A block of the same size class is reused
+      Vector y(98, MemoryType::HOST_POOL);
+      REQUIRE(y.GetData() == data);
+      y = 1.0;
+      REQUIRE(y.Sum() == MFEM_Approx(98.0));
+
+      const auto stats = MemoryManager::GetHostPoolStats();
+      REQUIRE(stats.allocations == 2);
+      REQUIRE(stats.hits == 1);
+      REQUIRE(stats.HitRate() == MFEM_Approx(0.5));
+      REQUIRE(stats.bytes_in_use >= in_use + 98*sizeof(real_t));
+   }
+
+   SECTION("Peak")
+   {
+      {
+         Vector a(1000, MemoryType::HOST_POOL);
+         Vector b(1000, MemoryType::HOST_POOL);
+         a = 1.0;
+         b = 2.0;
+         a += b;
+         REQUIRE(a.Max() == MFEM_Approx(3.0));
+      }
+      const auto stats = MemoryManager::GetHostPoolStats();
+      REQUIRE(stats.bytes_in_use == in_use);
+      REQUIRE(stats.peak_bytes >= in_use + 2000*sizeof(real_t));
+      REQUIRE(stats.peak_bytes <= in_use + 2*1280*sizeof(real_t));
+      REQUIRE(stats.bytes_cached >= 2000*sizeof(real_t));
+
+      MemoryManager::ReleaseHostPool();
+      REQUIRE(MemoryManager::GetHostPoolStats().bytes_cached == 0);
+   }
+
+   SECTION("Large")
+   {
+      // Blocks above the largest size class bypass the pool
+      Memory<char> a((1 << 28) + 1, MemoryType::HOST_POOL);
+      a[1 << 28] = 'a';
+      REQUIRE(a[1 << 28] == 'a');
+      REQUIRE(MemoryManager::GetHostPoolStats().bytes_cached == 0);
+      a.Delete();
+      REQUIRE(MemoryManager::GetHostPoolStats().bytes_in_use == in_use);
+   }
+}
+
+TEST_CASE("MemoryManager/Registry", "[MemoryManager]")
+{
+   // MemoryType::HOST_64 memory is registered with the MemoryManager
+   constexpr int num_vectors = 1000;
+   std::vector<Vector> vectors(num_vectors);
+   std::vector<Vector> aliases(num_vectors);
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int i = 0; i < num_vectors; i++)
+   {
+      vectors[i].SetSize(2 + i % 7, MemoryType::HOST_64);
+      vectors[i] = i;
+      aliases[i].MakeRef(vectors[i], 1, 1);
+      aliases[i].UseDevice(true);
+   }
+   for (int i = 0; i < num_vectors; i++)
+   {
+      REQUIRE(mm.IsKnown(vectors[i].GetData()));
+      REQUIRE(mm.IsAlias(aliases[i].GetData()));
+      REQUIRE(aliases[i].Read()[0] == i);
+   }
+   std::vector<real_t*> data(num_vectors);
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel for
+#endif
+   for (int i = 0; i < num_vectors; i++)
+   {
+      data[i] = vectors[i].GetData();
+      aliases[i].Destroy();
+      vectors[i].Destroy();
+   }
+   for (int i = 0; i < num_vectors; i++)
+   {
+      REQUIRE(!mm.IsKnown(data[i]));
+   }
+}
+
+TEST_CASE("MemoryManager/Registry Concurrent Lookups", "[MemoryManager]")
+{
+   // Lookups of registered pointers stay correct while another thread grows
+   // and shrinks the registry tables
+   constexpr int num_vectors = 64, num_rounds = 200;
+   std::vector<Vector> vectors(num_vectors);
+   for (Vector &v : vectors) { v.SetSize(4, MemoryType::HOST_64); }
+
+   std::atomic<bool> done{false};
+   std::atomic<int> missed{0};
+#ifdef MFEM_USE_OPENMP
+   #pragma omp parallel num_threads(3)
+#endif
+   {
+#ifdef MFEM_USE_OPENMP
+      const bool writer = (omp_get_thread_num() == 0);
+#else
+      const bool writer = true;
+#endif
+      if (writer)
+      {
+         for (int r = 0; r < num_rounds; r++)
+         {
+            std::vector<Vector> tmp(100 + 50*(r % 8));
+            for (Vector &v : tmp) { v.SetSize(1, MemoryType::HOST_64); }
+         }
+         done = true;
+      }
+      do
+      {
+         for (const Vector &v : vectors)
+         {
+            if (!mm.IsKnown(v.GetData())) { missed++; }
+         }
+      }
+      while (!done.load());
+   }
+   REQUIRE(missed.load() == 0);
+}
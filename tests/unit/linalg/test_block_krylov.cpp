@@ -0,0 +1,136 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+// Solve A X = B with the block solver and compare with the solutions computed
+// one right-hand side at a time with the reference solver. The number of block
+// iterations should not exceed the largest number of reference iterations by
+// more than max_extra_iter.
+static void TestBlockSolver(IterativeSolver &block_solver,
+                            IterativeSolver &ref_solver,
+                            const Operator &A, Solver *prec,
+                            const std::vector<Vector> &B, int max_extra_iter)
+{
+   const int k = (int) B.size();
+   for (IterativeSolver *solver : {&block_solver, &ref_solver})
+   {
+      solver->SetRelTol(1e-10);
+      solver->SetAbsTol(0.0);
+      solver->SetMaxIter(1000);
+      solver->SetPrintLevel(-1);
+      solver->SetOperator(A);
+      if (prec) { solver->SetPreconditioner(*prec); }
+   }
+
+   std::vector<Vector> X(k, Vector(A.Width()));
+   for (Vector &x : X) { x = 0.0; }
+   Array<const Vector *> Bp(k);
+   Array<Vector *> Xp(k);
+   for (int j = 0; j < k; j++)
+   {
+      Bp[j] = &B[j];
+      Xp[j] = &X[j];
+   }
+   block_solver.ArrayMult(Bp, Xp);
+   REQUIRE(block_solver.GetConverged());
+
+   Vector x_ref(A.Width());
+   int max_ref_iter = 0;
+   for (int j = 0; j < k; j++)
+   {
+      x_ref = 0.0;
+      ref_solver.Mult(B[j], x_ref);
+      REQUIRE(ref_solver.GetConverged());
+      max_ref_iter = std::max(max_ref_iter, ref_solver.GetNumIterations());
+      const real_t norm = x_ref.Normlinf();
+      X[j] -= x_ref;
+      REQUIRE(X[j].Normlinf() <= 1e-6*std::max(norm, real_t(1)));
+   }
+   REQUIRE(block_solver.GetNumIterations() <= max_ref_iter + max_extra_iter);
+
+   // Single right-hand side
+   X[0] = 0.0;
+   block_solver.Mult(B[0], X[0]);
+   REQUIRE(block_solver.GetConverged());
+}
+
+TEST_CASE("Block Krylov solvers", "[BlockCG][BlockGMRES]")
+{
+   const bool use_prec = GENERATE(false, true);
+   const int k = GENERATE(1, 4);
+   CAPTURE(use_prec, k);
+
+   Mesh mesh = Mesh::MakeCartesian2D(6, 6, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_tdof_list, ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = 1;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   std::vector<Vector> B(k, Vector(fes.GetTrueVSize()));
+   for (int j = 0; j < k; j++)
+   {
+      B[j].Randomize(j+1);
+      B[j].SetSubVector(ess_tdof_list, 0.0);
+   }
+
+   ConstantCoefficient one(1.0);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.AddDomainIntegrator(new MassIntegrator(one));
+
+   SECTION("Block CG")
+   {
+      a.Assemble();
+      a.Finalize();
+      SparseMatrix A;
+      a.FormSystemMatrix(ess_tdof_list, A);
+      DSmoother jacobi(A);
+
+      BlockCGSolver block_cg;
+      CGSolver cg;
+      TestBlockSolver(block_cg, cg, A, use_prec ? &jacobi : nullptr, B, 1);
+   }
+
+   SECTION("Block GMRES")
+   {
+      Vector velocity({1.0, 0.5});
+      VectorConstantCoefficient vel(velocity);
+      a.AddDomainIntegrator(new ConvectionIntegrator(vel));
+      a.Assemble();
+      a.Finalize();
+      SparseMatrix A;
+      a.FormSystemMatrix(ess_tdof_list, A);
+      DSmoother jacobi(A);
+
+      BlockGMRESSolver block_gmres;
+      block_gmres.SetKDim(20);
+      GMRESSolver gmres;
+      gmres.SetKDim(20);
+      // The block method restarts more often
+      TestBlockSolver(block_gmres, gmres, A, use_prec ? &jacobi : nullptr, B,
+                      20);
+
+      if (k > 1)
+      {
+         // Linearly dependent and zero right-hand sides
+         B[1] = B[0];
+         B[2] = 0.0;
+         TestBlockSolver(block_gmres, gmres, A, use_prec ? &jacobi : nullptr,
+                         B, 20);
+      }
+   }
+}
@@ -0,0 +1,178 @@
+// Copyright (c) 2010-2025, Lawrence Livermore National Security, LLC. Produced
+// at the Lawrence Livermore National Laboratory. All Rights reserved. See files
+// LICENSE and NOTICE for details. LLNL-CODE-806117.
+//
+// This file is part of the MFEM library. For more information and source code
+// availability visit https://mfem.org.
+//
+// MFEM is free software; you can redistribute it and/or modify it under the
+// terms of the BSD-3 license. We welcome feedback and contributions, see file
+// CONTRIBUTING.md for details.
+
+#include "mfem.hpp"
+#include "unit_tests.hpp"
+
+using namespace mfem;
+
+TEST_CASE("Communication-avoiding CG", "[PipelinedCG][SStepCG]")
+{
+   const bool use_prec = GENERATE(false, true);
+   CAPTURE(use_prec);
+
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_tdof_list, ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = 1;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.AddDomainIntegrator(new MassIntegrator(one));
+   a.Assemble();
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+
+   GridFunction x(&fes);
+   x = 0.0;
+   SparseMatrix A;
+   Vector B, X;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+
+   DSmoother jacobi(A);
+   auto solve = [&](IterativeSolver &solver, Vector &sol)
+   {
+      solver.SetRelTol(1e-12);
+      solver.SetAbsTol(0.0);
+      solver.SetMaxIter(1000);
+      solver.SetPrintLevel(-1);
+      solver.SetOperator(A);
+      if (use_prec) { solver.SetPreconditioner(jacobi); }
+      sol.SetSize(B.Size());
+      sol = 0.0;
+      solver.Mult(B, sol);
+      REQUIRE(solver.GetConverged());
+      return solver.GetNumIterations();
+   };
+
+   Vector X_cg;
+   CGSolver cg;
+   const int cg_iter = solve(cg, X_cg);
+   const real_t norm = X_cg.Normlinf();
+
+   SECTION("Pipelined CG")
+   {
+      PipelinedCGSolver pcg;
+      const int iter = solve(pcg, X);
+      X -= X_cg;
+      REQUIRE(X.Normlinf() <= 1e-8*norm);
+      // Mathematically equivalent to CG
+      REQUIRE(std::abs(iter - cg_iter) <= 2);
+   }
+
+   SECTION("s-step CG")
+   {
+      const int s = GENERATE(1, 2, 3, 4, 5);
+      CAPTURE(s);
+      SStepCGSolver sscg(s);
+      const int iter = solve(sscg, X);
+      X -= X_cg;
+      REQUIRE(X.Normlinf() <= 1e-8*norm);
+      // The convergence is checked every s steps, and the monomial basis
+      // loses some accuracy for larger s
+      REQUIRE(iter <= cg_iter + 3*s);
+   }
+
+   SECTION("Iterative mode")
+   {
+      SStepCGSolver sscg(3);
+      sscg.iterative_mode = true;
+      sscg.SetAbsTol(1e-8);
+      sscg.SetMaxIter(1000);
+      sscg.SetPrintLevel(-1);
+      sscg.SetOperator(A);
+      X = X_cg;
+      sscg.Mult(B, X);
+      REQUIRE(sscg.GetConverged());
+      REQUIRE(sscg.GetNumIterations() == 0);
+   }
+}
+
+TEST_CASE("Communication-avoiding GMRES", "[SStepGMRES]")
+{
+   const bool use_prec = GENERATE(false, true);
+   // A restart length that is not a multiple of s, and no restart
+   const int kdim = GENERATE(20, 200);
+   CAPTURE(use_prec, kdim);
+
+   // Nonsymmetric convection-diffusion problem
+   Mesh mesh = Mesh::MakeCartesian2D(8, 8, Element::QUADRILATERAL);
+   H1_FECollection fec(2, mesh.Dimension());
+   FiniteElementSpace fes(&mesh, &fec);
+
+   Array<int> ess_tdof_list, ess_bdr(mesh.bdr_attributes.Max());
+   ess_bdr = 1;
+   fes.GetEssentialTrueDofs(ess_bdr, ess_tdof_list);
+
+   ConstantCoefficient one(1.0);
+   Vector velocity({8.0, 4.0});
+   VectorConstantCoefficient vel(velocity);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new DiffusionIntegrator(one));
+   a.AddDomainIntegrator(new ConvectionIntegrator(vel));
+   a.Assemble();
+   LinearForm b(&fes);
+   b.AddDomainIntegrator(new DomainLFIntegrator(one));
+   b.Assemble();
+
+   GridFunction x(&fes);
+   x = 0.0;
+   SparseMatrix A;
+   Vector B, X;
+   a.FormLinearSystem(ess_tdof_list, x, b, A, X, B);
+
+   DSmoother jacobi(A);
+   auto solve = [&](IterativeSolver &solver, Vector &sol)
+   {
+      solver.SetRelTol(1e-10);
+      solver.SetAbsTol(0.0);
+      solver.SetMaxIter(1000);
+      solver.SetPrintLevel(-1);
+      solver.SetOperator(A);
+      if (use_prec) { solver.SetPreconditioner(jacobi); }
+      sol.SetSize(B.Size());
+      sol = 0.0;
+      solver.Mult(B, sol);
+      REQUIRE(solver.GetConverged());
+      return solver.GetNumIterations();
+   };
+
+   Vector X_gmres;
+   GMRESSolver gmres;
+   gmres.SetKDim(kdim);
+   const int gmres_iter = solve(gmres, X_gmres);
+   const real_t norm = X_gmres.Normlinf();
+
+   const int s = GENERATE(1, 2, 3, 4, 5);
+   CAPTURE(s);
+   SStepGMRESSolver ssgmres(s);
+   ssgmres.SetKDim(kdim);
+   const int iter = solve(ssgmres, X);
+   // Same iterates as GMRES in exact arithmetic, the monomial basis loses
+   // some accuracy for larger s
+   REQUIRE(iter <= gmres_iter + 2*s);
+
+   // The true residual matches the estimate of the method
+   Vector res(B.Size()), Bres(B.Size());
+   A.Mult(X, res);
+   subtract(B, res, res);
+   if (use_prec) { jacobi.Mult(res, Bres); }
+   else { Bres = res; }
+   REQUIRE(Bres.Norml2() <= 2e-10*ssgmres.GetInitialNorm());
+
+   X -= X_gmres;
+   REQUIRE(X.Normlinf() <= 1e-7*norm);
+}
@@ -290,4 +290,103 @@ TEST_CASE("SparseMatrix cuSPARSE Bug", "[SparseMatrix][GPU]")
    REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("SparseMatrix SELL-C-sigma and BSR formats", "[SparseMatrix]")
+{
+   const int dim = GENERATE(2, 3);
+   CAPTURE(dim);
+
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(5, 4, Element::TRIANGLE) :
+               Mesh::MakeCartesian3D(3, 2, 2, Element::TETRAHEDRON);
+   H1_FECollection fec(2, dim);
+   FiniteElementSpace fes(&mesh, &fec, dim, Ordering::byVDIM);
+
+   ConstantCoefficient one(1.0), two(2.0);
+   BilinearForm a(&fes);
+   a.AddDomainIntegrator(new ElasticityIntegrator(one, two));
+   a.Assemble(0); // keep the zeros, so that all the nodal blocks are full
+   a.Finalize(0);
+   const SparseMatrix &A = a.SpMat();
+
+   Vector x(A.Width()), xt(A.Height()), y(A.Height()), yt(A.Width());
+   x.Randomize(1);
+   xt.Randomize(2);
+   Vector y_ref(A.Height()), yt_ref(A.Width());
+   A.Mult(x, y_ref);
+   A.MultTranspose(xt, yt_ref);
+
+   auto check = [&](const Operator &op)
+   {
+      op.Mult(x, y);
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+
+      op.MultTranspose(xt, yt);
+      yt -= yt_ref;
+      REQUIRE(yt.Normlinf() == MFEM_Approx(0.0));
+
+      // y += 2 A x
+      y = y_ref;
+      op.AddMult(x, y, 2.0);
+      y.Add(-3.0, y_ref);
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   };
+
+   SECTION("SELL-C-sigma")
+   {
+      for (int sigma : {1, 32, 1000000})
+      {
+         SlicedEllpackMatrix A_sell(A, sigma);
+         REQUIRE(A_sell.NumStoredEntries() >= A.NumNonZeroElems());
+         check(A_sell);
+      }
+   }
+
+   SECTION("BSR")
+   {
+      BlockCSRMatrix A_bsr(A, dim);
+      REQUIRE(A_bsr.NumBlocks()*dim*dim == A.NumNonZeroElems());
+      check(A_bsr);
+
+      BlockCSRMatrix A_bsr1(A, 1);
+      check(A_bsr1);
+
+      // Generic block size: 5 x 5 blocks of a matrix with 30 x 30 entries
+      Mesh mesh_q = Mesh::MakeCartesian2D(5, 4, Element::QUADRILATERAL);
+      H1_FECollection fec_q(1, 2);
+      FiniteElementSpace fes_q(&mesh_q, &fec_q);
+      BilinearForm m(&fes_q);
+      m.AddDomainIntegrator(new MassIntegrator);
+      m.Assemble();
+      m.Finalize();
+      const SparseMatrix &M = m.SpMat();
+      REQUIRE(M.Height() == 30);
+      BlockCSRMatrix M_bsr(M, 5);
+      Vector xm(M.Width()), ym(M.Height()), ym_ref(M.Height());
+      xm.Randomize(3);
+      M.Mult(xm, ym_ref);
+      M_bsr.Mult(xm, ym);
+      ym -= ym_ref;
+      REQUIRE(ym.Normlinf() == MFEM_Approx(0.0));
+      M.MultTranspose(xm, ym_ref);
+      M_bsr.MultTranspose(xm, ym);
+      ym -= ym_ref;
+      REQUIRE(ym.Normlinf() == MFEM_Approx(0.0));
+   }
+}
+
+TEST_CASE("SparseMatrix bandwidth and profile", "[SparseMatrix]")
+{
+   // 4 x 4 matrix with entries (0,0), (0,3), (1,1), (2,0), (2,2), (3,1), (3,3)
+   SparseMatrix A(4);
+   A.Add(0, 0, 1.0); A.Add(0, 3, 1.0);
+   A.Add(1, 1, 1.0);
+   A.Add(2, 0, 1.0); A.Add(2, 2, 1.0);
+   A.Add(3, 1, 1.0); A.Add(3, 3, 1.0);
+   A.Finalize();
+
+   REQUIRE(A.Bandwidth() == 3);
+   REQUIRE(A.Profile() == 0 + 0 + 2 + 2);
+}
+
 } // namespace mfem
@@ -44,7 +44,8 @@ static void TestTranspose(const Operator &A)
    REQUIRE(w1.Normlinf() == MFEM_Approx(0.0));
 }
 
-TEST_CASE("Sparse Smoothers Transposed", "[DSmoother][GSSmoother]")
+TEST_CASE("Sparse Smoothers Transposed",
+          "[DSmoother][GSSmoother][MulticolorGSSmoother]")
 {
    const bool sym = GENERATE(true, false);
 
@@ -73,4 +74,85 @@ TEST_CASE("Sparse Smoothers Transposed", "[DSmoother][GSSmoother]")
    TestTranspose(GSSmoother(A, 0, nit)); // symmetric
    TestTranspose(GSSmoother(A, 1, nit)); // forward
    TestTranspose(GSSmoother(A, 2, nit)); // backward
+   TestTranspose(MulticolorGSSmoother(A, GSSmoother::SYMMETRIC, nit));
+   TestTranspose(MulticolorGSSmoother(A, GSSmoother::FORWARD, nit));
+   TestTranspose(MulticolorGSSmoother(A, GSSmoother::BACKWARD, nit));
+}
+
+TEST_CASE("Multicolor Gauss-Seidel", "[MulticolorGSSmoother]")
+{
+   // 5-point Laplacian on an m x m grid, which is two-colorable
+   constexpr int m = 10, n = m*m;
+   SparseMatrix A(n, n);
+   for (int i = 0; i < m; i++)
+   {
+      for (int j = 0; j < m; j++)
+      {
+         const int r = i*m + j;
+         A.Add(r, r, 4.0);
+         if (i > 0) { A.Add(r, r - m, -1.0); }
+         if (i < m-1) { A.Add(r, r + m, -1.0); }
+         if (j > 0) { A.Add(r, r - 1, -1.0); }
+         if (j < m-1) { A.Add(r, r + 1, -1.0); }
+      }
+   }
+   A.Finalize();
+
+   MulticolorGSSmoother S(A, GSSmoother::SYMMETRIC, 1);
+   REQUIRE(S.GetNumColors() == 2);
+
+   // Rows of the same color are not coupled
+   const Table &colors = S.GetColoring();
+   Array<int> row_color(n);
+   for (int c = 0; c < colors.Size(); c++)
+   {
+      for (int k = 0; k < colors.RowSize(c); k++)
+      {
+         row_color[colors.GetRow(c)[k]] = c;
+      }
+   }
+   int conflicts = 0;
+   for (int i = 0; i < n; i++)
+   {
+      for (int k = A.GetI()[i]; k < A.GetI()[i+1]; k++)
+      {
+         const int j = A.GetJ()[k];
+         if (j != i && row_color[j] == row_color[i]) { conflicts++; }
+      }
+   }
+   REQUIRE(conflicts == 0);
+
+   // The smoother is symmetric and converges as a stationary iteration
+   TestTranspose(S);
+
+   Vector b(n), x(n), r(n);
+   b.Randomize();
+   x = 0.0;
+   S.iterative_mode = true;
+   for (int it = 0; it < 200; it++) { S.Mult(b, x); }
+   A.Mult(x, r);
+   r -= b;
+   REQUIRE(r.Normlinf() < 1e-6);
+
+   // The result does not depend on the number of threads: compare with the
+   // forward sweep applied by hand, color by color
+   MulticolorGSSmoother F(A, GSSmoother::FORWARD, 1);
+   Vector y(n), z(n);
+   F.Mult(b, y);
+   z = 0.0;
+   for (int c = 0; c < colors.Size(); c++)
+   {
+      for (int k = 0; k < colors.RowSize(c); k++)
+      {
+         const int i = colors.GetRow(c)[k];
+         real_t sum = b(i);
+         for (int l = A.GetI()[i]; l < A.GetI()[i+1]; l++)
+         {
+            if (A.GetJ()[l] != i) { sum -= A.GetData()[l]*z(A.GetJ()[l]); }
+         }
+         z(i) = sum/A.Elem(i, i);
+      }
+   }
+   z -= y;
+   REQUIRE(z.Normlinf() == MFEM_Approx(0.0));
 }
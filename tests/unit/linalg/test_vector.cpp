@@ -268,3 +268,48 @@ TEST_CASE("Vector delete at indices", "[Vector],[GPU]")
       }
    }
 }
+
+TEST_CASE("Vector fused updates", "[Vector],[GPU]")
+{
+   const int n = 1000;
+   const real_t a = 0.5, b = -2.0;
+   Vector p(n), q(n), w(n), x(n), y(n);
+   p.Randomize(1);
+   q.Randomize(2);
+   w.Randomize(3);
+   x.Randomize(4);
+   y.Randomize(5);
+
+   Vector x_ref(x), y_ref(y);
+   x_ref.Add(a, p);
+   y_ref.Add(b, q);
+
+   for (Vector *v : {&p, &q, &w, &x, &y}) { v->UseDevice(true); }
+
+   SECTION("AddTwo")
+   {
+      AddTwo(x, a, p, y, b, q);
+      x -= x_ref;
+      y -= y_ref;
+      REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   SECTION("AddTwoAndDot")
+   {
+      const real_t dot = AddTwoAndDot(x, a, p, y, b, q, w);
+      REQUIRE(dot == MFEM_Approx(y_ref*w));
+      x -= x_ref;
+      y -= y_ref;
+      REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   }
+
+   SECTION("AddTwoAndDot, squared norm")
+   {
+      const real_t dot = AddTwoAndDot(x, a, p, y, b, q, y);
+      REQUIRE(dot == MFEM_Approx(y_ref*y_ref));
+      y -= y_ref;
+      REQUIRE(y.Normlinf() == MFEM_Approx(0.0));
+   }
+}
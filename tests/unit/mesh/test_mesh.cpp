@@ -12,6 +12,11 @@
 #include "mfem.hpp"
 #include "unit_tests.hpp"
 
+#include <random>
+#ifdef MFEM_USE_LEGACY_OPENMP
+#include <omp.h>
+#endif
+
 using namespace mfem;
 
 TEST_CASE("Element-wise construction", "[Mesh]")
@@ -146,6 +151,57 @@ TEST_CASE("Gecko integration in MFEM", "[Mesh]")
    }
 }
 
+TEST_CASE("ReorderElementsForLocality", "[Mesh]")
+{
+   const int method = GENERATE(1, 2);
+   CAPTURE(method);
+
+   // Start from a random ordering of the elements
+   Mesh mesh = Mesh::MakeCartesian2D(12, 12, Element::QUADRILATERAL);
+   Array<int> perm(mesh.GetNE());
+   for (int i = 0; i < perm.Size(); i++) { perm[i] = i; }
+   std::mt19937 gen(42);
+   std::shuffle(perm.begin(), perm.end(), gen);
+   mesh.ReorderElements(perm);
+
+   // Average distance of the entries of the mass matrix from the diagonal
+   auto distance = [](Mesh &m)
+   {
+      H1_FECollection fec(1, m.Dimension());
+      FiniteElementSpace fes(&m, &fec);
+      BilinearForm a(&fes);
+      a.AddDomainIntegrator(new MassIntegrator);
+      a.Assemble();
+      a.Finalize();
+      const SparseMatrix &A = a.SpMat();
+      real_t dist = 0.0;
+      for (int i = 0; i < A.Height(); i++)
+      {
+         for (int k = A.GetI()[i]; k < A.GetI()[i+1]; k++)
+         {
+            dist += std::abs(i - A.GetJ()[k]);
+         }
+      }
+      REQUIRE(A.Bandwidth() <= A.Height());
+      return dist/A.NumNonZeroElems();
+   };
+   const real_t shuffled_distance = distance(mesh);
+
+   mesh.ReorderElementsForLocality(method);
+   REQUIRE(mesh.GetNE() == 144);
+   REQUIRE(distance(mesh) < shuffled_distance/3);
+
+   // The reordering is applied on load with Mesh::locality_ordering
+   std::stringstream buf;
+   mesh.Print(buf);
+   const int locality_ordering = Mesh::locality_ordering;
+   Mesh::locality_ordering = method;
+   Mesh loaded(buf);
+   Mesh::locality_ordering = locality_ordering;
+   REQUIRE(loaded.GetNE() == mesh.GetNE());
+   REQUIRE(distance(loaded) < shuffled_distance/3);
+}
+
 TEST_CASE("MakeSimplicial", "[Mesh]")
 {
    auto mesh_fname = GENERATE("../../data/star.mesh",
@@ -478,3 +534,378 @@ TEST_CASE("NURBS 1D curve in 2D from patches", "[Mesh]")
       }
    }
 }
+
+TEST_CASE("FindPoints", "[Mesh]")
+{
+   const int dim = GENERATE(2, 3);
+   const int n = 6;
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(n, n, Element::TRIANGLE) :
+               Mesh::MakeCartesian3D(n, n, n, Element::TETRAHEDRON);
+
+   const int npts = 50;
+   DenseMatrix points(dim, npts);
+   Vector(points.GetData(), dim*npts).Randomize(1);
+   Array<int> elem_ids;
+   Array<IntegrationPoint> ips;
+
+   auto check = [&](Mesh &m)
+   {
+      REQUIRE(m.FindPoints(points, elem_ids, ips) == npts);
+      Vector x(dim);
+      for (int k = 0; k < npts; k++)
+      {
+         REQUIRE(elem_ids[k] >= 0);
+         m.GetElementTransformation(elem_ids[k])->Transform(ips[k], x);
+         for (int d = 0; d < dim; d++)
+         {
+            REQUIRE(x(d) == MFEM_Approx(points(d, k)));
+         }
+      }
+   };
+
+   check(mesh);
+
+   // The element center tree is rebuilt after refinement
+   mesh.UniformRefinement();
+   check(mesh);
+
+   // ... and after moving the nodes
+   mesh.Transform([](const Vector &x, Vector &y)
+   {
+      y = x;
+      y *= 2.0;
+   });
+   points *= 2.0;
+   check(mesh);
+
+   // ... and after moving the vertices
+   Vector disp(dim*mesh.GetNV());
+   disp = 1.0;
+   mesh.MoveVertices(disp);
+   Vector(points.GetData(), dim*npts) += 1.0;
+   check(mesh);
+}
+
+TEST_CASE("Hilbert partitioning", "[Mesh]")
+{
+   const int dim = GENERATE(2, 3);
+   const int nparts = GENERATE(1, 4, 7);
+   const int n = (dim == 2) ? 24 : 8;
+   Mesh mesh = (dim == 2) ?
+               Mesh::MakeCartesian2D(n, n, Element::QUADRILATERAL) :
+               Mesh::MakeCartesian3D(n, n, n, Element::HEXAHEDRON);
+   const int ne = mesh.GetNE();
+
+   std::unique_ptr<int[]> partitioning(mesh.GeneratePartitioning(nparts, 6));
+
+   Array<int> psize(nparts);
+   psize = 0;
+   for (int i = 0; i < ne; i++)
+   {
+      REQUIRE(partitioning[i] >= 0);
+      REQUIRE(partitioning[i] < nparts);
+      psize[partitioning[i]]++;
+   }
+   REQUIRE(psize.Min() > 0);
+   REQUIRE(psize.Max() <= std::ceil(1.03*ne/nparts));
+
+   // The edge cut is not larger than the one of slabs of elements
+   const Table &el_el = mesh.ElementToElementTable();
+   int edgecut = 0, slab_edgecut = 0;
+   for (int i = 0; i < ne; i++)
+   {
+      for (int k = el_el.GetI()[i]; k < el_el.GetI()[i+1]; k++)
+      {
+         const int j = el_el.GetJ()[k];
+         if (partitioning[i] != partitioning[j]) { edgecut++; }
+         if (i*nparts/ne != j*nparts/ne) { slab_edgecut++; }
+      }
+   }
+   REQUIRE(edgecut <= slab_edgecut);
+}
+
+TEST_CASE("Sorted topology", "[Mesh]")
+{
+   auto mesh_fname = GENERATE("../../data/star-mixed.mesh",
+                              "../../data/escher.mesh",
+                              "../../data/fichera-mixed.mesh",
+                              "../../data/fichera-amr.mesh",
+                              "../../data/inline-wedge.mesh",
+                              "../../data/inline-pyramid.mesh");
+   const bool refine = GENERATE(false, true);
+   CAPTURE(mesh_fname, refine);
+
+   auto load = [&](bool sorted)
+   {
+      const bool sorted_topology = Mesh::sorted_topology;
+      Mesh::sorted_topology = sorted;
+      Mesh mesh = Mesh::LoadFromFile(mesh_fname);
+      if (refine) { mesh.UniformRefinement(); }
+      Mesh::sorted_topology = sorted_topology;
+      return mesh;
+   };
+   Mesh mesh = load(false);
+   Mesh sorted_mesh = load(true);
+
+   REQUIRE(sorted_mesh.GetNEdges() == mesh.GetNEdges());
+   REQUIRE(sorted_mesh.GetNumFaces() == mesh.GetNumFaces());
+
+   auto same_table = [](const Table &a, const Table &b)
+   {
+      if (a.Size() != b.Size() || a.Size_of_connections() !=
+          b.Size_of_connections()) { return false; }
+      return std::equal(a.GetI(), a.GetI() + a.Size() + 1, b.GetI()) &&
+             std::equal(a.GetJ(), a.GetJ() + a.Size_of_connections(), b.GetJ());
+   };
+   REQUIRE(same_table(sorted_mesh.ElementToEdgeTable(),
+                      mesh.ElementToEdgeTable()));
+   if (mesh.Dimension() == 3)
+   {
+      REQUIRE(same_table(sorted_mesh.ElementToFaceTable(),
+                         mesh.ElementToFaceTable()));
+   }
+   for (int i = 0; i < mesh.GetNBE(); i++)
+   {
+      REQUIRE(sorted_mesh.GetBdrElementFaceIndex(i) ==
+              mesh.GetBdrElementFaceIndex(i));
+   }
+   Array<int> v1, v2;
+   for (int i = 0; i < mesh.GetNEdges(); i++)
+   {
+      mesh.GetEdgeVertices(i, v1);
+      sorted_mesh.GetEdgeVertices(i, v2);
+      REQUIRE(v1 == v2);
+   }
+}
+
+TEST_CASE("Binary mesh format", "[Mesh]")
+{
+   auto mesh_fname = GENERATE("../../data/star.mesh",
+                              "../../data/fichera-mixed.mesh",
+                              "../../data/fichera-q3.mesh",
+                              "../../data/escher-p2.vtk");
+   CAPTURE(mesh_fname);
+
+   Mesh mesh = Mesh::LoadFromFile(mesh_fname);
+   mesh.attribute_sets.SetAttributeSet("All", mesh.attributes);
+   mesh.bdr_attribute_sets.SetAttributeSet("Boundary", mesh.bdr_attributes);
+   std::stringstream buf(std::ios::in | std::ios::out | std::ios::binary);
+   mesh.PrintBinary(buf);
+   Mesh bin_mesh(buf, 0, 0, false);
+
+   REQUIRE(bin_mesh.Dimension() == mesh.Dimension());
+   REQUIRE(bin_mesh.SpaceDimension() == mesh.SpaceDimension());
+   REQUIRE(bin_mesh.GetNE() == mesh.GetNE());
+   REQUIRE(bin_mesh.GetNBE() == mesh.GetNBE());
+   REQUIRE(bin_mesh.GetNV() == mesh.GetNV());
+   REQUIRE(bin_mesh.GetNEdges() == mesh.GetNEdges());
+   REQUIRE(bin_mesh.GetNumFaces() == mesh.GetNumFaces());
+   REQUIRE(bin_mesh.attribute_sets.GetAttributeSetNames() ==
+           mesh.attribute_sets.GetAttributeSetNames());
+   REQUIRE(bin_mesh.bdr_attribute_sets.GetAttributeSetNames() ==
+           mesh.bdr_attribute_sets.GetAttributeSetNames());
+
+   Array<int> v1, v2;
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      REQUIRE(bin_mesh.GetAttribute(i) == mesh.GetAttribute(i));
+      REQUIRE(bin_mesh.GetElementGeometry(i) == mesh.GetElementGeometry(i));
+      mesh.GetElementVertices(i, v1);
+      bin_mesh.GetElementVertices(i, v2);
+      REQUIRE(v1 == v2);
+   }
+   for (int i = 0; i < mesh.GetNBE(); i++)
+   {
+      REQUIRE(bin_mesh.GetBdrAttribute(i) == mesh.GetBdrAttribute(i));
+      mesh.GetBdrElementVertices(i, v1);
+      bin_mesh.GetBdrElementVertices(i, v2);
+      REQUIRE(v1 == v2);
+   }
+   for (int i = 0; i < mesh.GetNV(); i++)
+   {
+      for (int d = 0; d < mesh.SpaceDimension(); d++)
+      {
+         REQUIRE(bin_mesh.GetVertex(i)[d] == mesh.GetVertex(i)[d]);
+      }
+   }
+
+   REQUIRE((bin_mesh.GetNodes() != nullptr) == (mesh.GetNodes() != nullptr));
+   if (mesh.GetNodes())
+   {
+      const GridFunction &nodes = *mesh.GetNodes();
+      const GridFunction &bin_nodes = *bin_mesh.GetNodes();
+      REQUIRE(std::string(bin_nodes.FESpace()->FEColl()->Name()) ==
+              nodes.FESpace()->FEColl()->Name());
+      REQUIRE(bin_nodes.FESpace()->GetOrdering() ==
+              nodes.FESpace()->GetOrdering());
+      REQUIRE(bin_nodes.Size() == nodes.Size());
+      Vector diff(nodes);
+      diff -= bin_nodes;
+      REQUIRE(diff.Normlinf() == 0.0);
+   }
+}
+
+TEST_CASE("Gmsh reader", "[Mesh]")
+{
+   const bool binary = GENERATE(false, true);
+   CAPTURE(binary);
+
+   // Write a Cartesian mesh in the Gmsh v2.2 format, with gaps in the node
+   // numbering and Windows line endings in the ASCII format
+   Mesh cart = Mesh::MakeCartesian3D(3, 2, 2, Element::HEXAHEDRON);
+   const char *eol = binary ? "\n" : "\r\n";
+   std::ostringstream os;
+   os.precision(16);
+   os << "$MeshFormat\n2.2 " << binary << " 8\n";
+   if (binary) { bin_io::write<int>(os, 1); os << "\n"; }
+   os << "$EndMeshFormat\n$Nodes\n" << cart.GetNV() << "\n";
+   for (int i = 0; i < cart.GetNV(); i++)
+   {
+      const real_t *v = cart.GetVertex(i);
+      if (binary)
+      {
+         bin_io::write<int>(os, 10*(i + 1));
+         for (int d = 0; d < 3; d++) { bin_io::write<double>(os, v[d]); }
+      }
+      else
+      {
+         os << 10*(i + 1) << " " << v[0] << "  " << v[1] << "\t" << v[2] << eol;
+      }
+   }
+   os << "$EndNodes\n$Elements\n" << cart.GetNBE() + cart.GetNE() << "\n";
+   Array<int> v;
+   for (int bdr = 1; bdr >= 0; bdr--)
+   {
+      const int n = bdr ? cart.GetNBE() : cart.GetNE(), type = bdr ? 3 : 5;
+      if (binary)
+      {
+         bin_io::write<int>(os, type);
+         bin_io::write<int>(os, n);
+         bin_io::write<int>(os, 2);
+      }
+      for (int i = 0; i < n; i++)
+      {
+         const int attr = bdr ? cart.GetBdrAttribute(i) : cart.GetAttribute(i);
+         if (bdr) { cart.GetBdrElementVertices(i, v); }
+         else { cart.GetElementVertices(i, v); }
+         if (binary)
+         {
+            bin_io::write<int>(os, i + 1);
+            bin_io::write<int>(os, attr);
+            bin_io::write<int>(os, attr);
+            for (int j : v) { bin_io::write<int>(os, 10*(j + 1)); }
+         }
+         else
+         {
+            os << i + 1 << " " << type << " 2 " << attr << " " << attr;
+            for (int j : v) { os << " " << 10*(j + 1); }
+            os << eol;
+         }
+      }
+   }
+   os << "$EndElements\n";
+
+   std::istringstream is(os.str());
+   Mesh mesh(is, 0, 0, false);
+   REQUIRE(mesh.GetNV() == cart.GetNV());
+   REQUIRE(mesh.GetNE() == cart.GetNE());
+   REQUIRE(mesh.GetNBE() == cart.GetNBE());
+   for (int i = 0; i < mesh.GetNV(); i++)
+   {
+      for (int d = 0; d < 3; d++)
+      {
+         REQUIRE(mesh.GetVertex(i)[d] == MFEM_Approx(cart.GetVertex(i)[d]));
+      }
+   }
+   Array<int> v2;
+   for (int i = 0; i < mesh.GetNE(); i++)
+   {
+      REQUIRE(mesh.GetAttribute(i) == cart.GetAttribute(i));
+      cart.GetElementVertices(i, v);
+      mesh.GetElementVertices(i, v2);
+      REQUIRE(v == v2);
+   }
+   for (int i = 0; i < mesh.GetNBE(); i++)
+   {
+      REQUIRE(mesh.GetBdrAttribute(i) == cart.GetBdrAttribute(i));
+      cart.GetBdrElementVertices(i, v);
+      mesh.GetBdrElementVertices(i, v2);
+      REQUIRE(v == v2);
+   }
+}
+
+TEST_CASE("Threaded uniform refinement", "[Mesh]")
+{
+   auto mesh_fname = GENERATE("../../data/escher.mesh",
+                              "../../data/beam-hex.mesh",
+                              "../../data/fichera-mixed.mesh",
+                              "../../data/inline-wedge.mesh");
+   const int order = GENERATE(0, 2);
+   CAPTURE(mesh_fname, order);
+
+   Mesh coarse = Mesh::LoadFromFile(mesh_fname);
+   // Perturb the vertices, so that the new vertices depend on the summation
+   // order in the averages
+   std::mt19937 gen(0);
+   std::uniform_real_distribution<real_t> dist(-0.1, 0.1);
+   for (int i = 0; i < coarse.GetNV(); i++)
+   {
+      for (int d = 0; d < 3; d++) { coarse.GetVertex(i)[d] += 0.01*dist(gen); }
+   }
+   if (order > 0) { coarse.SetCurvature(order); }
+   const real_t volume = coarse.GetElementVolume(0);
+
+   auto refine = [&](int nthreads)
+   {
+      Mesh mesh(coarse);
+#ifdef MFEM_USE_LEGACY_OPENMP
+      const int max_threads = omp_get_max_threads();
+      if (nthreads > 0) { omp_set_num_threads(nthreads); }
+      mesh.UniformRefinement();
+      omp_set_num_threads(max_threads);
+#else
+      MFEM_CONTRACT_VAR(nthreads);
+      mesh.UniformRefinement();
+#endif
+      return mesh;
+   };
+   // The threaded refinement must give the same result as the sequential one
+   Mesh serial = refine(1);
+   Mesh threaded = refine(0);
+
+   REQUIRE(threaded.GetNV() == serial.GetNV());
+   REQUIRE(threaded.GetNE() == serial.GetNE());
+   REQUIRE(threaded.GetNBE() == serial.GetNBE());
+   for (int i = 0; i < serial.GetNV(); i++)
+   {
+      for (int d = 0; d < 3; d++)
+      {
+         REQUIRE(threaded.GetVertex(i)[d] == serial.GetVertex(i)[d]);
+      }
+   }
+   Array<int> v1, v2;
+   for (int i = 0; i < serial.GetNE(); i++)
+   {
+      serial.GetElementVertices(i, v1);
+      threaded.GetElementVertices(i, v2);
+      REQUIRE(v1 == v2);
+      REQUIRE(threaded.GetAttribute(i) == serial.GetAttribute(i));
+   }
+   if (order > 0)
+   {
+      const GridFunction &n1 = *serial.GetNodes(), &n2 = *threaded.GetNodes();
+      REQUIRE(n2.Size() == n1.Size());
+      for (int i = 0; i < n1.Size(); i++) { REQUIRE(n2(i) == n1(i)); }
+   }
+
+   // The children of each element fill it, up to the perturbation of the
+   // vertices which makes the faces non-planar
+   real_t vol = 0.0;
+   for (int i = 0; i < serial.GetNE(); i++)
+   {
+      const int parent = serial.GetRefinementTransforms().embeddings[i].parent;
+      if (parent == 0) { vol += serial.GetElementVolume(i); }
+   }
+   REQUIRE(vol == MFEM_Approx(volume, 1e-12, 1e-5));
+}
@@ -182,6 +182,70 @@ TEST_CASE("NCMesh 3D Derefined Volume", "[NCMesh]")
    REQUIRE(derefined_volume == MFEM_Approx(original_volume));
 } // test case
 
+// Test case: Verify that the NC level limit enforced after each refinement of
+//            an AMR loop, which only checks the neighborhood of the root
+//            elements modified since the previous cycle, gives the same mesh
+//            as a full check of all leaf elements.
+TEST_CASE("NCMesh Incremental NC Level Limit", "[NCMesh]")
+{
+   const int dim = GENERATE(2, 3);
+   const bool aniso = GENERATE(false, true);
+   const int nc_limit = GENERATE(1, 2);
+
+   Mesh mesh = (dim == 2)
+               ? Mesh::MakeCartesian2D(6, 6, Element::QUADRILATERAL)
+               : Mesh::MakeCartesian3D(3, 3, 3, Element::HEXAHEDRON);
+   mesh.EnsureNCMesh(true);
+
+   srand(1234);
+   for (int cycle = 0; cycle < 5; cycle++)
+   {
+      // a copy of the mesh without the record of the modified roots
+      std::stringstream ss;
+      ss.precision(16);
+      mesh.Print(ss);
+      Mesh ref_mesh(ss, 1, 1);
+
+      Array<Refinement> refs;
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         if (rand() % 8 == 0)
+         {
+            const char type = aniso ? (rand() % ((1 << dim) - 1) + 1) : 7;
+            refs.Append(Refinement(i, type));
+         }
+      }
+      mesh.GeneralRefinement(refs, 1, nc_limit);
+      ref_mesh.GeneralRefinement(refs, 1, nc_limit);
+      REQUIRE(mesh.GetNE() == ref_mesh.GetNE());
+
+      // derefine some elements, which also changes the leaves of their roots
+      Vector errors(mesh.GetNE());
+      errors.Randomize(cycle + 1);
+      mesh.DerefineByError(errors, 0.1, nc_limit);
+
+      // no leaf violates the limit
+      std::stringstream ss2;
+      ss2.precision(16);
+      mesh.Print(ss2);
+      Mesh check_mesh(ss2, 1, 1);
+      const int num_elements = check_mesh.ncmesh->GetNumElements();
+      check_mesh.ncmesh->LimitNCLevel(nc_limit);
+      REQUIRE(check_mesh.ncmesh->GetNumElements() == num_elements);
+
+      // the incrementally updated leaves are in the order of a full update
+      REQUIRE(check_mesh.GetNE() == mesh.GetNE());
+      Vector c1(dim), c2(dim);
+      for (int i = 0; i < mesh.GetNE(); i++)
+      {
+         mesh.GetElementCenter(i, c1);
+         check_mesh.GetElementCenter(i, c2);
+         c1 -= c2;
+         REQUIRE(c1.Normlinf() == MFEM_Approx(0.0));
+      }
+   }
+}
+
 
 #ifdef MFEM_USE_MPI
 
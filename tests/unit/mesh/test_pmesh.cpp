@@ -223,6 +223,39 @@ TEST_CASE("ParMeshMakeSimplicial", "[Parallel], [ParMesh]")
    REQUIRE(x.Normlinf() == MFEM_Approx(0.0));
 }
 
+TEST_CASE("ParMeshLoadFromRoot", "[Parallel], [ParMesh]")
+{
+   // The mesh obtained from the parts sent by the root must be the same as the
+   // one constructed from the full serial mesh with the same partitioning.
+   auto mesh_file = GENERATE("../../data/star.mesh",
+                             "../../data/fichera.mesh",
+                             "../../data/square-disc-p2.vtk");
+   const int part_method = 6;
+
+   ParMesh pmesh = ParMesh::LoadFromRoot(MPI_COMM_WORLD, mesh_file,
+                                         part_method);
+
+   Mesh mesh(mesh_file, 1, 1);
+   int *partitioning = mesh.GeneratePartitioning(Mpi::WorldSize(),
+                                                 part_method);
+   ParMesh pmesh_ref(MPI_COMM_WORLD, mesh, partitioning);
+   delete [] partitioning;
+
+   REQUIRE(pmesh.GetNE() == pmesh_ref.GetNE());
+   REQUIRE(pmesh.GetNBE() == pmesh_ref.GetNBE());
+   REQUIRE(pmesh.GetNSharedFaces() == pmesh_ref.GetNSharedFaces());
+   REQUIRE(pmesh.GetGlobalNE() == mesh.GetNE());
+   REQUIRE((pmesh.GetNodes() != nullptr) == (mesh.GetNodes() != nullptr));
+
+   real_t vol = 0.0, vol_ref = 0.0;
+   for (int i = 0; i < pmesh.GetNE(); i++)
+   {
+      vol += pmesh.GetElementVolume(i);
+      vol_ref += pmesh_ref.GetElementVolume(i);
+   }
+   REQUIRE(vol == MFEM_Approx(vol_ref));
+}
+
 #endif // MFEM_USE_MPI
 
 } // namespace mfem